@@ -17,7 +17,8 @@ project "wxFormBuilder"
     excludes
     {
         "../../src/controls/**",
-        "../../src/rad/designer/resizablepanel.*"
+        "../../src/rad/designer/resizablepanel.*",
+        "../../src/maingen.cpp"
     }
     includedirs
     {
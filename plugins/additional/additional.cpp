@@ -155,20 +155,20 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxCalendarCtrl((wxWindow *)parent, wxID_ANY,
 			wxDefaultDateTime,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxCalendarCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxCalendarCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxCalendarCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxCalendarCtrl"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -180,19 +180,19 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxDatePickerCtrl((wxWindow *)parent, wxID_ANY,
 			wxDefaultDateTime,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxDatePickerCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxDatePickerCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxDatePickerCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxDatePickerCtrl"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -204,19 +204,19 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxTimePickerCtrl( ( wxWindow * )parent, wxID_ANY,
 									 wxDefaultDateTime,
-									 obj->GetPropertyAsPoint( _( "pos" ) ),
-									 obj->GetPropertyAsSize( _( "size" ) ),
-									 obj->GetPropertyAsInteger( _( "style" ) ) | obj->GetPropertyAsInteger( _( "window_style" ) ) );
+									 obj->GetPropertyAsPoint( wxT( "pos" ) ),
+									 obj->GetPropertyAsSize( wxT( "size" ) ),
+									 obj->GetPropertyAsInteger( wxT( "style" ) ) | obj->GetPropertyAsInteger( wxT( "window_style" ) ) );
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc( obj, _( "wxTimePickerCtrl" ), obj->GetPropertyAsString( _( "name" ) ) );
+		ObjectToXrcFilter xrc( obj, wxT( "wxTimePickerCtrl" ), obj->GetPropertyAsString( wxT( "name" ) ) );
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter( xrcObj, _( "wxTimePickerCtrl" ) );
+		XrcToXfbFilter filter( xrcObj, wxT( "wxTimePickerCtrl" ) );
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -230,14 +230,14 @@ class RichTextCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 
-		wxString text = obj->GetPropertyAsString(_("value"));
+		wxString text = obj->GetPropertyAsString(wxT("value"));
 
 		wxRichTextCtrl* richText = new wxRichTextCtrl( 	(wxWindow*)parent,
 															wxID_ANY,
 															text,
-															obj->GetPropertyAsPoint(_("pos")),
-															obj->GetPropertyAsSize(_("size")),
-															obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+															obj->GetPropertyAsPoint(wxT("pos")),
+															obj->GetPropertyAsSize(wxT("size")),
+															obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		if (!text.empty())
 		{
@@ -378,16 +378,16 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxRichTextCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxRichTextCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxRichTextCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxRichTextCtrl"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"), _("value"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 };
@@ -397,9 +397,9 @@ class HtmlWindowComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxHtmlWindow *hw = new wxHtmlWindow((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		wxString dummy_page(
 			wxT("<b>wxHtmlWindow</b><br />")
@@ -412,13 +412,13 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxHtmlWindow"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxHtmlWindow"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxHtmlWindow"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxHtmlWindow"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -430,49 +430,49 @@ class ToggleButtonComponent : public ComponentBase, public wxEvtHandler
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxString label = obj->GetPropertyAsString( _("label") );
+		wxString label = obj->GetPropertyAsString( wxT("label") );
 		wxToggleButton* button = new wxToggleButton((wxWindow *)parent, wxID_ANY,
 			label,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 #if wxCHECK_VERSION( 2, 9, 2 )
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("markup")) != 0) {
 			button->SetLabelMarkup(label);
 		}
 #endif
 
-		if (!obj->IsNull(_("bitmap"))) {
-			button->SetBitmap(obj->GetPropertyAsBitmap(_("bitmap")));
+		if (!obj->IsNull(wxT("bitmap"))) {
+			button->SetBitmap(obj->GetPropertyAsBitmap(wxT("bitmap")));
 		}
 
-		if (!obj->IsNull(_("disabled"))) {
-			button->SetBitmapDisabled(obj->GetPropertyAsBitmap(_("disabled")));
+		if (!obj->IsNull(wxT("disabled"))) {
+			button->SetBitmapDisabled(obj->GetPropertyAsBitmap(wxT("disabled")));
 		}
 
-		if (!obj->IsNull(_("pressed"))) {
-			button->SetBitmapPressed(obj->GetPropertyAsBitmap(_("pressed")));
+		if (!obj->IsNull(wxT("pressed"))) {
+			button->SetBitmapPressed(obj->GetPropertyAsBitmap(wxT("pressed")));
 		}
 
-		if (!obj->IsNull(_("focus"))) {
-			button->SetBitmapFocus(obj->GetPropertyAsBitmap(_("focus")));
+		if (!obj->IsNull(wxT("focus"))) {
+			button->SetBitmapFocus(obj->GetPropertyAsBitmap(wxT("focus")));
 		}
 
-		if (!obj->IsNull(_("current"))) {
-			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(_("current")));
+		if (!obj->IsNull(wxT("current"))) {
+			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(wxT("current")));
 		}
 
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNull(wxT("position"))) {
 			button->SetBitmapPosition(
-			    static_cast<wxDirection>(obj->GetPropertyAsInteger(_("position"))));
+			    static_cast<wxDirection>(obj->GetPropertyAsInteger(wxT("position"))));
 		}
 
-		if (!obj->IsNull(_("margins"))) {
-			button->SetBitmapMargins(obj->GetPropertyAsSize(_("margins")));
+		if (!obj->IsNull(wxT("margins"))) {
+			button->SetBitmapMargins(obj->GetPropertyAsSize(wxT("margins")));
 		}
 
-		button->SetValue((obj->GetPropertyAsInteger(_("value")) != 0));
+		button->SetValue((obj->GetPropertyAsInteger(wxT("value")) != 0));
 		button->Connect( wxEVT_COMMAND_TOGGLEBUTTON_CLICKED, wxCommandEventHandler( ToggleButtonComponent::OnToggle ), NULL, this );
 		return button;
 	}
@@ -484,53 +484,53 @@ public:
 		{
 			wxString value;
 			value.Printf( wxT("%i"), window->GetValue() ? 1 : 0 );
-			GetManager()->ModifyProperty( window, _("value"), value );
+			GetManager()->ModifyProperty( window, wxT("value"), value );
 			window->SetFocus();
 		}
 	}
 
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxToggleButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxToggleButton"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("markup"), _("markup"), XRC_TYPE_BOOL);
-		xrc.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
-		if (!obj->IsNull(_("disabled"))) {
-			xrc.AddProperty(_("disabled"), _("disabled"), XRC_TYPE_BITMAP);
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("markup"), wxT("markup"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("disabled"))) {
+			xrc.AddProperty(wxT("disabled"), wxT("disabled"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("pressed"))) {
-			xrc.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("pressed"))) {
+			xrc.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("focus"))) {
-			xrc.AddProperty(_("focus"), _("focus"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("focus"))) {
+			xrc.AddProperty(wxT("focus"), wxT("focus"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("current"))) {
-			xrc.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("current"))) {
+			xrc.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("position"))) {
-			xrc.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
+		if (!obj->IsNull(wxT("position"))) {
+			xrc.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
 		}
-		if (!obj->IsNull(_("margins"))) {
-			xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
+		if (!obj->IsNull(wxT("margins"))) {
+			xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
 		}
-		xrc.AddProperty(_("value"),_("checked"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("value"),wxT("checked"), XRC_TYPE_BOOL);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxToggleButton"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxToggleButton"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("markup"), _("markup"), XRC_TYPE_BOOL);
-		filter.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("disabled"), _("disabled"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("focus"), _("focus"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("checked"),_("value"), XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("markup"), wxT("markup"), XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("disabled"), wxT("disabled"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("focus"), wxT("focus"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("checked"),wxT("value"), XRC_TYPE_BOOL);
 		return filter.GetXfbObject();
 	}
 };
@@ -540,46 +540,46 @@ class BitmapToggleButtonComponent : public ComponentBase, public wxEvtHandler
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxBitmapToggleButton* button = new wxBitmapToggleButton((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsBitmap(wxT("bitmap")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 #if wxCHECK_VERSION( 2, 9, 2 )
 		// To stay in sync what the generator templates do apply the markup label here as well
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
-			button->SetLabelMarkup(obj->GetPropertyAsString(_("label")));
+		if (obj->GetPropertyAsInteger(wxT("markup")) != 0) {
+			button->SetLabelMarkup(obj->GetPropertyAsString(wxT("label")));
 		}
 #endif
 
-		if (!obj->IsNull(_("disabled")))
+		if (!obj->IsNull(wxT("disabled")))
 		{
-			button->SetBitmapDisabled( obj->GetPropertyAsBitmap( _("disabled") ) );
+			button->SetBitmapDisabled( obj->GetPropertyAsBitmap( wxT("disabled") ) );
 		}
 
-		if (!obj->IsNull(_("pressed"))) {
-			button->SetBitmapPressed(obj->GetPropertyAsBitmap(_("pressed")));
+		if (!obj->IsNull(wxT("pressed"))) {
+			button->SetBitmapPressed(obj->GetPropertyAsBitmap(wxT("pressed")));
 		}
 
-		if (!obj->IsNull(_("focus")))
+		if (!obj->IsNull(wxT("focus")))
 		{
-			button->SetBitmapFocus( obj->GetPropertyAsBitmap( _("focus") ) );
+			button->SetBitmapFocus( obj->GetPropertyAsBitmap( wxT("focus") ) );
 		}
 
-		if (!obj->IsNull(_("current"))) {
-			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(_("current")));
+		if (!obj->IsNull(wxT("current"))) {
+			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(wxT("current")));
 		}
 
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNull(wxT("position"))) {
 			button->SetBitmapPosition(
-			    static_cast<wxDirection>(obj->GetPropertyAsInteger(_("position"))));
+			    static_cast<wxDirection>(obj->GetPropertyAsInteger(wxT("position"))));
 		}
 
-		if (!obj->IsNull(_("margins"))) {
-			button->SetBitmapMargins(obj->GetPropertyAsSize(_("margins")));
+		if (!obj->IsNull(wxT("margins"))) {
+			button->SetBitmapMargins(obj->GetPropertyAsSize(wxT("margins")));
 		}
 
-		button->SetValue( ( obj->GetPropertyAsInteger(_("value")) != 0 ) );
+		button->SetValue( ( obj->GetPropertyAsInteger(wxT("value")) != 0 ) );
 		button->Connect( wxEVT_COMMAND_TOGGLEBUTTON_CLICKED, wxCommandEventHandler( ToggleButtonComponent::OnToggle ), NULL, this );
 
 		return button;
@@ -592,50 +592,50 @@ public:
 		{
 			wxString value;
 			value.Printf( wxT("%i"), window->GetValue() ? 1 : 0 );
-			GetManager()->ModifyProperty( window, _("value"), value );
+			GetManager()->ModifyProperty( window, wxT("value"), value );
 			window->SetFocus();
 		}
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxBitmapToggleButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxBitmapToggleButton"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		if ( !obj->IsNull( _("disabled") ) )
+		xrc.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
+		if ( !obj->IsNull( wxT("disabled") ) )
 		{
-			xrc.AddProperty(_("disabled"),_("disabled"),XRC_TYPE_BITMAP);
+			xrc.AddProperty(wxT("disabled"),wxT("disabled"),XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("pressed"))) {
-			xrc.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("pressed"))) {
+			xrc.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
 		}
-		if ( !obj->IsNull( _("focus") ) )
+		if ( !obj->IsNull( wxT("focus") ) )
 		{
-			xrc.AddProperty(_("focus"),_("focus"),XRC_TYPE_BITMAP);
+			xrc.AddProperty(wxT("focus"),wxT("focus"),XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("current"))) {
-			xrc.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("current"))) {
+			xrc.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("position"))) {
-			xrc.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
+		if (!obj->IsNull(wxT("position"))) {
+			xrc.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
 		}
-		if (!obj->IsNull(_("margins"))) {
-			xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
+		if (!obj->IsNull(wxT("margins"))) {
+			xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
 		}
-		xrc.AddProperty(_("value"),_("checked"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("value"),wxT("checked"), XRC_TYPE_BOOL);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxBitmapToggleButton"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxBitmapToggleButton"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		filter.AddProperty(_("disabled"),_("disabled"),XRC_TYPE_BITMAP);
-		filter.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("focus"),_("focus"),XRC_TYPE_BITMAP);
-		filter.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("checked"),_("value"), XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("disabled"),wxT("disabled"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("focus"),wxT("focus"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("checked"),wxT("value"), XRC_TYPE_BOOL);
 		return filter.GetXfbObject();
 	}
 
@@ -645,11 +645,11 @@ class TreeCtrlComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		int style = obj->GetPropertyAsInteger(_("style"));
+		int style = obj->GetPropertyAsInteger(wxT("style"));
 		wxTreeCtrl *tc = new wxTreeCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			style | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			style | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		// dummy nodes
 		wxTreeItemId root = tc->AddRoot(wxT("root node"));
@@ -668,13 +668,13 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxTreeCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxTreeCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxTreeCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxTreeCtrl"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -685,9 +685,9 @@ class ScrollBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxScrollBar *sb = new wxScrollBar((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		sb->SetScrollbar(obj->GetPropertyAsInteger(_T("value")),
 			obj->GetPropertyAsInteger(_T("thumbsize")),
@@ -697,22 +697,22 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxScrollBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxScrollBar"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("thumbsize"), _("thumbsize"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("pagesize"), _("pagesize"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("thumbsize"), wxT("thumbsize"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("range"), wxT("range"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("pagesize"), wxT("pagesize"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxScrollBar"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxScrollBar"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("thumbsize"), _("thumbsize"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("pagesize"), _("pagesize"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("thumbsize"), wxT("thumbsize"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("range"), wxT("range"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("pagesize"), wxT("pagesize"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 };
@@ -721,16 +721,16 @@ class SpinCtrlComponent : public ComponentBase, public wxEvtHandler
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		int max = obj->GetPropertyAsInteger(_("max"));
-		int min = obj->GetPropertyAsInteger(_("min"));
+		int max = obj->GetPropertyAsInteger(wxT("max"));
+		int min = obj->GetPropertyAsInteger(wxT("min"));
 		wxSpinCtrl* window = new wxSpinCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")),
 			min < max ? min : max,
 			max,
-			obj->GetPropertyAsInteger(_("initial")));
+			obj->GetPropertyAsInteger(wxT("initial")));
 
 		window->Connect( wxEVT_COMMAND_SPINCTRL_UPDATED, wxSpinEventHandler( SpinCtrlComponent::OnSpin ), NULL, this );
 		return window;
@@ -743,7 +743,7 @@ public:
 		{
 			wxString value;
 			value.Printf( wxT("%i"), window->GetValue() );
-			GetManager()->ModifyProperty( window, _("initial"), value );
+			GetManager()->ModifyProperty( window, wxT("initial"), value );
 			window->SetFocus();
 		}
 	}
@@ -758,21 +758,21 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSpinCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxSpinCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("initial"),_("value"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("max"),_("max"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("initial"),wxT("value"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("min"),wxT("min"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("max"),wxT("max"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSpinCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxSpinCtrl"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"),_("value"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("value"),_("initial"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("max"),_("max"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("value"),wxT("value"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("value"),wxT("initial"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("min"),wxT("min"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("max"),wxT("max"), XRC_TYPE_INTEGER);
 
 		return filter.GetXfbObject();
 	}
@@ -783,16 +783,16 @@ class SpinCtrlDoubleComponent : public ComponentBase, public wxEvtHandler
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxSpinCtrlDouble* window = new wxSpinCtrlDouble((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
-			obj->GetPropertyAsFloat(_("min")),
-			obj->GetPropertyAsFloat(_("max")),
-			obj->GetPropertyAsFloat(_("initial")),
-			obj->GetPropertyAsFloat(_("inc")));
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")),
+			obj->GetPropertyAsFloat(wxT("min")),
+			obj->GetPropertyAsFloat(wxT("max")),
+			obj->GetPropertyAsFloat(wxT("initial")),
+			obj->GetPropertyAsFloat(wxT("inc")));
 
-		window->SetDigits(obj->GetPropertyAsInteger(_("digits")));
+		window->SetDigits(obj->GetPropertyAsInteger(wxT("digits")));
 
 		window->Connect( wxEVT_COMMAND_SPINCTRLDOUBLE_UPDATED, wxSpinEventHandler( SpinCtrlDoubleComponent::OnSpin ), NULL, this );
 		return window;
@@ -805,7 +805,7 @@ public:
 		{
 			wxString value;
 			value.Printf( wxT("%f"), window->GetValue() );
-			GetManager()->ModifyProperty( window, _("initial"), value );
+			GetManager()->ModifyProperty( window, wxT("initial"), value );
 			window->SetFocus();
 		}
 	}
@@ -820,25 +820,25 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSpinCtrlDouble"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxSpinCtrlDouble"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("initial"),_("value"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("max"),_("max"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("inc"),_("inc"), XRC_TYPE_FLOAT);
-		xrc.AddProperty(_("digits"), _("digits"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("initial"),wxT("value"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("min"),wxT("min"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("max"),wxT("max"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("inc"),wxT("inc"), XRC_TYPE_FLOAT);
+		xrc.AddProperty(wxT("digits"), wxT("digits"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSpinCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxSpinCtrl"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"),_("value"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("value"),_("initial"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("max"),_("max"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("inc"),_("inc"), XRC_TYPE_FLOAT);
-		filter.AddProperty(_("digits"), _("digits"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("value"),wxT("value"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("value"),wxT("initial"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("min"),wxT("min"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("max"),wxT("max"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("inc"),wxT("inc"), XRC_TYPE_FLOAT);
+		filter.AddProperty(wxT("digits"), wxT("digits"), XRC_TYPE_INTEGER);
 
 		return filter.GetXfbObject();
 	}
@@ -849,19 +849,19 @@ class SpinButtonComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxSpinButton((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSpinButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxSpinButton"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSpinButton"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxSpinButton"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -871,28 +871,28 @@ class CheckListBoxComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxArrayString choices (obj->GetPropertyAsArrayString(_("choices")));
+		wxArrayString choices (obj->GetPropertyAsArrayString(wxT("choices")));
 		wxCheckListBox *cl =
 			new wxCheckListBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			choices,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		return cl;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxCheckListBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxCheckListBox"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
+		xrc.AddProperty(wxT("choices"), wxT("content"), XRC_TYPE_STRINGLIST);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxCheckListBox"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxCheckListBox"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("content"), _("choices"), XRC_TYPE_STRINGLIST);
+		filter.AddProperty(wxT("content"), wxT("choices"), XRC_TYPE_STRINGLIST);
 		return filter.GetXfbObject();
 	}
 };
@@ -902,92 +902,92 @@ class GridComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxGrid *grid = new wxGrid((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("window_style")));
 
 		grid->CreateGrid(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")));
+			obj->GetPropertyAsInteger(wxT("rows")),
+			obj->GetPropertyAsInteger(wxT("cols")));
 
-		grid->EnableDragColMove( obj->GetPropertyAsInteger( _("drag_col_move") ) != 0 );
-		grid->EnableDragColSize( obj->GetPropertyAsInteger( _("drag_col_size") ) != 0 );
-		grid->EnableDragGridSize( obj->GetPropertyAsInteger( _("drag_grid_size") ) != 0 );
-		grid->EnableDragRowSize( obj->GetPropertyAsInteger( _("drag_row_size") ) != 0 );
-		grid->EnableEditing( obj->GetPropertyAsInteger( _("editing") ) != 0 );
-		grid->EnableGridLines( obj->GetPropertyAsInteger( _("grid_lines") ) != 0 );
-		if ( !obj->IsNull( _("grid_line_color") ) )
+		grid->EnableDragColMove( obj->GetPropertyAsInteger( wxT("drag_col_move") ) != 0 );
+		grid->EnableDragColSize( obj->GetPropertyAsInteger( wxT("drag_col_size") ) != 0 );
+		grid->EnableDragGridSize( obj->GetPropertyAsInteger( wxT("drag_grid_size") ) != 0 );
+		grid->EnableDragRowSize( obj->GetPropertyAsInteger( wxT("drag_row_size") ) != 0 );
+		grid->EnableEditing( obj->GetPropertyAsInteger( wxT("editing") ) != 0 );
+		grid->EnableGridLines( obj->GetPropertyAsInteger( wxT("grid_lines") ) != 0 );
+		if ( !obj->IsNull( wxT("grid_line_color") ) )
 		{
-			grid->SetGridLineColour( obj->GetPropertyAsColour( _("grid_line_color") ) );
+			grid->SetGridLineColour( obj->GetPropertyAsColour( wxT("grid_line_color") ) );
 		}
-		grid->SetMargins( obj->GetPropertyAsInteger( _("margin_width") ), obj->GetPropertyAsInteger( _("margin_height") ) );
+		grid->SetMargins( obj->GetPropertyAsInteger( wxT("margin_width") ), obj->GetPropertyAsInteger( wxT("margin_height") ) );
 
 		// Label Properties
-		grid->SetColLabelAlignment( obj->GetPropertyAsInteger( _("col_label_horiz_alignment") ), obj->GetPropertyAsInteger( _("col_label_vert_alignment") ) );
+		grid->SetColLabelAlignment( obj->GetPropertyAsInteger( wxT("col_label_horiz_alignment") ), obj->GetPropertyAsInteger( wxT("col_label_vert_alignment") ) );
 
-		wxArrayString columnLabels = obj->GetPropertyAsArrayString( _("col_label_values") );
+		wxArrayString columnLabels = obj->GetPropertyAsArrayString( wxT("col_label_values") );
 		for ( int i = 0; i < (int)columnLabels.size() && i < grid->GetNumberCols(); ++i )
 		{
 			grid->SetColLabelValue( i, columnLabels[i] );
 		}
 
-		if ( !obj->IsNull( _("col_label_size") ) )
+		if ( !obj->IsNull( wxT("col_label_size") ) )
 		{
-			grid->SetColLabelSize( obj->GetPropertyAsInteger( _("col_label_size") ) );
+			grid->SetColLabelSize( obj->GetPropertyAsInteger( wxT("col_label_size") ) );
 		}
 
-		wxArrayInt columnSizes = obj->GetPropertyAsArrayInt( _("column_sizes") );
+		wxArrayInt columnSizes = obj->GetPropertyAsArrayInt( wxT("column_sizes") );
 		for ( int i = 0; i < (int)columnSizes.size() && i < grid->GetNumberCols(); ++i )
 		{
 			grid->SetColSize( i, columnSizes[i] );
 		}
 
-		grid->SetRowLabelAlignment( obj->GetPropertyAsInteger( _("row_label_horiz_alignment") ), obj->GetPropertyAsInteger( _("row_label_vert_alignment") ) );
+		grid->SetRowLabelAlignment( obj->GetPropertyAsInteger( wxT("row_label_horiz_alignment") ), obj->GetPropertyAsInteger( wxT("row_label_vert_alignment") ) );
 
-		wxArrayString rowLabels = obj->GetPropertyAsArrayString( _("row_label_values") );
+		wxArrayString rowLabels = obj->GetPropertyAsArrayString( wxT("row_label_values") );
 		for ( int i = 0; i < (int)rowLabels.size() && i < grid->GetNumberRows(); ++i )
 		{
 			grid->SetRowLabelValue( i, rowLabels[i] );
 		}
 
-		if ( !obj->IsNull( _("row_label_size") ) )
+		if ( !obj->IsNull( wxT("row_label_size") ) )
 		{
-			grid->SetRowLabelSize( obj->GetPropertyAsInteger( _("row_label_size") ) );
+			grid->SetRowLabelSize( obj->GetPropertyAsInteger( wxT("row_label_size") ) );
 		}
 
-		wxArrayInt rowSizes = obj->GetPropertyAsArrayInt( _("row_sizes") );
+		wxArrayInt rowSizes = obj->GetPropertyAsArrayInt( wxT("row_sizes") );
 		for ( int i = 0; i < (int)rowSizes.size() && i < grid->GetNumberRows(); ++i )
 		{
 			grid->SetRowSize( i, rowSizes[i] );
 		}
 
-		if ( !obj->IsNull( _("label_bg") ) )
+		if ( !obj->IsNull( wxT("label_bg") ) )
 		{
-			grid->SetLabelBackgroundColour( obj->GetPropertyAsColour( _("label_bg") ) );
+			grid->SetLabelBackgroundColour( obj->GetPropertyAsColour( wxT("label_bg") ) );
 		}
-		if ( !obj->IsNull( _("label_text") ) )
+		if ( !obj->IsNull( wxT("label_text") ) )
 		{
-			grid->SetLabelTextColour( obj->GetPropertyAsColour( _("label_text") ) );
+			grid->SetLabelTextColour( obj->GetPropertyAsColour( wxT("label_text") ) );
 		}
-		if ( !obj->IsNull( _("label_font") ) )
+		if ( !obj->IsNull( wxT("label_font") ) )
 		{
-			grid->SetLabelFont( obj->GetPropertyAsFont( _("label_font") ) );
+			grid->SetLabelFont( obj->GetPropertyAsFont( wxT("label_font") ) );
 		}
 
 		// Default Cell Properties
-		grid->SetDefaultCellAlignment( obj->GetPropertyAsInteger( _("cell_horiz_alignment") ), obj->GetPropertyAsInteger( _("cell_vert_alignment") ) );
+		grid->SetDefaultCellAlignment( obj->GetPropertyAsInteger( wxT("cell_horiz_alignment") ), obj->GetPropertyAsInteger( wxT("cell_vert_alignment") ) );
 
-		if ( !obj->IsNull( _("cell_bg") ) )
+		if ( !obj->IsNull( wxT("cell_bg") ) )
 		{
-			grid->SetDefaultCellBackgroundColour( obj->GetPropertyAsColour( _("cell_bg") ) );
+			grid->SetDefaultCellBackgroundColour( obj->GetPropertyAsColour( wxT("cell_bg") ) );
 		}
-		if ( !obj->IsNull( _("cell_text") ) )
+		if ( !obj->IsNull( wxT("cell_text") ) )
 		{
-			grid->SetDefaultCellTextColour( obj->GetPropertyAsColour( _("cell_text") ) );
+			grid->SetDefaultCellTextColour( obj->GetPropertyAsColour( wxT("cell_text") ) );
 		}
-		if ( !obj->IsNull( _("cell_font") ) )
+		if ( !obj->IsNull( wxT("cell_font") ) )
 		{
-			grid->SetDefaultCellFont( obj->GetPropertyAsFont( _("cell_font") ) );
+			grid->SetDefaultCellFont( obj->GetPropertyAsFont( wxT("cell_font") ) );
 		}
 
 		// Example Cell Values
@@ -999,11 +999,11 @@ public:
 			}
 		}
 
-		if ( obj->GetPropertyAsInteger( _("autosize_rows") ) != 0 )
+		if ( obj->GetPropertyAsInteger( wxT("autosize_rows") ) != 0 )
 		{
 			grid->AutoSizeRows();
 		}
-		if ( obj->GetPropertyAsInteger( _("autosize_cols") ) != 0 )
+		if ( obj->GetPropertyAsInteger( wxT("autosize_cols") ) != 0 )
 		{
 			grid->AutoSizeColumns();
 		}
@@ -1023,13 +1023,13 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGrid"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxGrid"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGrid"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxGrid"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -1056,7 +1056,7 @@ void ComponentEvtHandler::OnGridColSize( wxGridSizeEvent& )
 	}
 	sizes = sizes.substr( 0, sizes.length() - 1 );
 
-	m_manager->ModifyProperty( m_window, _("column_sizes"), sizes, true );
+	m_manager->ModifyProperty( m_window, wxT("column_sizes"), sizes, true );
 }
 
 void ComponentEvtHandler::OnGridRowSize( wxGridSizeEvent& )
@@ -1074,7 +1074,7 @@ void ComponentEvtHandler::OnGridRowSize( wxGridSizeEvent& )
 	}
 	sizes = sizes.substr( 0, sizes.length() - 1 );
 
-	m_manager->ModifyProperty( m_window, _("row_sizes"), sizes, true );
+	m_manager->ModifyProperty( m_window, wxT("row_sizes"), sizes, true );
 }
 
 class PickerComponentBase : public ComponentBase, public wxEvtHandler
@@ -1131,11 +1131,11 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxColourPickerCtrl* colourpicker = new wxColourPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsColour(_("colour")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsInteger(wxT("id")),
+			obj->GetPropertyAsColour(wxT("colour")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))
 			);
 
 		colourpicker->PushEventHandler( new ComponentEvtHandler( colourpicker, GetManager() ) );
@@ -1152,15 +1152,15 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxColourPickerCtrl"), obj->GetPropertyAsString(_("name")));
-		xrc.AddProperty(_("colour"),_("value"),XRC_TYPE_COLOUR);
+		ObjectToXrcFilter xrc(obj, wxT("wxColourPickerCtrl"), obj->GetPropertyAsString(wxT("name")));
+		xrc.AddProperty(wxT("colour"),wxT("value"),XRC_TYPE_COLOUR);
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxColourPickerCtrl"));
-		filter.AddProperty(_("value"),_("colour"),XRC_TYPE_COLOUR);
+		XrcToXfbFilter filter(xrcObj, wxT("wxColourPickerCtrl"));
+		filter.AddProperty(wxT("value"),wxT("colour"),XRC_TYPE_COLOUR);
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -1172,7 +1172,7 @@ void ComponentEvtHandler::OnColourPickerColourChanged( wxColourPickerEvent& )
 	if ( window != NULL )
 	{
 		wxColour colour = window->GetColour();
-		m_manager->ModifyProperty( window, _("colour"), wxString::Format(wxT("%d,%d,%d"),colour.Red(),colour.Green(),colour.Blue())  );
+		m_manager->ModifyProperty( window, wxT("colour"), wxString::Format(wxT("%d,%d,%d"),colour.Red(),colour.Green(),colour.Blue())  );
 	}
 }
 
@@ -1182,16 +1182,16 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxFontPickerCtrl* picker = new wxFontPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsFont(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsInteger(wxT("id")),
+			obj->GetPropertyAsFont(wxT("value")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))
 			);
 
-		if ( !obj->IsNull( _("max_point_size") ) )
+		if ( !obj->IsNull( wxT("max_point_size") ) )
 		{
-			picker->SetMaxPointSize( obj->GetPropertyAsInteger( _("max_point_size") ) );
+			picker->SetMaxPointSize( obj->GetPropertyAsInteger( wxT("max_point_size") ) );
 		}
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1208,18 +1208,18 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxFontPickerCtrl"), obj->GetPropertyAsString(_("name")));
-		if ( !obj->IsNull( _("value") ) )
+		ObjectToXrcFilter xrc(obj, wxT("wxFontPickerCtrl"), obj->GetPropertyAsString(wxT("name")));
+		if ( !obj->IsNull( wxT("value") ) )
 		{
-			xrc.AddProperty(_("value"),_("value"),XRC_TYPE_FONT);
+			xrc.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_FONT);
 		}
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxFontPickerCtrl"));
-		filter.AddProperty(_("value"),_("value"),XRC_TYPE_FONT);
+		XrcToXfbFilter filter(xrcObj, wxT("wxFontPickerCtrl"));
+		filter.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_FONT);
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -1231,7 +1231,7 @@ void ComponentEvtHandler::OnFontPickerFontChanged( wxFontPickerEvent& )
 	if ( window != NULL )
 	{
 		wxFont font = window->GetSelectedFont();
-		m_manager->ModifyProperty( window, _("value"), wxString::Format( wxT("%s,%d,%d,%d"), font.GetFaceName().c_str(), font.GetStyle(), font.GetWeight(), font.GetPointSize() ) );
+		m_manager->ModifyProperty( window, wxT("value"), wxString::Format( wxT("%s,%d,%d,%d"), font.GetFaceName().c_str(), font.GetStyle(), font.GetWeight(), font.GetPointSize() ) );
 	}
 }
 
@@ -1241,13 +1241,13 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxFilePickerCtrl* picker = new wxFilePickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsString(_("message")),
-			obj->GetPropertyAsString(_("wildcard")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsInteger(wxT("id")),
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsString(wxT("message")),
+			obj->GetPropertyAsString(wxT("wildcard")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))
 			);
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1264,19 +1264,19 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxFilePickerCtrl"), obj->GetPropertyAsString(_("name")));
-		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("wildcard"),_("wildcard"),XRC_TYPE_TEXT);
+		ObjectToXrcFilter xrc(obj, wxT("wxFilePickerCtrl"), obj->GetPropertyAsString(wxT("name")));
+		xrc.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("message"),wxT("message"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("wildcard"),wxT("wildcard"),XRC_TYPE_TEXT);
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxFilePickerCtrl"));
-		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("wildcard"),_("wildcard"),XRC_TYPE_TEXT);
+		XrcToXfbFilter filter(xrcObj, wxT("wxFilePickerCtrl"));
+		filter.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("message"),wxT("message"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("wildcard"),wxT("wildcard"),XRC_TYPE_TEXT);
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -1287,7 +1287,7 @@ void ComponentEvtHandler::OnFilePickerFileChanged( wxFileDirPickerEvent& )
 	wxFilePickerCtrl* window = wxDynamicCast( m_window, wxFilePickerCtrl );
 	if ( window != NULL )
 	{
-		m_manager->ModifyProperty( window, _("value"), window->GetPath() );
+		m_manager->ModifyProperty( window, wxT("value"), window->GetPath() );
 	}
 }
 
@@ -1297,12 +1297,12 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxDirPickerCtrl* picker = new wxDirPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsString(_("message")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsInteger(wxT("id")),
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsString(wxT("message")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))
 			);
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1319,17 +1319,17 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxDirPickerCtrl"), obj->GetPropertyAsString(_("name")));
-		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
+		ObjectToXrcFilter xrc(obj, wxT("wxDirPickerCtrl"), obj->GetPropertyAsString(wxT("name")));
+		xrc.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("message"),wxT("message"),XRC_TYPE_TEXT);
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxDirPickerCtrl"));
-		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
+		XrcToXfbFilter filter(xrcObj, wxT("wxDirPickerCtrl"));
+		filter.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("message"),wxT("message"),XRC_TYPE_TEXT);
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -1340,7 +1340,7 @@ void ComponentEvtHandler::OnDirPickerDirChanged( wxFileDirPickerEvent& )
 	wxDirPickerCtrl* window = wxDynamicCast( m_window, wxDirPickerCtrl );
 	if ( window != NULL )
 	{
-		m_manager->ModifyProperty( window, _("value"), window->GetPath() );
+		m_manager->ModifyProperty( window, wxT("value"), window->GetPath() );
 	}
 }
 
@@ -1350,47 +1350,47 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxHyperlinkCtrl* ctrl = new wxHyperlinkCtrl(
 			(wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsString(_("url")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsString(wxT("label")),
+			obj->GetPropertyAsString(wxT("url")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))
 			);
 
-		if ( !obj->IsNull( _("hover_color") ) )
+		if ( !obj->IsNull( wxT("hover_color") ) )
 		{
-			ctrl->SetHoverColour( obj->GetPropertyAsColour( _("hover_color") ) );
+			ctrl->SetHoverColour( obj->GetPropertyAsColour( wxT("hover_color") ) );
 		}
-		if ( !obj->IsNull( _("normal_color") ) )
+		if ( !obj->IsNull( wxT("normal_color") ) )
 		{
-			ctrl->SetNormalColour( obj->GetPropertyAsColour( _("normal_color") ) );
+			ctrl->SetNormalColour( obj->GetPropertyAsColour( wxT("normal_color") ) );
 		}
-		if ( !obj->IsNull( _("visited_color") ) )
+		if ( !obj->IsNull( wxT("visited_color") ) )
 		{
-			ctrl->SetVisitedColour( obj->GetPropertyAsColour( _("visited_color") ) );
+			ctrl->SetVisitedColour( obj->GetPropertyAsColour( wxT("visited_color") ) );
 		}
 
 		return ctrl;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxHyperlinkCtrl"), obj->GetPropertyAsString(_("name")));
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddPropertyValue(_("url"), obj->GetPropertyAsString(_("url")));
+		ObjectToXrcFilter xrc(obj, wxT("wxHyperlinkCtrl"), obj->GetPropertyAsString(wxT("name")));
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddPropertyValue(wxT("url"), obj->GetPropertyAsString(wxT("url")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxHyperlinkCtrl"));
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+		XrcToXfbFilter filter(xrcObj, wxT("wxHyperlinkCtrl"));
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 
 		try
 		{
 			ticpp::Element *urlElement = xrcObj->FirstChildElement("url");
 			wxString url(urlElement->GetText().c_str(), wxConvUTF8);
 
-			filter.AddPropertyValue(_("url"), url);
+			filter.AddPropertyValue(wxT("url"), url);
 		}
 		catch(ticpp::Exception&)
 		{
@@ -1408,15 +1408,15 @@ public:
 		wxGenericDirCtrl* ctrl = new wxGenericDirCtrl(
 			(wxWindow*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsString(_("defaultfolder")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
-			obj->GetPropertyAsString(_("filter")),
-			obj->GetPropertyAsInteger(_("defaultfilter"))
+			obj->GetPropertyAsString(wxT("defaultfolder")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")),
+			obj->GetPropertyAsString(wxT("filter")),
+			obj->GetPropertyAsInteger(wxT("defaultfilter"))
 			);
 
-		ctrl->ShowHidden( obj->GetPropertyAsInteger( _("show_hidden") ) != 0 );
+		ctrl->ShowHidden( obj->GetPropertyAsInteger( wxT("show_hidden") ) != 0 );
 		ctrl->GetTreeCtrl()->PushEventHandler( new GenericDirCtrlEvtHandler( ctrl, GetManager() ) );
 		return ctrl;
 	}
@@ -1431,19 +1431,19 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGenericDirCtrl"), obj->GetPropertyAsString(_("name")));
-		xrc.AddProperty(_("defaultfolder"),_("defaultfolder"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("filter"),_("filter"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("defaultfilter"),_("defaultfilter"),XRC_TYPE_INTEGER);
+		ObjectToXrcFilter xrc(obj, wxT("wxGenericDirCtrl"), obj->GetPropertyAsString(wxT("name")));
+		xrc.AddProperty(wxT("defaultfolder"),wxT("defaultfolder"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("filter"),wxT("filter"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("defaultfilter"),wxT("defaultfilter"),XRC_TYPE_INTEGER);
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGenericDirCtrl"));
-		filter.AddProperty(_("defaultfolder"),_("defaultfolder"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("filter"),_("filter"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("defaultfilter"),_("defaultfilter"),XRC_TYPE_INTEGER);
+		XrcToXfbFilter filter(xrcObj, wxT("wxGenericDirCtrl"));
+		filter.AddProperty(wxT("defaultfolder"),wxT("defaultfolder"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("filter"),wxT("filter"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("defaultfilter"),wxT("defaultfilter"),XRC_TYPE_INTEGER);
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -1463,7 +1463,7 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, obj->GetPropertyAsString(_("class")), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, obj->GetPropertyAsString(wxT("class")), obj->GetPropertyAsString(wxT("name")));
 		return xrc.GetXrcObject();
 	}
 };
@@ -1473,19 +1473,19 @@ class SearchCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxSearchCtrl* sc = new wxSearchCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		if ( !obj->IsNull( _("search_button") ) )
+		if ( !obj->IsNull( wxT("search_button") ) )
 		{
-			sc->ShowSearchButton(obj->GetPropertyAsInteger(_("search_button")) != 0);
+			sc->ShowSearchButton(obj->GetPropertyAsInteger(wxT("search_button")) != 0);
 		}
 
-		if ( !obj->IsNull( _("cancel_button") ) )
+		if ( !obj->IsNull( wxT("cancel_button") ) )
 		{
-			sc->ShowCancelButton(obj->GetPropertyAsInteger(_("cancel_button")) != 0);
+			sc->ShowCancelButton(obj->GetPropertyAsInteger(wxT("cancel_button")) != 0);
 		}
 
 		sc->PushEventHandler( new ComponentEvtHandler( sc, GetManager() ) );
@@ -1503,16 +1503,16 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSearchCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxSearchCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSearchCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxSearchCtrl"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 
@@ -1523,7 +1523,7 @@ void ComponentEvtHandler::OnText( wxCommandEvent& event)
 	wxSearchCtrl* sc = wxDynamicCast( m_window, wxSearchCtrl );
 	if ( sc != NULL )
 	{
-		m_manager->ModifyProperty( m_window, _("value"), sc->GetValue() );
+		m_manager->ModifyProperty( m_window, wxT("value"), sc->GetValue() );
 		sc->SetInsertionPointEnd();
 		sc->SetFocus();
 	}
@@ -1536,27 +1536,27 @@ class MediaCtrlComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxMediaCtrl* mc = new wxMediaCtrl((wxWindow *)parent, wxID_ANY, wxT(""),obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+		wxMediaCtrl* mc = new wxMediaCtrl((wxWindow *)parent, wxID_ANY, wxT(""),obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		if ( !obj->IsNull( _("file") ) )
+		if ( !obj->IsNull( wxT("file") ) )
 		{
-			if( mc->Load( obj->GetPropertyAsString( _("file") ) ) )
+			if( mc->Load( obj->GetPropertyAsString( wxT("file") ) ) )
 			{
-				if (!obj->IsNull( _("playback_rate"))) mc->SetPlaybackRate(obj->GetPropertyAsFloat(_("playback_rate")));
-				if (!obj->IsNull( _("volume")) && (obj->GetPropertyAsFloat(_("volume"))>=0)&&(obj->GetPropertyAsFloat(_("volume"))<=1))
-						mc->SetPlaybackRate(obj->GetPropertyAsFloat(_("volume")));
-				if (!obj->IsNull(_("player_controls")))
+				if (!obj->IsNull( wxT("playback_rate"))) mc->SetPlaybackRate(obj->GetPropertyAsFloat(wxT("playback_rate")));
+				if (!obj->IsNull( wxT("volume")) && (obj->GetPropertyAsFloat(wxT("volume"))>=0)&&(obj->GetPropertyAsFloat(wxT("volume"))<=1))
+						mc->SetPlaybackRate(obj->GetPropertyAsFloat(wxT("volume")));
+				if (!obj->IsNull(wxT("player_controls")))
 				{
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("STEP") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("VOLUME") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_VOLUME);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("DEFAULT") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_DEFAULT);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("NONE") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_NONE);
+					if(  obj->GetPropertyAsString( wxT("player_controls") ) == wxT("STEP") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
+					if(  obj->GetPropertyAsString( wxT("player_controls") ) == wxT("VOLUME") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_VOLUME);
+					if(  obj->GetPropertyAsString( wxT("player_controls") ) == wxT("DEFAULT") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_DEFAULT);
+					if(  obj->GetPropertyAsString( wxT("player_controls") ) == wxT("NONE") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_NONE);
 
 				}
 
-				if ( !obj->IsNull( _("play") ) && ( obj->GetPropertyAsInteger( _("play") ) == 1 ) ) mc->Play();
+				if ( !obj->IsNull( wxT("play") ) && ( obj->GetPropertyAsInteger( wxT("play") ) == 1 ) ) mc->Play();
 				else
 					mc->Stop();
 
@@ -1564,7 +1564,7 @@ public:
 			}
 		}
 
-		if(!obj->IsNull(_("style"))) mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
+		if(!obj->IsNull(wxT("style"))) mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
 
 		mc->PushEventHandler( new ComponentEvtHandler( mc, GetManager() ) );
 
@@ -1581,13 +1581,13 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxMediaCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxMediaCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMediaCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxMediaCtrl"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -1636,24 +1636,24 @@ public:
 		{
 			wxObject* child = GetManager()->GetChild( wxobject, i );
 			IObject* childObj = GetManager()->GetIObject( child );
-			if (childObj->GetClassName() == _("propGridItem"))
+			if (childObj->GetClassName() == wxT("propGridItem"))
 			{
-				if (childObj->GetPropertyAsString( _("type") ) == _("Category") )
+				if (childObj->GetPropertyAsString( wxT("type") ) == wxT("Category") )
 				{
-					pg->Append( new wxPropertyCategory( childObj->GetPropertyAsString( _("label") ), childObj->GetPropertyAsString( _("label") ) ) );
+					pg->Append( new wxPropertyCategory( childObj->GetPropertyAsString( wxT("label") ), childObj->GetPropertyAsString( wxT("label") ) ) );
 				}
 				else
 				{
-					wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (childObj->GetPropertyAsString( _("type") ) ) + wxT("Property") ), wxPGProperty );
+					wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (childObj->GetPropertyAsString( wxT("type") ) ) + wxT("Property") ), wxPGProperty );
 					if( prop )
 					{
-						prop->SetLabel( childObj->GetPropertyAsString( _("label") ) );
-						prop->SetName( childObj->GetPropertyAsString( _("label") ) );
+						prop->SetLabel( childObj->GetPropertyAsString( wxT("label") ) );
+						prop->SetName( childObj->GetPropertyAsString( wxT("label") ) );
 						pg->Append( prop );
 
-						if( childObj->GetPropertyAsString( _("help") ) != wxEmptyString )
+						if( childObj->GetPropertyAsString( wxT("help") ) != wxEmptyString )
 						{
-							pg->SetPropertyHelpString( prop, childObj->GetPropertyAsString( _("help") ) );
+							pg->SetPropertyHelpString( prop, childObj->GetPropertyAsString( wxT("help") ) );
 						}
 					}
 				}
@@ -1789,31 +1789,31 @@ public:
 		{
 			wxObject* child = GetManager()->GetChild( wxobject, i );
 			IObject* childObj = GetManager()->GetIObject( child );
-			if (childObj->GetClassName() == _("propGridPage"))
+			if (childObj->GetClassName() == wxT("propGridPage"))
 			{
-				wxPropertyGridPage *page = pgm->AddPage( childObj->GetPropertyAsString( _("label") ), childObj->GetPropertyAsBitmap( _("bitmap") ) );
+				wxPropertyGridPage *page = pgm->AddPage( childObj->GetPropertyAsString( wxT("label") ), childObj->GetPropertyAsBitmap( wxT("bitmap") ) );
 
 				for( size_t j = 0; j < childObj->GetChildCount(); ++j )
 				{
 					IObject* innerChildObj = childObj->GetChildPtr( j );
-					if (innerChildObj->GetClassName() == _("propGridItem"))
+					if (innerChildObj->GetClassName() == wxT("propGridItem"))
 					{
-						if (innerChildObj->GetPropertyAsString( _("type") ) == _("Category") )
+						if (innerChildObj->GetPropertyAsString( wxT("type") ) == wxT("Category") )
 						{
-							page->Append( new wxPropertyCategory( innerChildObj->GetPropertyAsString( _("label") ), innerChildObj->GetPropertyAsString( _("label") ) ) );
+							page->Append( new wxPropertyCategory( innerChildObj->GetPropertyAsString( wxT("label") ), innerChildObj->GetPropertyAsString( wxT("label") ) ) );
 						}
 						else
 						{
-							wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (innerChildObj->GetPropertyAsString( _("type") ) ) + wxT("Property") ), wxPGProperty );
+							wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (innerChildObj->GetPropertyAsString( wxT("type") ) ) + wxT("Property") ), wxPGProperty );
 							if( prop )
 							{
-								prop->SetLabel( innerChildObj->GetPropertyAsString( _("label") ) );
-								prop->SetName( innerChildObj->GetPropertyAsString( _("label") ) );
+								prop->SetLabel( innerChildObj->GetPropertyAsString( wxT("label") ) );
+								prop->SetName( innerChildObj->GetPropertyAsString( wxT("label") ) );
 								page->Append( prop );
 
-								if( innerChildObj->GetPropertyAsString( _("help") ) != wxEmptyString )
+								if( innerChildObj->GetPropertyAsString( wxT("help") ) != wxEmptyString )
 								{
-									page->SetPropertyHelpString( prop, innerChildObj->GetPropertyAsString( _("help") ) );
+									page->SetPropertyHelpString( prop, innerChildObj->GetPropertyAsString( wxT("help") ) );
 								}
 							}
 						}
@@ -1839,14 +1839,14 @@ class StyledTextComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxStyledTextCtrl* m_code = new wxStyledTextCtrl( 	(wxWindow *)parent, wxID_ANY,
-												obj->GetPropertyAsPoint(_("pos")),
-												obj->GetPropertyAsSize(_("size")),
-												obj->GetPropertyAsInteger(_("window_style")),
-												obj->GetPropertyAsString(_("name"))
+												obj->GetPropertyAsPoint(wxT("pos")),
+												obj->GetPropertyAsSize(wxT("size")),
+												obj->GetPropertyAsInteger(wxT("window_style")),
+												obj->GetPropertyAsString(wxT("name"))
 											);
 
 		// Line Numbers
-		if ( 0 != obj->GetPropertyAsInteger(_("line_numbers") ) )
+		if ( 0 != obj->GetPropertyAsInteger(wxT("line_numbers") ) )
 		{
 			m_code->SetMarginType( 0, wxSTC_MARGIN_NUMBER );
 			m_code->SetMarginWidth( 0, m_code->TextWidth (wxSTC_STYLE_LINENUMBER, wxT("_99999"))  );
@@ -1874,7 +1874,7 @@ public:
 		m_code->MarkerDefine (wxSTC_MARKNUM_FOLDERTAIL, wxSTC_MARK_EMPTY);
 
 		// folding
-		if ( 0 != obj->GetPropertyAsInteger(_("folding") ) )
+		if ( 0 != obj->GetPropertyAsInteger(wxT("folding") ) )
 		{
 			m_code->SetMarginType (1, wxSTC_MARGIN_SYMBOL);
 			m_code->SetMarginMask (1, wxSTC_MASK_FOLDERS);
@@ -1888,7 +1888,7 @@ public:
 		{
 			m_code->SetMarginWidth( 1, 0 );
 		}
-		m_code->SetIndentationGuides(obj->GetPropertyAsInteger(_("indentation_guides")));
+		m_code->SetIndentationGuides(obj->GetPropertyAsInteger(wxT("indentation_guides")));
 
 		m_code->SetMarginWidth( 2, 0 );
 
@@ -1903,9 +1903,9 @@ public:
 							   while"));
 
 		wxFont font(10, wxFONTFAMILY_MODERN, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL);
-		if ( !obj->GetPropertyAsString(_("font")).empty() )
+		if ( !obj->GetPropertyAsString(wxT("font")).empty() )
 		{
-			font = obj->GetPropertyAsFont(_("font"));
+			font = obj->GetPropertyAsFont(wxT("font"));
 		}
 
 		m_code->StyleSetFont(wxSTC_STYLE_DEFAULT, font );
@@ -1921,15 +1921,15 @@ public:
 		m_code->StyleSetForeground(wxSTC_C_COMMENTDOC, wxColour(0, 128, 0));
 		m_code->StyleSetForeground(wxSTC_C_COMMENTLINEDOC, wxColour(0, 128, 0));
 		m_code->StyleSetForeground(wxSTC_C_NUMBER, *wxBLUE );
-		m_code->SetUseTabs( ( 0 != obj->GetPropertyAsInteger( _("use_tabs") ) ) );
-		m_code->SetTabWidth( obj->GetPropertyAsInteger( _("tab_width") ) );
-		m_code->SetTabIndents( ( 0 != obj->GetPropertyAsInteger( _("tab_indents") ) ) );
-		m_code->SetBackSpaceUnIndents( ( 0 != obj->GetPropertyAsInteger( _("backspace_unindents") ) ) );
-		m_code->SetIndent( obj->GetPropertyAsInteger( _("tab_width") ) );
+		m_code->SetUseTabs( ( 0 != obj->GetPropertyAsInteger( wxT("use_tabs") ) ) );
+		m_code->SetTabWidth( obj->GetPropertyAsInteger( wxT("tab_width") ) );
+		m_code->SetTabIndents( ( 0 != obj->GetPropertyAsInteger( wxT("tab_indents") ) ) );
+		m_code->SetBackSpaceUnIndents( ( 0 != obj->GetPropertyAsInteger( wxT("backspace_unindents") ) ) );
+		m_code->SetIndent( obj->GetPropertyAsInteger( wxT("tab_width") ) );
 		m_code->SetSelBackground(true, wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHT));
 		m_code->SetSelForeground(true, wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHTTEXT));
-		m_code->SetViewEOL( ( 0 != obj->GetPropertyAsInteger( _("view_eol") ) ) );
-		m_code->SetViewWhiteSpace(obj->GetPropertyAsInteger(_("view_whitespace")));
+		m_code->SetViewEOL( ( 0 != obj->GetPropertyAsInteger( wxT("view_eol") ) ) );
+		m_code->SetViewWhiteSpace(obj->GetPropertyAsInteger(wxT("view_whitespace")));
 
 		m_code->SetCaretWidth(2);
 
@@ -2012,9 +2012,9 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxDataViewCtrl* dataViewCtrl = new wxDataViewCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("window_style")));
 
 			wxObjectDataPtr<DataViewModel> model;
 			model = new DataViewModel;
@@ -2035,96 +2035,96 @@ public:
 		{
 			wxObject* child = GetManager()->GetChild( wxobject, i );
 			IObject* childObj = GetManager()->GetIObject( child );
-			if (childObj->GetClassName() == _("dataViewColumn"))
+			if (childObj->GetClassName() == wxT("dataViewColumn"))
 			{
-				if (childObj->GetPropertyAsString( _("type")) == _("Text"))
+				if (childObj->GetPropertyAsString( wxT("type")) == wxT("Text"))
 				{
 					auto* col = list->AppendTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						childObj->GetPropertyAsInteger(wxT("model_column")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Toggle"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("Toggle"))
 				{
 					auto* col = list->AppendToggleColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						childObj->GetPropertyAsInteger(wxT("model_column")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Progress"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("Progress"))
 				{
 					auto* col = list->AppendProgressColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						childObj->GetPropertyAsInteger(wxT("model_column")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("IconText"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("IconText"))
 				{
 					auto* col = list->AppendIconTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						childObj->GetPropertyAsInteger(wxT("model_column")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Date"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("Date"))
 				{
 					auto* col = list->AppendDateColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						childObj->GetPropertyAsInteger(wxT("model_column")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Bitmap"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("Bitmap"))
 				{
 					auto* col = list->AppendBitmapColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						childObj->GetPropertyAsInteger(wxT("model_column")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
 			}
@@ -2140,9 +2140,9 @@ public:
 	{
 		wxDataViewTreeCtrl* dataViewTreeCtrl = new wxDataViewTreeCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("window_style")));
 
 		return dataViewTreeCtrl;
 	}
@@ -2154,9 +2154,9 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxDataViewListCtrl* dataViewListCtrl = new wxDataViewListCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("window_style")));
 
 		return dataViewListCtrl;
 	}
@@ -2174,62 +2174,62 @@ public:
 		{
 			wxObject* child = GetManager()->GetChild( wxobject, i );
 			IObject* childObj = GetManager()->GetIObject( child );
-			if (childObj->GetClassName() == _("dataViewListColumn"))
+			if (childObj->GetClassName() == wxT("dataViewListColumn"))
 			{
-				if (childObj->GetPropertyAsString( _("type")) == _("Text"))
+				if (childObj->GetPropertyAsString( wxT("type")) == wxT("Text"))
 				{
 					auto* col = list->AppendTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Toggle"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("Toggle"))
 				{
 					auto* col = list->AppendToggleColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Progress"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("Progress"))
 				{
 					auto* col = list->AppendProgressColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("IconText"))
+				else if (childObj->GetPropertyAsString( wxT("type")) == wxT("IconText"))
 				{
 					auto* col = list->AppendIconTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsString(wxT("label")),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(wxT("mode"))),
+						childObj->GetPropertyAsInteger(wxT("width")),
+						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(wxT("align"))),
+						childObj->GetPropertyAsInteger(wxT("flags"))
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNull(wxT("ellipsize")))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(wxT("ellipsize"))));
 					}
 				}
 			}
@@ -2248,9 +2248,9 @@ class wxcoreTreeListCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxTreeListCtrl* treeListCtrl = new wxTreeListCtrl( (wxWindow *)parent, wxID_ANY,
-				obj->GetPropertyAsPoint(_("pos")),
-				obj->GetPropertyAsSize(_("size")),
-				obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+				obj->GetPropertyAsPoint(wxT("pos")),
+				obj->GetPropertyAsSize(wxT("size")),
+				obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		return treeListCtrl;
 	}
@@ -2315,10 +2315,10 @@ public:
 			return;
 		}
 
-		treeList->AppendColumn( obj->GetPropertyAsString( _("name") ),
-			obj->GetPropertyAsInteger( _("width") ),
-			static_cast< wxAlignment >( obj->GetPropertyAsInteger( _("alignment") ) ),
-			obj->GetPropertyAsInteger( _("flag") ) );
+		treeList->AppendColumn( obj->GetPropertyAsString( wxT("name") ),
+			obj->GetPropertyAsInteger( wxT("width") ),
+			static_cast< wxAlignment >( obj->GetPropertyAsInteger( wxT("alignment") ) ),
+			obj->GetPropertyAsInteger( wxT("flag") ) );
 	}
 
 	void OnSelected(wxObject*) override {
@@ -2330,15 +2330,15 @@ class RibbonBarComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonBar *rb = new wxRibbonBar((wxWindow*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))  );
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))  );
 
-		if( obj->GetPropertyAsString( _("theme"))  == _("Default"))
+		if( obj->GetPropertyAsString( wxT("theme"))  == wxT("Default"))
 				rb->SetArtProvider( new wxRibbonDefaultArtProvider );
-		else if( obj->GetPropertyAsString( _("theme"))  == _("Generic"))
+		else if( obj->GetPropertyAsString( wxT("theme"))  == wxT("Generic"))
 				rb->SetArtProvider( new wxRibbonAUIArtProvider );
-		else if( obj->GetPropertyAsString( _("theme"))  == _("MSW") )
+		else if( obj->GetPropertyAsString( wxT("theme"))  == wxT("MSW") )
 				rb->SetArtProvider( new wxRibbonMSWArtProvider );
 
 		rb->PushEventHandler( new ComponentEvtHandler( rb, GetManager() ) );
@@ -2389,10 +2389,10 @@ void ComponentEvtHandler::OnRibbonBarPageChanged( wxRibbonBarEvent& event )
 		IObject*  iChild = m_manager->GetIObject( wxChild );
 		if ( iChild )
 		{
-			if (int(i) == selPage && iChild->GetPropertyAsInteger(_("select")) == 0) {
-				m_manager->ModifyProperty( wxChild, _("select"), wxT("1"), false );
-			} else if (int(i) != selPage && iChild->GetPropertyAsInteger(_("select")) != 0) {
-				m_manager->ModifyProperty( wxChild, _("select"), wxT("0"), false );
+			if (int(i) == selPage && iChild->GetPropertyAsInteger(wxT("select")) == 0) {
+				m_manager->ModifyProperty( wxChild, wxT("select"), wxT("1"), false );
+			} else if (int(i) != selPage && iChild->GetPropertyAsInteger(wxT("select")) != 0) {
+				m_manager->ModifyProperty( wxChild, wxT("select"), wxT("0"), false );
 			}
 		}
 	}
@@ -2409,11 +2409,11 @@ class RibbonPageComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonPage *rbpage = new wxRibbonPage((wxRibbonBar*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsBitmap(_("bitmap")),
+			obj->GetPropertyAsString(wxT("label")),
+			obj->GetPropertyAsBitmap(wxT("bitmap")),
 			0);
 
-		if (obj->GetPropertyAsInteger(_("select")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("select")) != 0) {
 			((wxRibbonBar*)parent)->SetActivePage(rbpage);
 		}
 
@@ -2439,11 +2439,11 @@ class RibbonPanelComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonPanel *rbp = new wxRibbonPanel((wxRibbonPage*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))  );
+			obj->GetPropertyAsString(wxT("label")),
+			obj->GetPropertyAsBitmap(wxT("bitmap")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))  );
 
 		//rbp->PushEventHandler( new ComponentEvtHandler( rbp, GetManager() ) );
 
@@ -2467,8 +2467,8 @@ class RibbonButtonBarComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonButtonBar *rbb = new wxRibbonButtonBar((wxRibbonPanel*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			0);
 
 		//rbb->PushEventHandler( new ComponentEvtHandler( rbb, GetManager() ) );
@@ -2503,27 +2503,27 @@ class RibbonButtonBarComponent : public ComponentBase
 			if (childObj->GetClassName() == wxT("ribbonButton"))
 			{
 				rb->AddButton(wxID_ANY,
-							childObj->GetPropertyAsString( _("label") ),
-							childObj->GetPropertyAsBitmap( _("bitmap") ),
-							childObj->GetPropertyAsString( _("help") ) );
+							childObj->GetPropertyAsString( wxT("label") ),
+							childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+							childObj->GetPropertyAsString( wxT("help") ) );
 			} else if (childObj->GetClassName() == wxT("ribbonDropdownButton"))
 			{
 				rb->AddDropdownButton(wxID_ANY,
-									childObj->GetPropertyAsString( _("label") ),
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsString( wxT("label") ),
+									childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+									childObj->GetPropertyAsString( wxT("help") ) );
 			} else if (childObj->GetClassName() == wxT("ribbonHybridButton"))
 			{
 				rb->AddHybridButton(wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsString( wxT("label") ),
+								childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+								childObj->GetPropertyAsString( wxT("help") ) );
 			} else if (childObj->GetClassName() == wxT("ribbonToggleButton"))
 			{
 				rb->AddToggleButton(wxID_ANY,
-									childObj->GetPropertyAsString( _("label") ),
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsString( wxT("label") ),
+									childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+									childObj->GetPropertyAsString( wxT("help") ) );
 			}
 		}
 	}
@@ -2539,8 +2539,8 @@ class RibbonToolBarComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonToolBar *rbb = new wxRibbonToolBar((wxRibbonPanel*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			0 );
 
 		//rbb->PushEventHandler( new ComponentEvtHandler( rbb, GetManager() ) );
@@ -2575,23 +2575,23 @@ class RibbonToolBarComponent : public ComponentBase
 			if (wxT("ribbonTool") == childObj->GetClassName() )
 			{
 				rb->AddTool(wxID_ANY,
-							childObj->GetPropertyAsBitmap( _("bitmap") ),
-							childObj->GetPropertyAsString( _("help") ) );
+							childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+							childObj->GetPropertyAsString( wxT("help") ) );
 			} else if (wxT("ribbonDropdownTool") == childObj->GetClassName() )
 			{
 				rb->AddDropdownTool(wxID_ANY,
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+									childObj->GetPropertyAsString( wxT("help") ) );
 			} else if (wxT("ribbonHybridTool") == childObj->GetClassName() )
 			{
 				rb->AddHybridTool(wxID_ANY,
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+								childObj->GetPropertyAsString( wxT("help") ) );
 			} else if (wxT("ribbonToggleTool") == childObj->GetClassName() )
 			{
 				rb->AddToggleTool(wxID_ANY,
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+								childObj->GetPropertyAsString( wxT("help") ) );
 
 			}
 		}
@@ -2608,8 +2608,8 @@ class RibbonGalleryComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonGallery *ribbonGallery = new wxRibbonGallery((wxRibbonPanel*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			0);
 
 		//ribbonGallery->PushEventHandler( new ComponentEvtHandler( ribbonGallery, GetManager() ) );
@@ -2643,7 +2643,7 @@ class RibbonGalleryComponent : public ComponentBase
 			IObject* childObj = GetManager()->GetIObject( child );
 			if ( wxT("ribbonGalleryItem") == childObj->GetClassName() )
 			{
-				rg->Append(childObj->GetPropertyAsBitmap( _("bitmap") ), wxID_ANY );
+				rg->Append(childObj->GetPropertyAsBitmap( wxT("bitmap") ), wxID_ANY );
 			}
 		}
 	}
@@ -194,55 +194,55 @@ class ButtonComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxString label = obj->GetPropertyAsString( _("label") );
+		wxString label = obj->GetPropertyAsString( wxT("label") );
 		wxButton* button = new wxButton((wxWindow*)parent, wxID_ANY,
 			label,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 #if wxCHECK_VERSION( 2, 9, 2 )
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("markup")) != 0) {
 			button->SetLabelMarkup(label);
 		}
 #endif
 
-		if ( obj->GetPropertyAsInteger( _("default") ) != 0 )
+		if ( obj->GetPropertyAsInteger( wxT("default") ) != 0 )
 		{
 			button->SetDefault();
 		}
 
-		if (obj->GetPropertyAsInteger(_("auth_needed")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("auth_needed")) != 0) {
 			button->SetAuthNeeded();
 		}
 
-		if (!obj->IsNull(_("bitmap"))) {
-			button->SetBitmap(obj->GetPropertyAsBitmap(_("bitmap")));
+		if (!obj->IsNull(wxT("bitmap"))) {
+			button->SetBitmap(obj->GetPropertyAsBitmap(wxT("bitmap")));
 		}
 
-		if (!obj->IsNull(_("disabled"))) {
-			button->SetBitmapDisabled(obj->GetPropertyAsBitmap(_("disabled")));
+		if (!obj->IsNull(wxT("disabled"))) {
+			button->SetBitmapDisabled(obj->GetPropertyAsBitmap(wxT("disabled")));
 		}
 
-		if (!obj->IsNull(_("pressed"))) {
-			button->SetBitmapPressed(obj->GetPropertyAsBitmap(_("pressed")));
+		if (!obj->IsNull(wxT("pressed"))) {
+			button->SetBitmapPressed(obj->GetPropertyAsBitmap(wxT("pressed")));
 		}
 
-		if (!obj->IsNull(_("focus"))) {
-			button->SetBitmapFocus(obj->GetPropertyAsBitmap(_("focus")));
+		if (!obj->IsNull(wxT("focus"))) {
+			button->SetBitmapFocus(obj->GetPropertyAsBitmap(wxT("focus")));
 		}
 
-		if (!obj->IsNull(_("current"))) {
-			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(_("current")));
+		if (!obj->IsNull(wxT("current"))) {
+			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(wxT("current")));
 		}
 
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNull(wxT("position"))) {
 			button->SetBitmapPosition(
-			    static_cast<wxDirection>(obj->GetPropertyAsInteger(_("position"))));
+			    static_cast<wxDirection>(obj->GetPropertyAsInteger(wxT("position"))));
 		}
 
-		if (!obj->IsNull(_("margins"))) {
-			button->SetBitmapMargins(obj->GetPropertyAsSize(_("margins")));
+		if (!obj->IsNull(wxT("margins"))) {
+			button->SetBitmapMargins(obj->GetPropertyAsSize(wxT("margins")));
 		}
 
 		return button;
@@ -250,48 +250,48 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxButton"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
-		xrc.AddProperty(_("auth_needed"), _("auth_needed"), XRC_TYPE_BOOL);
-		xrc.AddProperty(_("markup"), _("markup"), XRC_TYPE_BOOL);
-		xrc.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
-		if (!obj->IsNull(_("disabled"))) {
-			xrc.AddProperty(_("disabled"), _("disabled"), XRC_TYPE_BITMAP);
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("default"),wxT("default"),XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("auth_needed"), wxT("auth_needed"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("markup"), wxT("markup"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("disabled"))) {
+			xrc.AddProperty(wxT("disabled"), wxT("disabled"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("pressed"))) {
-			xrc.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("pressed"))) {
+			xrc.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("focus"))) {
-			xrc.AddProperty(_("focus"), _("focus"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("focus"))) {
+			xrc.AddProperty(wxT("focus"), wxT("focus"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("current"))) {
-			xrc.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("current"))) {
+			xrc.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("position"))) {
-			xrc.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
+		if (!obj->IsNull(wxT("position"))) {
+			xrc.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
 		}
-		if (!obj->IsNull(_("margins"))) {
-			xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
+		if (!obj->IsNull(wxT("margins"))) {
+			xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
 		}
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxButton"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxButton"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
-		filter.AddProperty(_("auth_needed"), _("auth_needed"), XRC_TYPE_BOOL);
-		filter.AddProperty(_("markup"), _("markup"), XRC_TYPE_BOOL);
-		filter.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("disabled"), _("disabled"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("focus"), _("focus"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("default"),wxT("default"),XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("auth_needed"), wxT("auth_needed"), XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("markup"), wxT("markup"), XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("disabled"), wxT("disabled"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("focus"), wxT("focus"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
 		return filter.GetXfbObject();
 	}
 };
@@ -301,52 +301,52 @@ class BitmapButtonComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxBitmapButton* button = new wxBitmapButton((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsBitmap(wxT("bitmap")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 #if wxCHECK_VERSION( 2, 9, 2 )
 		// To stay in sync what the generator templates do apply the markup label here as well
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
-			button->SetLabelMarkup(obj->GetPropertyAsString(_("label")));
+		if (obj->GetPropertyAsInteger(wxT("markup")) != 0) {
+			button->SetLabelMarkup(obj->GetPropertyAsString(wxT("label")));
 		}
 #endif
 
-		if ( obj->GetPropertyAsInteger( _("default") ) != 0 )
+		if ( obj->GetPropertyAsInteger( wxT("default") ) != 0 )
 		{
 			button->SetDefault();
 		}
 
-		if (obj->GetPropertyAsInteger(_("auth_needed")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("auth_needed")) != 0) {
 			button->SetAuthNeeded();
 		}
 
-		if (!obj->IsNull(_("disabled")))
+		if (!obj->IsNull(wxT("disabled")))
 		{
-			button->SetBitmapDisabled( obj->GetPropertyAsBitmap( _("disabled") ) );
+			button->SetBitmapDisabled( obj->GetPropertyAsBitmap( wxT("disabled") ) );
 		}
 
-		if (!obj->IsNull(_("pressed"))) {
-			button->SetBitmapPressed(obj->GetPropertyAsBitmap(_("pressed")));
+		if (!obj->IsNull(wxT("pressed"))) {
+			button->SetBitmapPressed(obj->GetPropertyAsBitmap(wxT("pressed")));
 		}
 
-		if ( !obj->IsNull( _("focus") ) )
+		if ( !obj->IsNull( wxT("focus") ) )
 		{
-			button->SetBitmapFocus( obj->GetPropertyAsBitmap( _("focus") ) );
+			button->SetBitmapFocus( obj->GetPropertyAsBitmap( wxT("focus") ) );
 		}
 
-		if (!obj->IsNull(_("current"))) {
-			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(_("current")));
+		if (!obj->IsNull(wxT("current"))) {
+			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(wxT("current")));
 		}
 
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNull(wxT("position"))) {
 			button->SetBitmapPosition(
-			    static_cast<wxDirection>(obj->GetPropertyAsInteger(_("position"))));
+			    static_cast<wxDirection>(obj->GetPropertyAsInteger(wxT("position"))));
 		}
 
-		if (!obj->IsNull(_("margins"))) {
-			button->SetBitmapMargins(obj->GetPropertyAsSize(_("margins")));
+		if (!obj->IsNull(wxT("margins"))) {
+			button->SetBitmapMargins(obj->GetPropertyAsSize(wxT("margins")));
 		}
 
 		return button;
@@ -354,46 +354,46 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxBitmapButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxBitmapButton"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		if ( !obj->IsNull( _("disabled") ) )
+		xrc.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
+		if ( !obj->IsNull( wxT("disabled") ) )
 		{
-			xrc.AddProperty(_("disabled"),_("disabled"),XRC_TYPE_BITMAP);
+			xrc.AddProperty(wxT("disabled"),wxT("disabled"),XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("pressed"))) {
-			xrc.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("pressed"))) {
+			xrc.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
 		}
-		if ( !obj->IsNull( _("focus") ) )
+		if ( !obj->IsNull( wxT("focus") ) )
 		{
-			xrc.AddProperty(_("focus"),_("focus"),XRC_TYPE_BITMAP);
+			xrc.AddProperty(wxT("focus"),wxT("focus"),XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("current"))) {
-			xrc.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("current"))) {
+			xrc.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("position"))) {
-			xrc.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
+		if (!obj->IsNull(wxT("position"))) {
+			xrc.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
 		}
-		if (!obj->IsNull(_("margins"))) {
-			xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
+		if (!obj->IsNull(wxT("margins"))) {
+			xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
 		}
-		xrc.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
-		xrc.AddProperty(_("auth_needed"), _("auth_needed"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("default"),wxT("default"),XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("auth_needed"), wxT("auth_needed"), XRC_TYPE_BOOL);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxBitmapButton"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxBitmapButton"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		filter.AddProperty(_("disabled"),_("disabled"),XRC_TYPE_BITMAP);
-		filter.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("focus"),_("focus"),XRC_TYPE_BITMAP);
-		filter.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
-		filter.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
-		filter.AddProperty(_("auth_needed"), _("auth_needed"), XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("disabled"),wxT("disabled"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("pressed"), wxT("pressed"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("focus"),wxT("focus"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("current"), wxT("current"), XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("position"), wxT("position"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("default"),wxT("default"),XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("auth_needed"), wxT("auth_needed"), XRC_TYPE_BOOL);
 		return filter.GetXfbObject();
 	}
 };
@@ -404,14 +404,14 @@ class TextCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxTextCtrl* tc = new wxTextCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		if ( !obj->IsNull( _("maxlength") ) )
+		if ( !obj->IsNull( wxT("maxlength") ) )
 		{
-			tc->SetMaxLength( obj->GetPropertyAsInteger( _("maxlength") ) );
+			tc->SetMaxLength( obj->GetPropertyAsInteger( wxT("maxlength") ) );
 		}
 
 		tc->PushEventHandler( new ComponentEvtHandler( tc, GetManager() ) );
@@ -430,19 +430,19 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxTextCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxTextCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		if (!obj->IsNull(_("maxlength")))
-			xrc.AddProperty(_("maxlength"), _("maxlength"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		if (!obj->IsNull(wxT("maxlength")))
+			xrc.AddProperty(wxT("maxlength"), wxT("maxlength"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxTextCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxTextCtrl"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("maxlength"), _("maxlength"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("maxlength"), wxT("maxlength"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 
@@ -453,7 +453,7 @@ void ComponentEvtHandler::OnText( wxCommandEvent& )
 	wxTextCtrl* tc = wxDynamicCast( m_window, wxTextCtrl );
 	if ( tc != NULL )
 	{
-		m_manager->ModifyProperty( m_window, _("value"), tc->GetValue() );
+		m_manager->ModifyProperty( m_window, wxT("value"), tc->GetValue() );
 		tc->SetInsertionPointEnd();
 		tc->SetFocus();
 		return;
@@ -462,7 +462,7 @@ void ComponentEvtHandler::OnText( wxCommandEvent& )
 	wxComboBox* cb = wxDynamicCast( m_window, wxComboBox );
 	if ( cb != NULL )
 	{
-		m_manager->ModifyProperty( m_window, _("value"), cb->GetValue() );
+		m_manager->ModifyProperty( m_window, wxT("value"), cb->GetValue() );
 		cb->SetInsertionPointEnd();
 		cb->SetFocus();
 		return;
@@ -473,17 +473,17 @@ class StaticTextComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxString label = obj->GetPropertyAsString( _("label") );
+		wxString label = obj->GetPropertyAsString( wxT("label") );
 		wxStaticText* st = new wxStaticText((wxWindow *)parent, wxID_ANY,
 			label,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		st->Wrap( obj->GetPropertyAsInteger( _("wrap") ) );
+		st->Wrap( obj->GetPropertyAsInteger( wxT("wrap") ) );
 
 #if wxCHECK_VERSION( 2, 9, 2 )
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("markup")) != 0) {
 			st->SetLabelMarkup(label);
 		}
 #endif
@@ -493,19 +493,19 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		wxString name = obj->GetPropertyAsString(_("name"));
-		ObjectToXrcFilter xrc(obj, _("wxStaticText"), name);
+		wxString name = obj->GetPropertyAsString(wxT("name"));
+		ObjectToXrcFilter xrc(obj, wxT("wxStaticText"), name);
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("wrap"),_("wrap"),XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("wrap"),wxT("wrap"),XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticText"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxStaticText"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("wrap"),_("wrap"),XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("wrap"),wxT("wrap"),XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 };
@@ -515,19 +515,19 @@ class ComboBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxComboBox *combo = new wxComboBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayString(wxT("choices"));
 		for (unsigned int i=0; i<choices.GetCount(); i++)
 			combo->Append(choices[i]);
 
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsInteger(wxT("selection"));
 		if( sel > -1 && sel < (int) choices.GetCount() ) combo->SetSelection(sel);
 
 		combo->PushEventHandler( new ComponentEvtHandler( combo, GetManager() ) );
@@ -546,18 +546,18 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxComboBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxComboBox"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("choices"),_("content"),XRC_TYPE_STRINGLIST);
+		xrc.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("choices"),wxT("content"),XRC_TYPE_STRINGLIST);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxComboBox"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxComboBox"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("content"),_("choices"),XRC_TYPE_STRINGLIST);
+		filter.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("content"),wxT("choices"),XRC_TYPE_STRINGLIST);
 		return filter.GetXfbObject();
 	}
 };
@@ -567,22 +567,22 @@ class BitmapComboBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxBitmapComboBox *bcombo = new wxBitmapComboBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsString(wxT("value")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayString(wxT("choices"));
 		for (unsigned int i=0; i<choices.GetCount(); i++)
 		{
 			wxImage img(choices[i].BeforeFirst(wxChar(58)));
 			bcombo->Append(choices[i].AfterFirst(wxChar(58)), wxBitmap(img));
 		}
 
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsInteger(wxT("selection"));
 		if( sel > -1 && sel < (int) choices.GetCount() ) bcombo->SetSelection(sel);
 
 		bcombo->PushEventHandler( new ComponentEvtHandler( bcombo, GetManager() ) );
@@ -600,18 +600,18 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxBitmapComboBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxBitmapComboBox"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("choices"),_("content"),XRC_TYPE_STRINGLIST);
+		xrc.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("choices"),wxT("content"),XRC_TYPE_STRINGLIST);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxBitmapComboBox"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxBitmapComboBox"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("content"),_("choices"),XRC_TYPE_STRINGLIST);
+		filter.AddProperty(wxT("value"),wxT("value"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("content"),wxT("choices"),XRC_TYPE_STRINGLIST);
 		return filter.GetXfbObject();
 	}
 };
@@ -621,10 +621,10 @@ class CheckBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxCheckBox *res = new wxCheckBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")) | obj->GetPropertyAsInteger(_T("style")));
+			obj->GetPropertyAsString(wxT("label")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("window_style")) | obj->GetPropertyAsInteger(_T("style")));
 		res->SetValue(obj->GetPropertyAsInteger(_T("checked")) != 0);
 
 		res->PushEventHandler( new ComponentEvtHandler( res, GetManager() ) );
@@ -642,18 +642,18 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxCheckBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxCheckBox"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("checked"),_("checked"),XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("checked"),wxT("checked"),XRC_TYPE_BOOL);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxCheckBox"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxCheckBox"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("checked"),_("checked"),XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("checked"),wxT("checked"),XRC_TYPE_BOOL);
 		return filter.GetXfbObject();
 	}
 };
@@ -665,7 +665,7 @@ void ComponentEvtHandler::OnChecked( wxCommandEvent& )
 	{
 		wxString cbValue;
 		cbValue.Printf( wxT("%i"), cb->GetValue() );
-		m_manager->ModifyProperty( m_window, _("checked"), cbValue );
+		m_manager->ModifyProperty( m_window, wxT("checked"), cbValue );
 		cb->SetFocus();
 	}
 }
@@ -675,23 +675,23 @@ class StaticBitmapComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxStaticBitmap((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsBitmap(wxT("bitmap")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("window_style")));
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStaticBitmap"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxStaticBitmap"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty( _("bitmap"), _("bitmap"), XRC_TYPE_BITMAP );
+		xrc.AddProperty( wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP );
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticBitmap"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxStaticBitmap"));
 		filter.AddWindowProperties();
-	filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
+	filter.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
 		return filter.GetXfbObject();
 	}
 };
@@ -705,19 +705,19 @@ class StaticLineComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxStaticLine((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStaticLine"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxStaticLine"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticLine"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxStaticLine"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -728,9 +728,9 @@ class ListCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxListCtrl *lc = new wxListCtrl((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			(obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))) & ~wxLC_VIRTUAL);
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			(obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))) & ~wxLC_VIRTUAL);
 
 
 		// Refilling
@@ -764,13 +764,13 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxListCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxListCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxListCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxListCtrl"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -781,14 +781,14 @@ class ListBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxListBox *listbox = new wxListBox((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayString(wxT("choices"));
 		for (unsigned int i=0; i<choices.Count(); i++)
 			listbox->Append(choices[i]);
 
@@ -797,16 +797,16 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxListBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxListBox"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
+		xrc.AddProperty(wxT("choices"), wxT("content"), XRC_TYPE_STRINGLIST);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxListBox"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxListBox"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("content"),_("choices"), XRC_TYPE_STRINGLIST);
+		filter.AddProperty(wxT("content"),wxT("choices"), XRC_TYPE_STRINGLIST);
 		return filter.GetXfbObject();
 	}
 };
@@ -815,7 +815,7 @@ class RadioBoxComponent : public ComponentBase, public wxEvtHandler
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayString(wxT("choices"));
 		int count = choices.Count();
 		if ( 0 == count )
 		{
@@ -823,7 +823,7 @@ public:
 			count = 1;
 		}
 
-		int majorDim = obj->GetPropertyAsInteger(_("majorDimension"));
+		int majorDim = obj->GetPropertyAsInteger(wxT("majorDimension"));
 		if (majorDim < 1)
 		{
 			wxLogWarning(_("majorDimension must be greater than zero."));
@@ -831,14 +831,14 @@ public:
 		}
 
 		wxRadioBox *radiobox = new wxRadioBox((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsString(wxT("label")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			choices,
 			majorDim,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		int selection = obj->GetPropertyAsInteger( _("selection") );
+		int selection = obj->GetPropertyAsInteger( wxT("selection") );
 		if ( selection < count )
 		{
 			radiobox->SetSelection( selection );
@@ -856,7 +856,7 @@ public:
 		{
 			wxString value;
 			value.Printf( wxT("%i"), window->GetSelection() );
-			GetManager()->ModifyProperty( window, _("selection"), value );
+			GetManager()->ModifyProperty( window, wxT("selection"), value );
 			window->SetFocus();
 
 			GetManager()->SelectObject( window );
@@ -873,22 +873,22 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxRadioBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxRadioBox"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER );
-		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
-		xrc.AddProperty(_("majorDimension"), _("dimension"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("label"), wxT("label"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("selection"), wxT("selection"), XRC_TYPE_INTEGER );
+		xrc.AddProperty(wxT("choices"), wxT("content"), XRC_TYPE_STRINGLIST);
+		xrc.AddProperty(wxT("majorDimension"), wxT("dimension"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxRadioBox"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxRadioBox"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER );
-		filter.AddProperty(_("content"),_("choices"), XRC_TYPE_STRINGLIST);
-		filter.AddProperty(_("dimension"), _("majorDimension"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("selection"), wxT("selection"), XRC_TYPE_INTEGER );
+		filter.AddProperty(wxT("content"),wxT("choices"), XRC_TYPE_STRINGLIST);
+		filter.AddProperty(wxT("dimension"), wxT("majorDimension"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 };
@@ -898,28 +898,28 @@ class RadioButtonComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRadioButton *rb = new wxRadioButton((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsString(wxT("label")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		rb->SetValue( ( obj->GetPropertyAsInteger(_("value")) != 0 ) );
+		rb->SetValue( ( obj->GetPropertyAsInteger(wxT("value")) != 0 ) );
 		return rb;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxRadioButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxRadioButton"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("value"),_("value"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("label"),wxT("label"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("value"),wxT("value"), XRC_TYPE_BOOL);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxRadioButton"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxRadioButton"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("value"),_("value"), XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("label"),wxT("label"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("value"),wxT("value"), XRC_TYPE_BOOL);
 		return filter.GetXfbObject();
 	}
 };
@@ -929,8 +929,8 @@ class StatusBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxStatusBar *sb = new wxIndependentStatusBar((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-		sb->SetFieldsCount(obj->GetPropertyAsInteger(_("fields")));
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
+		sb->SetFieldsCount(obj->GetPropertyAsInteger(wxT("fields")));
 
 		#ifndef __WXMSW__
 		sb->PushEventHandler( new wxLeftDownRedirect( sb, GetManager() ) );
@@ -950,16 +950,16 @@ public:
 	#endif
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStatusBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxStatusBar"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("fields"),_("fields"),XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("fields"),wxT("fields"),XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStatusBar"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxStatusBar"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("fields"),_("fields"),XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("fields"),wxT("fields"),XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 };
@@ -968,18 +968,18 @@ class MenuBarComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
-		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsInteger(_("style")) |
-			obj->GetPropertyAsInteger(_("window_style")));
+		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsInteger(wxT("style")) |
+			obj->GetPropertyAsInteger(wxT("window_style")));
 		return mb;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxMenuBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxMenuBar"), obj->GetPropertyAsString(wxT("name")));
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMenuBar"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxMenuBar"));
 		return filter.GetXfbObject();
 	}
 };
@@ -988,14 +988,14 @@ class MenuComponent : public ComponentBase
 {
 public:
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsString(_("name")));
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+		ObjectToXrcFilter xrc(obj, wxT("wxMenu"), obj->GetPropertyAsString(wxT("name")));
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMenu"));
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+		XrcToXfbFilter filter(xrcObj, wxT("wxMenu"));
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 };
@@ -1004,14 +1004,14 @@ class SubMenuComponent : public ComponentBase
 {
  public:
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-	ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsString(_("name")));
-	xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+	ObjectToXrcFilter xrc(obj, wxT("wxMenu"), obj->GetPropertyAsString(wxT("name")));
+	xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 	return xrc.GetXrcObject();
   }
 
   ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-	XrcToXfbFilter filter(xrcObj, _("submenu"));
-	filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+	XrcToXfbFilter filter(xrcObj, wxT("submenu"));
+	filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 	return filter.GetXfbObject();
   }
 };
@@ -1022,40 +1022,40 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxMenuItem"), obj->GetPropertyAsString(_("name")));
-		wxString shortcut = obj->GetPropertyAsString(_("shortcut"));
+		ObjectToXrcFilter xrc(obj, wxT("wxMenuItem"), obj->GetPropertyAsString(wxT("name")));
+		wxString shortcut = obj->GetPropertyAsString(wxT("shortcut"));
 		wxString label;
 		if (shortcut.IsEmpty())
-			label = obj->GetPropertyAsString(_("label"));
+			label = obj->GetPropertyAsString(wxT("label"));
 		else
-			label = obj->GetPropertyAsString(_("label")) + wxT("\t") + shortcut;
+			label = obj->GetPropertyAsString(wxT("label")) + wxT("\t") + shortcut;
 
-		xrc.AddPropertyValue(_("label"), label, true);
-		xrc.AddProperty(_("help"),_("help"),XRC_TYPE_TEXT);
+		xrc.AddPropertyValue(wxT("label"), label, true);
+		xrc.AddProperty(wxT("help"),wxT("help"),XRC_TYPE_TEXT);
 
-		if (!obj->IsNull(_("bitmap")))
-		  xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
+		if (!obj->IsNull(wxT("bitmap")))
+		  xrc.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
 
-		int kind = obj->GetPropertyAsInteger(_("kind"));
+		int kind = obj->GetPropertyAsInteger(wxT("kind"));
 
-		if (obj->GetPropertyAsInteger(_("checked")) != 0 &&
+		if (obj->GetPropertyAsInteger(wxT("checked")) != 0 &&
 		    (kind == wxITEM_RADIO || kind == wxITEM_CHECK)) {
-			xrc.AddProperty(_("checked"), _("checked"), XRC_TYPE_BOOL);
+			xrc.AddProperty(wxT("checked"), wxT("checked"), XRC_TYPE_BOOL);
 		}
-		if (obj->GetPropertyAsInteger(_("enabled")) == 0)
-			xrc.AddProperty(_("enabled"), _("enabled"), XRC_TYPE_BOOL);
+		if (obj->GetPropertyAsInteger(wxT("enabled")) == 0)
+			xrc.AddProperty(wxT("enabled"), wxT("enabled"), XRC_TYPE_BOOL);
 
 		switch (kind)
 		{
-		case wxITEM_CHECK: xrc.AddPropertyValue(_("checkable"), _("1")); break;
-		case wxITEM_RADIO: xrc.AddPropertyValue(_("radio"), _("1")); break;
+		case wxITEM_CHECK: xrc.AddPropertyValue(wxT("checkable"), _("1")); break;
+		case wxITEM_RADIO: xrc.AddPropertyValue(wxT("radio"), _("1")); break;
 		}
 
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMenuItem"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxMenuItem"));
 
 		try
 		{
@@ -1070,15 +1070,15 @@ public:
 				label = label.Left( pos );
 			}
 
-			filter.AddPropertyValue( _("label"), label, true );
-			filter.AddPropertyValue( _("shortcut"), shortcut );
+			filter.AddPropertyValue( wxT("label"), label, true );
+			filter.AddPropertyValue( wxT("shortcut"), shortcut );
 		}
 		catch( ticpp::Exception& )
 		{
 		}
 
-		filter.AddProperty(_("help"),_("help"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("help"),wxT("help"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
 		return filter.GetXfbObject();
 	}
 };
@@ -1087,12 +1087,12 @@ class SeparatorComponent : public ComponentBase
 {
 public:
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("separator"));
+		ObjectToXrcFilter xrc(obj, wxT("separator"));
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("separator"));
+		XrcToXfbFilter filter(xrcObj, wxT("separator"));
 		return filter.GetXfbObject();
 	}
 };
@@ -1102,21 +1102,21 @@ class ToolBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxToolBar *tb = new wxToolBar((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(_("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(_("bitmapsize")));
-		if (!obj->IsNull(_("margins")))
+		if (!obj->IsNull(wxT("bitmapsize")))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSize(wxT("bitmapsize")));
+		if (!obj->IsNull(wxT("margins")))
 		{
-			wxSize margins(obj->GetPropertyAsSize(_("margins")));
+			wxSize margins(obj->GetPropertyAsSize(wxT("margins")));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(_("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(_("packing")));
-		if (!obj->IsNull(_("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(_("separation")));
+		if (!obj->IsNull(wxT("packing")))
+			tb->SetToolPacking(obj->GetPropertyAsInteger(wxT("packing")));
+		if (!obj->IsNull(wxT("separation")))
+			tb->SetToolSeparation(obj->GetPropertyAsInteger(wxT("separation")));
 
 		tb->PushEventHandler( new ComponentEvtHandler( tb, GetManager() ) );
 
@@ -1148,11 +1148,11 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
+								childObj->GetPropertyAsString( wxT("label") ),
+								childObj->GetPropertyAsBitmap( wxT("bitmap") ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( _("kind") ),
-								childObj->GetPropertyAsString( _("help") ),
+								(wxItemKind)childObj->GetPropertyAsInteger( wxT("kind") ),
+								childObj->GetPropertyAsString( wxT("help") ),
 								wxEmptyString,
 								child
 							);
@@ -1175,22 +1175,22 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxToolBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxToolBar"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("packing"), _("packing"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("separation"), _("separation"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("bitmapsize"), wxT("bitmapsize"), XRC_TYPE_SIZE);
+		xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
+		xrc.AddProperty(wxT("packing"), wxT("packing"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("separation"), wxT("separation"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxToolBar"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxToolBar"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("packing"), _("packing"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("separation"), _("separation"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("bitmapsize"), wxT("bitmapsize"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("packing"), wxT("packing"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("separation"), wxT("separation"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 };
@@ -1327,21 +1327,21 @@ class AuiToolBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		AuiToolBar *tb = new AuiToolBar((wxWindow*)parent, GetManager(), wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) );// | obj->GetPropertyAsInteger(_("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) );// | obj->GetPropertyAsInteger(wxT("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(_("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(_("bitmapsize")));
-		if (!obj->IsNull(_("margins")))
+		if (!obj->IsNull(wxT("bitmapsize")))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSize(wxT("bitmapsize")));
+		if (!obj->IsNull(wxT("margins")))
 		{
-			wxSize margins(obj->GetPropertyAsSize(_("margins")));
+			wxSize margins(obj->GetPropertyAsSize(wxT("margins")));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(_("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(_("packing")));
-		if (!obj->IsNull(_("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(_("separation")));
+		if (!obj->IsNull(wxT("packing")))
+			tb->SetToolPacking(obj->GetPropertyAsInteger(wxT("packing")));
+		if (!obj->IsNull(wxT("separation")))
+			tb->SetToolSeparation(obj->GetPropertyAsInteger(wxT("separation")));
 
 		return tb;
 	}
@@ -1361,11 +1361,11 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
+								childObj->GetPropertyAsString( wxT("label") ),
+								childObj->GetPropertyAsBitmap( wxT("bitmap") ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( _("kind") ),
-								childObj->GetPropertyAsString( _("help") ),
+								(wxItemKind)childObj->GetPropertyAsInteger( wxT("kind") ),
+								childObj->GetPropertyAsString( wxT("help") ),
 								wxEmptyString,
 								child
 							);
@@ -1373,9 +1373,9 @@ public:
 				wxASSERT(itm);
 				itm->SetUserData(i);
 				tb->SetObject(i, child);
-				if ( childObj->GetPropertyAsInteger(_("context_menu") ) == 1 && !itm->HasDropDown() )
+				if ( childObj->GetPropertyAsInteger(wxT("context_menu") ) == 1 && !itm->HasDropDown() )
 					tb->SetToolDropDown( itm->GetId(), true );
-				else if ( childObj->GetPropertyAsInteger(_("context_menu") ) == 0 && itm->HasDropDown() )
+				else if ( childObj->GetPropertyAsInteger(wxT("context_menu") ) == 0 && itm->HasDropDown() )
 					tb->SetToolDropDown( itm->GetId(), false );
 			}
 			else if ( wxT("toolSeparator") == childObj->GetClassName() )
@@ -1396,23 +1396,23 @@ public:
 /*
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxAuiToolBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxAuiToolBar"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("packing"), _("packing"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("separation"), _("separation"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("bitmapsize"), wxT("bitmapsize"), XRC_TYPE_SIZE);
+		xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
+		xrc.AddProperty(wxT("packing"), wxT("packing"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("separation"), wxT("separation"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj )
 	{
-		XrcToXfbFilter filter(xrcObj, _("wxAuiToolBar"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxAuiToolBar"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("packing"), _("packing"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("separation"), _("separation"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("bitmapsize"), wxT("bitmapsize"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("packing"), wxT("packing"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("separation"), wxT("separation"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 */
@@ -1442,13 +1442,13 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("tool"), obj->GetPropertyAsString(_("name")));
-		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("tooltip"), _("tooltip"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("statusbar"), _("longhelp"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
+		ObjectToXrcFilter xrc(obj, wxT("tool"), obj->GetPropertyAsString(wxT("name")));
+		xrc.AddProperty(wxT("label"), wxT("label"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("tooltip"), wxT("tooltip"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("statusbar"), wxT("longhelp"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP);
 
-		wxItemKind kind = (wxItemKind)obj->GetPropertyAsInteger(_("kind"));
+		wxItemKind kind = (wxItemKind)obj->GetPropertyAsInteger(wxT("kind"));
 		if ( wxITEM_CHECK == kind )
 		{
 			xrc.AddPropertyValue( wxT("toggle"), wxT("1") );
@@ -1461,11 +1461,11 @@ public:
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("tool"));
-		filter.AddProperty(_("longhelp"), _("statusbar"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("tooltip"), _("tooltip"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
+		XrcToXfbFilter filter(xrcObj, wxT("tool"));
+		filter.AddProperty(wxT("longhelp"), wxT("statusbar"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("tooltip"), wxT("tooltip"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("label"), wxT("label"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP);
 		bool gotToggle = false;
 		bool gotRadio = false;
 		ticpp::Element* toggle = xrcObj->FirstChildElement( "toggle", false );
@@ -1474,7 +1474,7 @@ public:
 			toggle->GetTextOrDefault( &gotToggle, false );
 			if ( gotToggle )
 			{
-				filter.AddPropertyValue( _("kind"), wxT("wxITEM_CHECK") );
+				filter.AddPropertyValue( wxT("kind"), wxT("wxITEM_CHECK") );
 			}
 		}
 		if ( !gotToggle )
@@ -1485,13 +1485,13 @@ public:
 				radio->GetTextOrDefault( &gotRadio, false );
 				if ( gotRadio )
 				{
-					filter.AddPropertyValue( _("kind"), wxT("wxITEM_RADIO") );
+					filter.AddPropertyValue( wxT("kind"), wxT("wxITEM_RADIO") );
 				}
 			}
 		}
 		if ( !(gotToggle || gotRadio) )
 		{
-			filter.AddPropertyValue( _("kind"), wxT("wxITEM_NORMAL") );
+			filter.AddPropertyValue( wxT("kind"), wxT("wxITEM_NORMAL") );
 		}
 
 		return filter.GetXfbObject();
@@ -1502,12 +1502,12 @@ class ToolSeparatorComponent : public ComponentBase
 {
 public:
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc( obj, _("separator") );
+		ObjectToXrcFilter xrc( obj, wxT("separator") );
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter( xrcObj, _("toolSeparator") );
+		XrcToXfbFilter filter( xrcObj, wxT("toolSeparator") );
 		return filter.GetXfbObject();
 	}
 };
@@ -1516,19 +1516,19 @@ class ChoiceComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayString(wxT("choices"));
 		wxString *strings = new wxString[choices.GetCount()];
 		for (unsigned int i=0; i < choices.GetCount(); i++)
 			strings[i] = choices[i];
 
 		wxChoice *choice = new wxChoice((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
 			(int)choices.Count(),
 			strings,
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsInteger(wxT("window_style")));
 
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsInteger(wxT("selection"));
 		if( sel < (int) choices.GetCount() ) choice->SetSelection(sel);
 
 		delete []strings;
@@ -1548,18 +1548,18 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxChoice"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxChoice"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
+		xrc.AddProperty(wxT("selection"), wxT("selection"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("choices"), wxT("content"), XRC_TYPE_STRINGLIST);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxChoice"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxChoice"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("content"),_("choices"), XRC_TYPE_STRINGLIST);
+		filter.AddProperty(wxT("selection"), wxT("selection"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("content"),wxT("choices"), XRC_TYPE_STRINGLIST);
 		return filter.GetXfbObject();
 	}
 
@@ -1572,7 +1572,7 @@ void ComponentEvtHandler::OnChoice( wxCommandEvent& )
 	{
 		wxString value;
 		value.Printf( wxT("%i"), window->GetSelection() );
-		m_manager->ModifyProperty( m_window, _("selection"), value );
+		m_manager->ModifyProperty( m_window, wxT("selection"), value );
 		window->SetFocus();
 	}
 }
@@ -1584,7 +1584,7 @@ void ComponentEvtHandler::OnComboBox( wxCommandEvent& )
 	{
 		wxString value;
 		value.Printf( wxT("%i"), window->GetSelection() );
-		m_manager->ModifyProperty( m_window, _("selection"), value );
+		m_manager->ModifyProperty( m_window, wxT("selection"), value );
 		window->SetFocus();
 	}
 }
@@ -1594,29 +1594,29 @@ class SliderComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxSlider((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsInteger(_("value")),
-			obj->GetPropertyAsInteger(_("minValue")),
-			obj->GetPropertyAsInteger(_("maxValue")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsInteger(wxT("value")),
+			obj->GetPropertyAsInteger(wxT("minValue")),
+			obj->GetPropertyAsInteger(wxT("maxValue")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSlider"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxSlider"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
-		xrc.AddProperty( _("minValue"), _("min"), XRC_TYPE_INTEGER);
-		xrc.AddProperty( _("maxValue"), _("max"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_INTEGER);
+		xrc.AddProperty( wxT("minValue"), wxT("min"), XRC_TYPE_INTEGER);
+		xrc.AddProperty( wxT("maxValue"), wxT("max"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSlider"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxSlider"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("min"), _("minValue"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("max"), _("maxValue"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("min"), wxT("minValue"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("max"), wxT("maxValue"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 
@@ -1627,27 +1627,27 @@ class GaugeComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxGauge *gauge = new wxGauge((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsInteger(_("range")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-		gauge->SetValue(obj->GetPropertyAsInteger(_("value")));
+			obj->GetPropertyAsInteger(wxT("range")),
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
+		gauge->SetValue(obj->GetPropertyAsInteger(wxT("value")));
 		return gauge;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGauge"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxGauge"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("range"), wxT("range"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGauge"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxGauge"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("range"), wxT("range"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("value"), wxT("value"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 
@@ -1659,23 +1659,23 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxAnimationCtrl* ac = new wxAnimationCtrl((wxWindow *)parent, wxID_ANY,
 			wxNullAnimation,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		if ( !obj->IsNull( _("animation") ) )
+		if ( !obj->IsNull( wxT("animation") ) )
 		{
-			if( ac->LoadFile( obj->GetPropertyAsString( _("animation") ) ) )
+			if( ac->LoadFile( obj->GetPropertyAsString( wxT("animation") ) ) )
 			{
-				if ( !obj->IsNull( _("play") ) && ( obj->GetPropertyAsInteger( _("play") ) == 1 ) ) ac->Play();
+				if ( !obj->IsNull( wxT("play") ) && ( obj->GetPropertyAsInteger( wxT("play") ) == 1 ) ) ac->Play();
 				else
 					ac->Stop();
 			}
 		}
 
-		if ( !obj->IsNull( _("inactive_bitmap") ) )
+		if ( !obj->IsNull( wxT("inactive_bitmap") ) )
 		{
-			wxBitmap bmp = obj->GetPropertyAsBitmap( _("inactive_bitmap") );
+			wxBitmap bmp = obj->GetPropertyAsBitmap( wxT("inactive_bitmap") );
 			if( bmp.IsOk() ) ac->SetInactiveBitmap( bmp );
 			else
 				ac->SetInactiveBitmap( wxNullBitmap );
@@ -1696,16 +1696,16 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxAnimationCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxAnimationCtrl"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("animation"),_("animation"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("animation"),wxT("animation"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxAnimationCtrl"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxAnimationCtrl"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("animation"),_("animation"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("animation"),wxT("animation"),XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 };
@@ -1717,9 +1717,9 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxInfoBar* ib = new wxInfoBar((wxWindow *)parent);
 
-		ib->SetShowHideEffects( (wxShowEffect)obj->GetPropertyAsInteger(_("show_effect")),
-								(wxShowEffect)obj->GetPropertyAsInteger(_("hide_effect")) );
-		ib->SetEffectDuration( obj->GetPropertyAsInteger(_("duration")) );
+		ib->SetShowHideEffects( (wxShowEffect)obj->GetPropertyAsInteger(wxT("show_effect")),
+								(wxShowEffect)obj->GetPropertyAsInteger(wxT("hide_effect")) );
+		ib->SetEffectDuration( obj->GetPropertyAsInteger(wxT("duration")) );
 		ib->ShowMessage( wxT("Message ..."), wxICON_INFORMATION );
 
 		ib->PushEventHandler( new ComponentEvtHandler( ib, GetManager() ) );
@@ -1738,9 +1738,9 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj) override
 	{
-		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("unknown"), obj->GetPropertyAsString(wxT("name")));
 
-		/*ObjectToXrcFilter xrc(obj, _("wxInfoBar"), obj->GetPropertyAsString(_("name")));
+		/*ObjectToXrcFilter xrc(obj, wxT("wxInfoBar"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();*/
 
 		return xrc.GetXrcObject();
@@ -1748,7 +1748,7 @@ public:
 
 	/*ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj )
 	{
-		XrcToXfbFilter filter(xrcObj, _("wxInfoBar"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxInfoBar"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}*/
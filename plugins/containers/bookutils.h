@@ -67,9 +67,9 @@ namespace BookUtils
 	template < class T >
 		void AddImageList( IObject* obj, T* book )
 	{
-		if ( !obj->GetPropertyAsString( _("bitmapsize") ).empty() )
+		if ( !obj->GetPropertyAsString( wxT("bitmapsize") ).empty() )
 		{
-			wxSize imageSize = obj->GetPropertyAsSize(_("bitmapsize"));
+			wxSize imageSize = obj->GetPropertyAsSize(wxT("bitmapsize"));
 			wxImageList* images = new wxImageList( imageSize.GetWidth(), imageSize.GetHeight() );
 			wxImage image = wxBitmap( default_xpm ).ConvertToImage();
 			images->Add( image.Scale( imageSize.GetWidth(), imageSize.GetHeight() ) );
@@ -106,9 +106,15 @@ namespace BookUtils
 		// Prevent event handling by wxFB - these aren't user generated events
 		SuppressEventHandlers suppress( book );
 
+		// Every page goes through here, so the names are resolved only once
+		static const PropertyAtom labelAtom = obj->GetPropertyAtom( wxT("label") );
+		static const PropertyAtom bitmapAtom = obj->GetPropertyAtom( wxT("bitmap") );
+		static const PropertyAtom bitmapsizeAtom = obj->GetPropertyAtom( wxT("bitmapsize") );
+		static const PropertyAtom selectAtom = obj->GetPropertyAtom( wxT("select") );
+
 		// Save selection
 		int selection = book->GetSelection();
-		book->AddPage( page, obj->GetPropertyAsString( _("label") ) );
+		book->AddPage( page, obj->GetPropertyAsStringByAtom( labelAtom ) );
 
 		// Apply image to page
 		IObject* parentObj = manager->GetIObject( wxparent );
@@ -118,11 +124,11 @@ namespace BookUtils
 			return;
 		}
 
-		if ( !parentObj->GetPropertyAsString( _("bitmapsize") ).empty() )
+		if ( !parentObj->GetPropertyAsStringByAtom( bitmapsizeAtom ).empty() )
 		{
-			if ( !obj->GetPropertyAsString( _("bitmap") ).empty() )
+			if ( !obj->GetPropertyAsStringByAtom( bitmapAtom ).empty() )
 			{
-				wxSize imageSize = parentObj->GetPropertyAsSize( _("bitmapsize") );
+				wxSize imageSize = parentObj->GetPropertyAsSizeByAtom( bitmapsizeAtom );
 				int width = imageSize.GetWidth();
 				int height = imageSize.GetHeight();
 				if ( width > 0 && height > 0 )
@@ -130,7 +136,7 @@ namespace BookUtils
 					wxImageList* imageList = book->GetImageList();
 					if ( imageList != NULL )
 					{
-						wxImage image = obj->GetPropertyAsBitmap( _("bitmap") ).ConvertToImage();
+						wxImage image = obj->GetPropertyAsBitmapByAtom( bitmapAtom ).ConvertToImage();
 						imageList->Add( image.Scale( width, height ) );
 						book->SetPageImage( book->GetPageCount() - 1, imageList->GetImageCount() - 1 );
 					}
@@ -138,7 +144,7 @@ namespace BookUtils
 			}
 		}
 
-		if ( obj->GetPropertyAsString( _("select") ) == wxT("0") && selection >= 0 )
+		if ( obj->GetPropertyAsStringByAtom( selectAtom ) == wxT("0") && selection >= 0 )
 		{
 			book->SetSelection(selection);
 		}
@@ -82,13 +82,13 @@ protected:
 			IObject*  iChild = m_manager->GetIObject( wxChild );
 			if ( iChild )
 			{
-				if ( (int)i == selPage && !iChild->GetPropertyAsInteger( _("select") ) )
+				if ( (int)i == selPage && !iChild->GetPropertyAsInteger( wxT("select") ) )
 				{
-					m_manager->ModifyProperty( wxChild, _("select"), wxT("1"), false );
+					m_manager->ModifyProperty( wxChild, wxT("select"), wxT("1"), false );
 				}
-				else if ( (int)i != selPage && iChild->GetPropertyAsInteger( _("select") ) )
+				else if ( (int)i != selPage && iChild->GetPropertyAsInteger( wxT("select") ) )
 				{
-					m_manager->ModifyProperty( wxChild, _("select"), wxT("0"), false );
+					m_manager->ModifyProperty( wxChild, wxT("select"), wxT("0"), false );
 				}
 			}
 		}
@@ -208,20 +208,20 @@ class PanelComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxPanel* panel = new wxPanel((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 		return panel;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxPanel"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxPanel"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxPanel"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxPanel"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -234,12 +234,12 @@ class CollapsiblePaneComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxCollapsiblePane* collpane = new wxCollapsiblePane( (wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString( _("label") ),
-			obj->GetPropertyAsPoint( _("pos") ),
-			obj->GetPropertyAsSize( _("size") ),
-			obj->GetPropertyAsInteger( _("style") ) | obj->GetPropertyAsInteger( _("window_style") ) );
+			obj->GetPropertyAsString( wxT("label") ),
+			obj->GetPropertyAsPoint( wxT("pos") ),
+			obj->GetPropertyAsSize( wxT("size") ),
+			obj->GetPropertyAsInteger( wxT("style") ) | obj->GetPropertyAsInteger( wxT("window_style") ) );
 
-		collpane->Collapse(obj->GetPropertyAsInteger(_("collapsed")) != 0);
+		collpane->Collapse(obj->GetPropertyAsInteger(wxT("collapsed")) != 0);
 
 		collpane->PushEventHandler( new ComponentEvtHandler( collpane, GetManager() ) );
 
@@ -256,18 +256,18 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc( obj, _("wxCollapsiblePane"), obj->GetPropertyAsString( _("name") ) );
+		ObjectToXrcFilter xrc( obj, wxT("wxCollapsiblePane"), obj->GetPropertyAsString( wxT("name") ) );
 		xrc.AddWindowProperties();
-		xrc.AddProperty( _("label"), _("label"), XRC_TYPE_TEXT );
-		xrc.AddProperty( _("collapsed"), _("collapsed"), XRC_TYPE_BOOL );
+		xrc.AddProperty( wxT("label"), wxT("label"), XRC_TYPE_TEXT );
+		xrc.AddProperty( wxT("collapsed"), wxT("collapsed"), XRC_TYPE_BOOL );
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter( xrcObj, _("wxCollapsiblePane") );
+		XrcToXfbFilter filter( xrcObj, wxT("wxCollapsiblePane") );
 		filter.AddWindowProperties();
-		filter.AddProperty( _("label"), _("label"), XRC_TYPE_TEXT );
-		filter.AddProperty( _("collapsed"), _("collapsed"), XRC_TYPE_BOOL );
+		filter.AddProperty( wxT("label"), wxT("label"), XRC_TYPE_TEXT );
+		filter.AddProperty( wxT("collapsed"), wxT("collapsed"), XRC_TYPE_BOOL );
 		return filter.GetXfbObject();
 	}
 
@@ -279,7 +279,7 @@ void ComponentEvtHandler::OnCollapsiblePaneChanged( wxCollapsiblePaneEvent& even
 	if ( collpane != NULL )
 	{
 		wxString s = ( event.GetCollapsed() ) ? wxT("1") : wxT("0");
-		m_manager->ModifyProperty( collpane, _("collapsed"), s );
+		m_manager->ModifyProperty( collpane, wxT("collapsed"), s );
 		collpane->SetFocus();
 	}
 
@@ -292,20 +292,20 @@ class SplitterWindowComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxCustomSplitterWindow *splitter =
 			new wxCustomSplitterWindow((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			(obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))) & ~wxSP_PERMIT_UNSPLIT );
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			(obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style"))) & ~wxSP_PERMIT_UNSPLIT );
 
-		if ( !obj->IsNull( _("sashgravity") ) )
+		if ( !obj->IsNull( wxT("sashgravity") ) )
 		{
-			float gravity = obj->GetPropertyAsFloat( _("sashgravity") );
+			float gravity = obj->GetPropertyAsFloat( wxT("sashgravity") );
 			gravity = ( gravity < 0.0 ? 0.0 : gravity );
 			gravity = ( gravity > 1.0 ? 1.0 : gravity );
 			splitter->SetSashGravity( gravity );
 		}
-		if ( !obj->IsNull( _("min_pane_size") ) )
+		if ( !obj->IsNull( wxT("min_pane_size") ) )
 		{
-			int minPaneSize = obj->GetPropertyAsInteger( _("min_pane_size") );
+			int minPaneSize = obj->GetPropertyAsInteger( wxT("min_pane_size") );
 			splitter->m_customMinPaneSize = minPaneSize;
 			minPaneSize = ( minPaneSize < 1 ? 1 : minPaneSize );
 			splitter->SetMinimumPaneSize( minPaneSize );
@@ -315,7 +315,7 @@ class SplitterWindowComponent : public ComponentBase
 		splitter->Initialize( new wxPanel( splitter ) );
 
 		// Used to ensure sash position is correct
-		splitter->m_initialSashPos = obj->GetPropertyAsInteger( _("sashpos") );
+		splitter->m_initialSashPos = obj->GetPropertyAsInteger( wxT("sashpos") );
 		splitter->Connect( wxEVT_IDLE, wxIdleEventHandler( wxCustomSplitterWindow::OnIdle ) );
 
 		return splitter;
@@ -337,25 +337,25 @@ class SplitterWindowComponent : public ComponentBase
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSplitterWindow"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxSplitterWindow"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
-		xrc.AddProperty(_("sashpos"),_("sashpos"),XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("sashgravity"),_("gravity"),XRC_TYPE_FLOAT);
-		xrc.AddProperty(_("min_pane_size"),_("minsize"),XRC_TYPE_INTEGER);
-		if (obj->GetPropertyAsString(_("splitmode")) == wxT("wxSPLIT_VERTICAL"))
-			xrc.AddPropertyValue(_("orientation"),wxT("vertical"));
+		xrc.AddProperty(wxT("sashpos"),wxT("sashpos"),XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("sashgravity"),wxT("gravity"),XRC_TYPE_FLOAT);
+		xrc.AddProperty(wxT("min_pane_size"),wxT("minsize"),XRC_TYPE_INTEGER);
+		if (obj->GetPropertyAsString(wxT("splitmode")) == wxT("wxSPLIT_VERTICAL"))
+			xrc.AddPropertyValue(wxT("orientation"),wxT("vertical"));
 		else
-			xrc.AddPropertyValue(_("orientation"),wxT("horizontal"));
+			xrc.AddPropertyValue(wxT("orientation"),wxT("horizontal"));
 
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSplitterWindow"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxSplitterWindow"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("sashpos"),_("sashpos"),XRC_TYPE_INTEGER);
-		filter.AddProperty(_("gravity"),_("sashgravity"),XRC_TYPE_FLOAT);
-		filter.AddProperty(_("minsize"),_("min_pane_size"),XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("sashpos"),wxT("sashpos"),XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("gravity"),wxT("sashgravity"),XRC_TYPE_FLOAT);
+		filter.AddProperty(wxT("minsize"),wxT("min_pane_size"),XRC_TYPE_INTEGER);
 		try
 		{
 			ticpp::Element *splitmode = xrcObj->FirstChildElement("orientation");
@@ -434,8 +434,8 @@ class SplitterWindowComponent : public ComponentBase
 					return;
 				}
 
-				int sashPos = obj->GetPropertyAsInteger(_("sashpos"));
-				int splitmode = obj->GetPropertyAsInteger(_("splitmode"));
+				int sashPos = obj->GetPropertyAsInteger(wxT("sashpos"));
+				int splitmode = obj->GetPropertyAsInteger(wxT("splitmode"));
 
 				if ( firstChild )
 				{
@@ -468,7 +468,7 @@ void ComponentEvtHandler::OnSplitterSashChanged( wxSplitterEvent& )
 	{
 		if ( window->m_customSashPos != 0 )
 		{
-			m_manager->ModifyProperty( window, _("sashpos"), wxString::Format( wxT("%i"), window->GetSashPosition() ) );
+			m_manager->ModifyProperty( window, wxT("sashpos"), wxString::Format( wxT("%i"), window->GetSashPosition() ) );
 		}
 	}
 }
@@ -477,7 +477,7 @@ class SplitterItemComponent : public ComponentBase
 {
 	ticpp::Element* ExportToXrc(IObject* obj) override {
 		// A __dummyitem__ will be ignored...
-		ObjectToXrcFilter xrc(obj, _("__dummyitem__"),wxT(""));
+		ObjectToXrcFilter xrc(obj, wxT("__dummyitem__"),wxT(""));
 		return xrc.GetXrcObject();
 	}
 };
@@ -487,34 +487,34 @@ class ScrolledWindowComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
         wxScrolledWindow *sw = new wxScrolledWindow((wxWindow *)parent, wxID_ANY,
-            obj->GetPropertyAsPoint(_("pos")),
-            obj->GetPropertyAsSize(_("size")),
-            obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+            obj->GetPropertyAsPoint(wxT("pos")),
+            obj->GetPropertyAsSize(wxT("size")),
+            obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
         sw->SetScrollRate(
-            obj->GetPropertyAsInteger(_("scroll_rate_x")),
-            obj->GetPropertyAsInteger(_("scroll_rate_y")));
+            obj->GetPropertyAsInteger(wxT("scroll_rate_x")),
+            obj->GetPropertyAsInteger(wxT("scroll_rate_y")));
         return sw;
     }
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-        ObjectToXrcFilter xrc(obj, _("wxScrolledWindow"), obj->GetPropertyAsString(_("name")));
+        ObjectToXrcFilter xrc(obj, wxT("wxScrolledWindow"), obj->GetPropertyAsString(wxT("name")));
         xrc.AddWindowProperties();
-		xrc.AddPropertyValue( _("scrollrate"), wxString::Format( wxT("%d,%d"),
-				obj->GetPropertyAsInteger(_("scroll_rate_x")),
-				obj->GetPropertyAsInteger(_("scroll_rate_y")) ) );
+		xrc.AddPropertyValue( wxT("scrollrate"), wxString::Format( wxT("%d,%d"),
+				obj->GetPropertyAsInteger(wxT("scroll_rate_x")),
+				obj->GetPropertyAsInteger(wxT("scroll_rate_y")) ) );
         return xrc.GetXrcObject();
     }
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-        XrcToXfbFilter filter(xrcObj, _("wxScrolledWindow"));
+        XrcToXfbFilter filter(xrcObj, wxT("wxScrolledWindow"));
         filter.AddWindowProperties();
 
 		ticpp::Element *scrollrate = xrcObj->FirstChildElement("scrollrate", false);
 		if( scrollrate ) {
 			wxString value( wxString( scrollrate->GetText().c_str(), wxConvUTF8 ) );
-			filter.AddPropertyValue( _("scroll_rate_x"), value.BeforeFirst( wxT(',') ) );
-			filter.AddPropertyValue( _("scroll_rate_y"), value.AfterFirst( wxT(',') ) );
+			filter.AddPropertyValue( wxT("scroll_rate_x"), value.BeforeFirst( wxT(',') ) );
+			filter.AddPropertyValue( wxT("scroll_rate_y"), value.AfterFirst( wxT(',') ) );
 		}
         return filter.GetXfbObject();
     }
@@ -525,9 +525,9 @@ class NotebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxNotebook* book = new wxCustomNotebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		BookUtils::AddImageList( obj, book );
 
@@ -546,13 +546,13 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxNotebook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxNotebook"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxNotebook"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxNotebook"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -568,7 +568,7 @@ class NotebookPageComponent : public ComponentBase
 {
 public:
 	void OnCreated(wxObject* wxobject, wxWindow* wxparent) override {
-		BookUtils::OnCreated< wxNotebook >( wxobject, wxparent, GetManager(), _("NotebookPageComponent") );
+		BookUtils::OnCreated< wxNotebook >( wxobject, wxparent, GetManager(), wxT("NotebookPageComponent") );
 	}
 
 	void OnSelected(wxObject* wxobject) override {
@@ -576,22 +576,22 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("notebookpage"));
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("select"),_("selected"),XRC_TYPE_BOOL);
-		if ( !obj->IsNull( _("bitmap") ) )
+		ObjectToXrcFilter xrc(obj, wxT("notebookpage"));
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("select"),wxT("selected"),XRC_TYPE_BOOL);
+		if ( !obj->IsNull( wxT("bitmap") ) )
 		{
-			xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
+			xrc.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
 		}
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("notebookpage"));
+		XrcToXfbFilter filter(xrcObj, wxT("notebookpage"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("selected"),_("select"),XRC_TYPE_BOOL);
-		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("selected"),wxT("select"),XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
 		return filter.GetXfbObject();
 	}
 };
@@ -601,9 +601,9 @@ class ListbookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxListbook* book = new wxListbook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		BookUtils::AddImageList( obj, book );
 
@@ -629,7 +629,7 @@ public:
 		{
 			// Small icon style if bitmapsize is not set
 			IObject* obj = GetManager()->GetIObject( wxobject );
-			if ( obj->GetPropertyAsString( _("bitmapsize") ).empty() )
+			if ( obj->GetPropertyAsString( wxT("bitmapsize") ).empty() )
 			{
 				wxListView* tmpListView = book->GetListView();
 				long flags = tmpListView->GetWindowStyleFlag();
@@ -641,13 +641,13 @@ public:
 #endif
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxListbook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxListbook"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxListbook"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxListbook"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -663,7 +663,7 @@ class ListbookPageComponent : public ComponentBase
 {
 public:
 	void OnCreated(wxObject* wxobject, wxWindow* wxparent) override {
-		BookUtils::OnCreated< wxListbook >( wxobject, wxparent, GetManager(), _("ListbookPageComponent") );
+		BookUtils::OnCreated< wxListbook >( wxobject, wxparent, GetManager(), wxT("ListbookPageComponent") );
 	}
 
 	void OnSelected(wxObject* wxobject) override {
@@ -671,17 +671,17 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("listbookpage"));
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("select"),_("selected"),XRC_TYPE_BOOL);
+		ObjectToXrcFilter xrc(obj, wxT("listbookpage"));
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("select"),wxT("selected"),XRC_TYPE_BOOL);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("listbookpage"));
+		XrcToXfbFilter filter(xrcObj, wxT("listbookpage"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("selected"),_("select"),XRC_TYPE_BOOL);
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("selected"),wxT("select"),XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 };
@@ -691,9 +691,9 @@ class ChoicebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxChoicebook* book = new wxChoicebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
 		book->PushEventHandler( new ComponentEvtHandler( book, GetManager() ) );
 
@@ -710,13 +710,13 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxChoicebook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxChoicebook"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxChoicebook"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxChoicebook"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -732,7 +732,7 @@ class ChoicebookPageComponent : public ComponentBase
 {
 public:
 	void OnCreated(wxObject* wxobject, wxWindow* wxparent) override {
-		BookUtils::OnCreated< wxChoicebook >( wxobject, wxparent, GetManager(), _("ChoicebookPageComponent") );
+		BookUtils::OnCreated< wxChoicebook >( wxobject, wxparent, GetManager(), wxT("ChoicebookPageComponent") );
 	}
 
 	void OnSelected(wxObject* wxobject) override {
@@ -740,17 +740,17 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("choicebookpage"));
-		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddProperty(_("select"),_("selected"),XRC_TYPE_BOOL);
+		ObjectToXrcFilter xrc(obj, wxT("choicebookpage"));
+		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("select"),wxT("selected"),XRC_TYPE_BOOL);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("choicebookpage"));
+		XrcToXfbFilter filter(xrcObj, wxT("choicebookpage"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("selected"),_("select"),XRC_TYPE_BOOL);
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("selected"),wxT("select"),XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 };
@@ -760,12 +760,12 @@ class AuiNotebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxAuiNotebook* book = new wxAuiNotebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")));
 
-		book->SetTabCtrlHeight( obj->GetPropertyAsInteger( _("tab_ctrl_height") ) );
-		book->SetUniformBitmapSize( obj->GetPropertyAsSize( _("uniform_bitmap_size") ) );
+		book->SetTabCtrlHeight( obj->GetPropertyAsInteger( wxT("tab_ctrl_height") ) );
+		book->SetUniformBitmapSize( obj->GetPropertyAsSize( wxT("uniform_bitmap_size") ) );
 
 		book->PushEventHandler( new ComponentEvtHandler( book, GetManager() ) );
 
@@ -783,13 +783,13 @@ public:
 
 #if wxVERSION_NUMBER >= 2905
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxAuiNotebook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxAuiNotebook"), obj->GetPropertyAsString(wxT("name")));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxAuiNotebook"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxAuiNotebook"));
 		filter.AddWindowProperties();
 		return filter.GetXfbObject();
 	}
@@ -834,10 +834,10 @@ public:
 
 		// Save selection
 		int selection = book->GetSelection();
-		const wxBitmap& bitmap = obj->IsNull( _("bitmap") ) ? wxNullBitmap : obj->GetPropertyAsBitmap( _("bitmap") );
-		book->AddPage( page, obj->GetPropertyAsString( _("label") ), false, bitmap );
+		const wxBitmap& bitmap = obj->IsNull( wxT("bitmap") ) ? wxNullBitmap : obj->GetPropertyAsBitmap( wxT("bitmap") );
+		book->AddPage( page, obj->GetPropertyAsString( wxT("label") ), false, bitmap );
 
-		if ( obj->GetPropertyAsString( _("select") ) == wxT("0") && selection >= 0 )
+		if ( obj->GetPropertyAsString( wxT("select") ) == wxT("0") && selection >= 0 )
 		{
 			book->SetSelection(selection);
 		}
@@ -853,19 +853,19 @@ public:
 
 #if wxVERSION_NUMBER >= 2905
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("notebookpage"));
-		xrc.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("selected"),_("selected"), XRC_TYPE_BOOL);
-		xrc.AddProperty(_("bitmap"),_("bitmap"), XRC_TYPE_BITMAP);
+		ObjectToXrcFilter xrc(obj, wxT("notebookpage"));
+		xrc.AddProperty(wxT("label"),wxT("label"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("selected"),wxT("selected"), XRC_TYPE_BOOL);
+		xrc.AddProperty(wxT("bitmap"),wxT("bitmap"), XRC_TYPE_BITMAP);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("notebookpage"));
+		XrcToXfbFilter filter(xrcObj, wxT("notebookpage"));
 		filter.AddWindowProperties();
-		filter.AddProperty(_("selected"),_("selected"),XRC_TYPE_BOOL);
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
+		filter.AddProperty(wxT("selected"),wxT("selected"),XRC_TYPE_BOOL);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("bitmap"),wxT("bitmap"),XRC_TYPE_BITMAP);
 		return filter.GetXfbObject();
 	}
 #endif
@@ -876,9 +876,9 @@ class SimplebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxSimplebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPoint(wxT("pos")),
+			obj->GetPropertyAsSize(wxT("size")),
+			obj->GetPropertyAsInteger(wxT("window_style")));
 	}
 };
 
@@ -886,7 +886,7 @@ class SimplebookPageComponent : public ComponentBase
 {
 public:
 	void OnCreated(wxObject* wxobject, wxWindow* wxparent) override {
-		BookUtils::OnCreated< wxSimplebook >( wxobject, wxparent, GetManager(), _("SimplebookPageComponent") );
+		BookUtils::OnCreated< wxSimplebook >( wxobject, wxparent, GetManager(), wxT("SimplebookPageComponent") );
 	}
 
 	void OnSelected(wxObject* wxobject) override {
@@ -39,8 +39,8 @@ public:
 	// ImportFromXRC is handled in sizeritem components
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("spacer"));
-		xrc.AddPropertyPair( _("width"), _("height"), _("size") );
+		ObjectToXrcFilter xrc(obj, wxT("spacer"));
+		xrc.AddPropertyPair( wxT("width"), wxT("height"), wxT("size") );
 		return xrc.GetXrcObject();
 	}
 };
@@ -49,29 +49,29 @@ class GBSizerItemComponent : public ComponentBase
 {
 public:
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("sizeritem"));
-		xrc.AddPropertyPair( _("row"), _("column"), _("cellpos") );
-		xrc.AddPropertyPair( _("rowspan"), _("colspan"), _("cellspan") );
-		xrc.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
-		xrc.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
+		ObjectToXrcFilter xrc(obj, wxT("sizeritem"));
+		xrc.AddPropertyPair( wxT("row"), wxT("column"), wxT("cellpos") );
+		xrc.AddPropertyPair( wxT("rowspan"), wxT("colspan"), wxT("cellspan") );
+		xrc.AddProperty(wxT("flag"),   wxT("flag"),   XRC_TYPE_BITLIST);
+		xrc.AddProperty(wxT("border"), wxT("border"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
 		// XrcLoader::GetObject imports spacers as sizeritems
-		XrcToXfbFilter filter(xrcObj, _("gbsizeritem"));
-		filter.AddPropertyPair( "cellpos", _("row"), _("column") );
-		filter.AddPropertyPair( "cellspan", _("rowspan"), _("colspan") );
-		filter.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
-		filter.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
+		XrcToXfbFilter filter(xrcObj, wxT("gbsizeritem"));
+		filter.AddPropertyPair( "cellpos", wxT("row"), wxT("column") );
+		filter.AddPropertyPair( "cellspan", wxT("rowspan"), wxT("colspan") );
+		filter.AddProperty(wxT("flag"),   wxT("flag"),   XRC_TYPE_BITLIST);
+		filter.AddProperty(wxT("border"), wxT("border"), XRC_TYPE_INTEGER);
 		ticpp::Element* sizeritem = filter.GetXfbObject();
 
 		// XrcLoader::GetObject imports spacers as sizeritems, so check for a spacer
 		if ( xrcObj->FirstChildElement( "size", false ) && !xrcObj->FirstChildElement( "object", false ) )
 		{
 			// it is a spacer
-			XrcToXfbFilter spacer( xrcObj, _("spacer") );
-			spacer.AddPropertyPair( "size", _("width"), _("height") );
+			XrcToXfbFilter spacer( xrcObj, wxT("spacer") );
+			spacer.AddPropertyPair( "size", wxT("width"), wxT("height") );
 			sizeritem->LinkEndChild( spacer.GetXfbObject() );
 		}
 
@@ -105,14 +105,24 @@ public:
 		IObject* obj = GetManager()->GetIObject( wxobject );
 		IObject* childObj = GetManager()->GetIObject( child );
 
+		// Every sizer item goes through here, so the names are resolved only once
+		static const PropertyAtom widthAtom = obj->GetPropertyAtom( wxT("width") );
+		static const PropertyAtom heightAtom = obj->GetPropertyAtom( wxT("height") );
+		static const PropertyAtom proportionAtom = obj->GetPropertyAtom( wxT("proportion") );
+		static const PropertyAtom flagAtom = obj->GetPropertyAtom( wxT("flag") );
+		static const PropertyAtom borderAtom = obj->GetPropertyAtom( wxT("border") );
+		const int proportion = obj->GetPropertyAsIntegerByAtom( proportionAtom );
+		const int flag = obj->GetPropertyAsIntegerByAtom( flagAtom );
+		const int border = obj->GetPropertyAsIntegerByAtom( borderAtom );
+
 		// Add the spacer
-		if ( _("spacer") == childObj->GetClassName() )
+		if ( wxT("spacer") == childObj->GetClassName() )
 		{
-			sizer->Add(	childObj->GetPropertyAsInteger( _("width") ),
-						childObj->GetPropertyAsInteger( _("height") ),
-						obj->GetPropertyAsInteger(_("proportion")),
-						obj->GetPropertyAsInteger(_("flag")),
-						obj->GetPropertyAsInteger(_("border"))
+			sizer->Add(	childObj->GetPropertyAsIntegerByAtom( widthAtom ),
+						childObj->GetPropertyAsIntegerByAtom( heightAtom ),
+						proportion,
+						flag,
+						border
 						);
 			return;
 		}
@@ -124,16 +134,16 @@ public:
 		if ( windowChild != NULL )
 		{
 			sizer->Add( windowChild,
-				obj->GetPropertyAsInteger(_("proportion")),
-				obj->GetPropertyAsInteger(_("flag")),
-				obj->GetPropertyAsInteger(_("border")));
+				proportion,
+				flag,
+				border);
 		}
 		else if ( sizerChild != NULL )
 		{
 			sizer->Add( sizerChild,
-				obj->GetPropertyAsInteger(_("proportion")),
-				obj->GetPropertyAsInteger(_("flag")),
-				obj->GetPropertyAsInteger(_("border")));
+				proportion,
+				flag,
+				border);
 		}
 		else
 		{
@@ -142,26 +152,26 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("sizeritem"));
-		xrc.AddProperty(_("proportion"), _("option"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
-		xrc.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
+		ObjectToXrcFilter xrc(obj, wxT("sizeritem"));
+		xrc.AddProperty(wxT("proportion"), wxT("option"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("flag"),   wxT("flag"),   XRC_TYPE_BITLIST);
+		xrc.AddProperty(wxT("border"), wxT("border"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("sizeritem"));
-		filter.AddProperty(_("option"), _("proportion"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
-		filter.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
+		XrcToXfbFilter filter(xrcObj, wxT("sizeritem"));
+		filter.AddProperty(wxT("option"), wxT("proportion"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("flag"),   wxT("flag"),   XRC_TYPE_BITLIST);
+		filter.AddProperty(wxT("border"), wxT("border"), XRC_TYPE_INTEGER);
 		ticpp::Element* sizeritem = filter.GetXfbObject();
 
 		// XrcLoader::GetObject imports spacers as sizeritems, so check for a spacer
 		if ( xrcObj->FirstChildElement("size", false ) && !xrcObj->FirstChildElement("object", false ) )
 		{
 			// it is a spacer
-			XrcToXfbFilter spacer( xrcObj, _("spacer") );
-			spacer.AddPropertyPair( "size", _("width"), _("height") );
+			XrcToXfbFilter spacer( xrcObj, wxT("spacer") );
+			spacer.AddPropertyPair( "size", wxT("width"), wxT("height") );
 			sizeritem->LinkEndChild( spacer.GetXfbObject() );
 		}
 		return sizeritem;
@@ -172,23 +182,23 @@ class BoxSizerComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
-		wxBoxSizer *sizer = new wxBoxSizer(obj->GetPropertyAsInteger(_("orient")));
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		wxBoxSizer *sizer = new wxBoxSizer(obj->GetPropertyAsInteger(wxT("orient")));
+		sizer->SetMinSize( obj->GetPropertyAsSize(wxT("minimum_size")) );
 		return sizer;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxBoxSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
+		ObjectToXrcFilter xrc(obj, wxT("wxBoxSizer"));
+		if( obj->GetPropertyAsSize(wxT("minimum_size")) != wxDefaultSize ) xrc.AddProperty(wxT("minimum_size"), wxT("minsize"), XRC_TYPE_SIZE);
+		xrc.AddProperty(wxT("orient"), wxT("orient"), XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj ) override
 	{
-		XrcToXfbFilter filter(xrcObj, _("wxBoxSizer"));
-		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("orient"),_("orient"),XRC_TYPE_TEXT);
+		XrcToXfbFilter filter(xrcObj, wxT("wxBoxSizer"));
+		filter.AddProperty(wxT("minsize"), wxT("minsize"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("orient"),wxT("orient"),XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 };
@@ -197,28 +207,28 @@ class WrapSizerComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
-		const auto sizer = new wxWrapSizer(obj->GetPropertyAsInteger(_("orient")),
-		                                   obj->GetPropertyAsInteger(_("flags")));
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		const auto sizer = new wxWrapSizer(obj->GetPropertyAsInteger(wxT("orient")),
+		                                   obj->GetPropertyAsInteger(wxT("flags")));
+		sizer->SetMinSize( obj->GetPropertyAsSize(wxT("minimum_size")) );
 		return sizer;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxWrapSizer"));
-		if (obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize)
+		ObjectToXrcFilter xrc(obj, wxT("wxWrapSizer"));
+		if (obj->GetPropertyAsSize(wxT("minimum_size")) != wxDefaultSize)
 		{
-			xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+			xrc.AddProperty(wxT("minimum_size"), wxT("minsize"), XRC_TYPE_SIZE);
 		}
-		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("flags"), _("flags"), XRC_TYPE_BITLIST);
+		xrc.AddProperty(wxT("orient"), wxT("orient"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("flags"), wxT("flags"), XRC_TYPE_BITLIST);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxWrapSizer"));
-		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
-		filter.AddProperty(_("flags"), _("flags"), XRC_TYPE_BITLIST);
+		XrcToXfbFilter filter(xrcObj, wxT("wxWrapSizer"));
+		filter.AddProperty(wxT("minsize"), wxT("minsize"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("orient"), wxT("orient"), XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("flags"), wxT("flags"), XRC_TYPE_BITLIST);
 		return filter.GetXfbObject();
 	}
 };
@@ -234,29 +244,29 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		m_count++;
 		wxStaticBox* box = new wxStaticBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")));
+			obj->GetPropertyAsString(wxT("label")));
 
 		wxStaticBoxSizer* sizer = new wxStaticBoxSizer(box,
-			obj->GetPropertyAsInteger(_("orient")));
+			obj->GetPropertyAsInteger(wxT("orient")));
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSize(wxT("minimum_size")) );
 
 		return sizer;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStaticBoxSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
-		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
+		ObjectToXrcFilter xrc(obj, wxT("wxStaticBoxSizer"));
+		if( obj->GetPropertyAsSize(wxT("minimum_size")) != wxDefaultSize ) xrc.AddProperty(wxT("minimum_size"), wxT("minsize"), XRC_TYPE_SIZE);
+		xrc.AddProperty(wxT("orient"), wxT("orient"), XRC_TYPE_TEXT);
+		xrc.AddProperty(wxT("label"), wxT("label"), XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticBoxSizer"));
-		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("orient"),_("orient"),XRC_TYPE_TEXT);
-		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
+		XrcToXfbFilter filter(xrcObj, wxT("wxStaticBoxSizer"));
+		filter.AddProperty(wxT("minsize"), wxT("minsize"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("orient"),wxT("orient"),XRC_TYPE_TEXT);
+		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 		return filter.GetXfbObject();
 	}
 };
@@ -266,33 +276,33 @@ class GridSizerComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
 		wxGridSizer *sizer = new wxGridSizer(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")),
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsInteger(wxT("rows")),
+			obj->GetPropertyAsInteger(wxT("cols")),
+			obj->GetPropertyAsInteger(wxT("vgap")),
+			obj->GetPropertyAsInteger(wxT("hgap")));
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSize(wxT("minimum_size")) );
 
 		return sizer;
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGridSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
+		ObjectToXrcFilter xrc(obj, wxT("wxGridSizer"));
+		if( obj->GetPropertyAsSize(wxT("minimum_size")) != wxDefaultSize ) xrc.AddProperty(wxT("minimum_size"), wxT("minsize"), XRC_TYPE_SIZE);
+		xrc.AddProperty(wxT("rows"), wxT("rows"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("cols"), wxT("cols"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("vgap"), wxT("vgap"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("hgap"), wxT("hgap"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGridSizer"));
-		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
+		XrcToXfbFilter filter(xrcObj, wxT("wxGridSizer"));
+		filter.AddProperty(wxT("minsize"), wxT("minsize"), XRC_TYPE_SIZE);
+		filter.AddProperty(wxT("rows"), wxT("rows"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("cols"), wxT("cols"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("vgap"), wxT("vgap"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("hgap"), wxT("hgap"), XRC_TYPE_INTEGER);
 		return filter.GetXfbObject();
 	}
 };
@@ -302,35 +312,35 @@ class FlexGridSizerBase : public ComponentBase
 public:
 	void AddProperties( IObject* obj, wxFlexGridSizer* sizer )
 	{
-		for (const auto& col : obj->GetPropertyAsVectorIntPair(_("growablecols")))
+		for (const auto& col : obj->GetPropertyAsVectorIntPair(wxT("growablecols")))
 		{
 			sizer->AddGrowableCol(col.first, col.second);
 		}
-		for (const auto& row : obj->GetPropertyAsVectorIntPair(_("growablerows")))
+		for (const auto& row : obj->GetPropertyAsVectorIntPair(wxT("growablerows")))
 		{
 			sizer->AddGrowableRow(row.first, row.second);
 		}
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
-		sizer->SetFlexibleDirection( obj->GetPropertyAsInteger(_("flexible_direction")) );
-		sizer->SetNonFlexibleGrowMode( (wxFlexSizerGrowMode )obj->GetPropertyAsInteger(_("non_flexible_grow_mode")) );
+		sizer->SetMinSize( obj->GetPropertyAsSize(wxT("minimum_size")) );
+		sizer->SetFlexibleDirection( obj->GetPropertyAsInteger(wxT("flexible_direction")) );
+		sizer->SetNonFlexibleGrowMode( (wxFlexSizerGrowMode )obj->GetPropertyAsInteger(wxT("non_flexible_grow_mode")) );
 	}
 
 	void ExportXRCProperties( ObjectToXrcFilter* xrc, IObject* obj )
 	{
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc->AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
-		xrc->AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
-		xrc->AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
-		xrc->AddPropertyValue(_("growablecols"), obj->GetPropertyAsString(_("growablecols")));
-		xrc->AddPropertyValue(_("growablerows"), obj->GetPropertyAsString(_("growablerows")));
+		if( obj->GetPropertyAsSize(wxT("minimum_size")) != wxDefaultSize ) xrc->AddProperty(wxT("minimum_size"), wxT("minsize"), XRC_TYPE_SIZE);
+		xrc->AddProperty(wxT("vgap"), wxT("vgap"), XRC_TYPE_INTEGER);
+		xrc->AddProperty(wxT("hgap"), wxT("hgap"), XRC_TYPE_INTEGER);
+		xrc->AddPropertyValue(wxT("growablecols"), obj->GetPropertyAsString(wxT("growablecols")));
+		xrc->AddPropertyValue(wxT("growablerows"), obj->GetPropertyAsString(wxT("growablerows")));
 	}
 
 	void ImportXRCProperties( XrcToXfbFilter* filter )
 	{
-		filter->AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
-		filter->AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
-		filter->AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
-		filter->AddProperty(_("growablecols"),_("growablecols"),XRC_TYPE_TEXT);
-		filter->AddProperty(_("growablerows"),_("growablerows"),XRC_TYPE_TEXT);
+		filter->AddProperty(wxT("minsize"), wxT("minsize"), XRC_TYPE_SIZE);
+		filter->AddProperty(wxT("vgap"), wxT("vgap"), XRC_TYPE_INTEGER);
+		filter->AddProperty(wxT("hgap"), wxT("hgap"), XRC_TYPE_INTEGER);
+		filter->AddProperty(wxT("growablecols"),wxT("growablecols"),XRC_TYPE_TEXT);
+		filter->AddProperty(wxT("growablerows"),wxT("growablerows"),XRC_TYPE_TEXT);
 	}
 };
 
@@ -339,10 +349,10 @@ class FlexGridSizerComponent : public FlexGridSizerBase
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
 		wxFlexGridSizer *sizer = new wxFlexGridSizer(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")),
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsInteger(wxT("rows")),
+			obj->GetPropertyAsInteger(wxT("cols")),
+			obj->GetPropertyAsInteger(wxT("vgap")),
+			obj->GetPropertyAsInteger(wxT("hgap")));
 
 		AddProperties( obj, sizer );
 
@@ -350,17 +360,17 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxFlexGridSizer"));
-		xrc.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
+		ObjectToXrcFilter xrc(obj, wxT("wxFlexGridSizer"));
+		xrc.AddProperty(wxT("rows"), wxT("rows"), XRC_TYPE_INTEGER);
+		xrc.AddProperty(wxT("cols"), wxT("cols"), XRC_TYPE_INTEGER);
 		ExportXRCProperties( &xrc, obj );
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxFlexGridSizer"));
-		filter.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
+		XrcToXfbFilter filter(xrcObj, wxT("wxFlexGridSizer"));
+		filter.AddProperty(wxT("rows"), wxT("rows"), XRC_TYPE_INTEGER);
+		filter.AddProperty(wxT("cols"), wxT("cols"), XRC_TYPE_INTEGER);
 		ImportXRCProperties( &filter );
 		return filter.GetXfbObject();
 	}
@@ -373,14 +383,21 @@ private:
 	{
 		IObject* childObj = GetManager()->GetIObject( child );
 
-		if ( _("spacer") == childObj->GetClassName() )
+		static const PropertyAtom widthAtom = childObj->GetPropertyAtom( wxT("width") );
+		static const PropertyAtom heightAtom = childObj->GetPropertyAtom( wxT("height") );
+		static const PropertyAtom flagAtom = sizeritem->GetPropertyAtom( wxT("flag") );
+		static const PropertyAtom borderAtom = sizeritem->GetPropertyAtom( wxT("border") );
+		const int flag = sizeritem->GetPropertyAsIntegerByAtom( flagAtom );
+		const int border = sizeritem->GetPropertyAsIntegerByAtom( borderAtom );
+
+		if ( wxT("spacer") == childObj->GetClassName() )
 		{
-			return new wxGBSizerItem(	childObj->GetPropertyAsInteger( _("width") ),
-										childObj->GetPropertyAsInteger( _("height") ),
+			return new wxGBSizerItem(	childObj->GetPropertyAsIntegerByAtom( widthAtom ),
+										childObj->GetPropertyAsIntegerByAtom( heightAtom ),
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										flag,
+										border,
 										NULL
 										);
 		}
@@ -394,8 +411,8 @@ private:
 			return new wxGBSizerItem( 	windowChild,
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										flag,
+										border,
 										NULL
 										);
 		}
@@ -404,8 +421,8 @@ private:
 			return new wxGBSizerItem( 	sizerChild,
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										flag,
+										border,
 										NULL
 										);
 		}
@@ -419,12 +436,12 @@ private:
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
 		wxGridBagSizer* sizer = new wxGridBagSizer(
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsInteger(wxT("vgap")),
+			obj->GetPropertyAsInteger(wxT("hgap")));
 
-		if ( !obj->IsNull( _("empty_cell_size") ) )
+		if ( !obj->IsNull( wxT("empty_cell_size") ) )
 		{
-			sizer->SetEmptyCellSize( obj->GetPropertyAsSize( _("empty_cell_size") ) );
+			sizer->SetEmptyCellSize( obj->GetPropertyAsSize( wxT("empty_cell_size") ) );
 		}
 
 		return sizer;
@@ -452,6 +469,11 @@ public:
 			sizer->Add( 0, 0, wxGBPosition( 0, 0 ) );
 			return;
 		}
+		IObject* obj = manager->GetIObject( wxobject );
+		static const PropertyAtom rowAtom = obj->GetPropertyAtom( wxT("row") );
+		static const PropertyAtom columnAtom = obj->GetPropertyAtom( wxT("column") );
+		static const PropertyAtom rowspanAtom = obj->GetPropertyAtom( wxT("rowspan") );
+		static const PropertyAtom colspanAtom = obj->GetPropertyAtom( wxT("colspan") );
 		for ( size_t i = 0; i < count; ++i )
 		{
 			// Should be a GBSizerItem
@@ -459,9 +481,9 @@ public:
 			IObject* isizerItem = manager->GetIObject( wxsizerItem );
 
 			// Get the location of the item
-			wxGBSpan span( isizerItem->GetPropertyAsInteger( _("rowspan") ), isizerItem->GetPropertyAsInteger( _("colspan") ) );
+			wxGBSpan span( isizerItem->GetPropertyAsIntegerByAtom( rowspanAtom ), isizerItem->GetPropertyAsIntegerByAtom( colspanAtom ) );
 
-			int column = isizerItem->GetPropertyAsInteger( _("column") );
+			int column = isizerItem->GetPropertyAsIntegerByAtom( columnAtom );
 			if ( column < 0 )
 			{
 				// Needs to be auto positioned after the other children are added
@@ -473,7 +495,7 @@ public:
 				continue;
 			}
 
-			wxGBPosition position( isizerItem->GetPropertyAsInteger( _("row") ), column );
+			wxGBPosition position( isizerItem->GetPropertyAsIntegerByAtom( rowAtom ), column );
 
 			// Check for intersection
 			if ( sizer->CheckForIntersection( position, span ) )
@@ -504,21 +526,21 @@ public:
 			}
 			it->second->SetPos( position );
 			sizer->Add( it->second );
-			GetManager()->ModifyProperty( it->first, _("row"), wxString::Format( wxT("%i"), position.GetRow() ), false );
-			GetManager()->ModifyProperty( it->first, _("column"), wxString::Format( wxT("%i"), column ), false );
+			GetManager()->ModifyProperty( it->first, wxT("row"), wxString::Format( wxT("%i"), position.GetRow() ), false );
+			GetManager()->ModifyProperty( it->first, wxT("column"), wxString::Format( wxT("%i"), column ), false );
 		}
 
 		AddProperties(manager->GetIObject(wxobject), sizer);
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGridBagSizer"));
+		ObjectToXrcFilter xrc(obj, wxT("wxGridBagSizer"));
 		ExportXRCProperties( &xrc, obj );
 		return xrc.GetXrcObject();
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGridBagSizer"));
+		XrcToXfbFilter filter(xrcObj, wxT("wxGridBagSizer"));
 		ImportXRCProperties( &filter );
 		return filter.GetXfbObject();
 	}
@@ -564,30 +586,30 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxStdDialogButtonSizer* sizer =  new wxStdDialogButtonSizer();
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSize(wxT("minimum_size")) );
 
-		if (obj->GetPropertyAsInteger(_("OK")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("OK")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_OK));
 		}
-		if (obj->GetPropertyAsInteger(_("Yes")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Yes")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_YES));
 		}
-		if (obj->GetPropertyAsInteger(_("Save")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Save")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_SAVE));
 		}
-		if (obj->GetPropertyAsInteger(_("Apply")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Apply")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_APPLY));
 		}
-		if (obj->GetPropertyAsInteger(_("No")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("No")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_NO));
 		}
-		if (obj->GetPropertyAsInteger(_("Cancel")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Cancel")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_CANCEL));
 		}
-		if (obj->GetPropertyAsInteger(_("Help")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Help")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_HELP));
 		}
-		if (obj->GetPropertyAsInteger(_("ContextHelp")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("ContextHelp")) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_CONTEXT_HELP));
 		}
 
@@ -596,34 +618,34 @@ public:
 	}
 
 	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStdDialogButtonSizer"));
+		ObjectToXrcFilter xrc(obj, wxT("wxStdDialogButtonSizer"));
 		ticpp::Element* sizer = xrc.GetXrcObject();
 
-		if (obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize) {
-			xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+		if (obj->GetPropertyAsSize(wxT("minimum_size")) != wxDefaultSize) {
+			xrc.AddProperty(wxT("minimum_size"), wxT("minsize"), XRC_TYPE_SIZE);
 		}
-		if (obj->GetPropertyAsInteger(_("OK")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("OK")) != 0) {
 			AddXRCButton(sizer, "wxID_OK", "&OK");
 		}
-		if (obj->GetPropertyAsInteger(_("Yes")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Yes")) != 0) {
 			AddXRCButton(sizer, "wxID_YES", "&Yes");
 		}
-		if (obj->GetPropertyAsInteger(_("Save")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Save")) != 0) {
 			AddXRCButton(sizer, "wxID_SAVE", "&Save");
 		}
-		if (obj->GetPropertyAsInteger(_("Apply")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Apply")) != 0) {
 			AddXRCButton(sizer, "wxID_APPLY", "&Apply");
 		}
-		if (obj->GetPropertyAsInteger(_("No")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("No")) != 0) {
 			AddXRCButton(sizer, "wxID_NO", "&No");
 		}
-		if (obj->GetPropertyAsInteger(_("Cancel")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Cancel")) != 0) {
 			AddXRCButton(sizer, "wxID_CANCEL", "&Cancel");
 		}
-		if (obj->GetPropertyAsInteger(_("Help")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("Help")) != 0) {
 			AddXRCButton(sizer, "wxID_HELP", "&Help");
 		}
-		if (obj->GetPropertyAsInteger(_("ContextHelp")) != 0) {
+		if (obj->GetPropertyAsInteger(wxT("ContextHelp")) != 0) {
 			AddXRCButton(sizer, "wxID_CONTEXT_HELP", "");
 		}
 
@@ -642,8 +664,8 @@ public:
 		buttons[ _("Help") ] 		= wxT("0");
 		buttons[ _("ContextHelp") ] = wxT("0");
 
-		XrcToXfbFilter filter(xrcObj, _("wxStdDialogButtonSizer"));
-		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
+		XrcToXfbFilter filter(xrcObj, wxT("wxStdDialogButtonSizer"));
+		filter.AddProperty(wxT("minsize"), wxT("minsize"), XRC_TYPE_SIZE);
 
 		ticpp::Element* button = xrcObj->FirstChildElement( "object", false );
 		for (  ; button != 0; button = button->NextSiblingElement( "object", false ) )
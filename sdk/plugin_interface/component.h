@@ -59,6 +59,14 @@ enum
 };
 
 
+// Interned property name, obtained once with IObject::GetPropertyAtom().
+// Every property name of the object definitions gets one when they are loaded,
+// so an atom can be kept in a static and used with any object.
+enum PropertyAtom : int
+{
+  PROPERTY_ATOM_NONE = -1 // No object definition has a property of that name
+};
+
 // Plugins interface
 // The point is to provide an interface for accessing the object's properties
 // from the plugin itself, in a safe way.
@@ -78,11 +86,29 @@ class IObject
   virtual std::vector<std::pair<int, int>> GetPropertyAsVectorIntPair(const wxString& pname) = 0;
   virtual double GetPropertyAsFloat(const wxString& pname) = 0;
   virtual wxString GetChildFromParentProperty( const wxString& parentName, const wxString& childName ) = 0;
+
   virtual wxString GetClassName() = 0;
   virtual unsigned int  GetChildCount() = 0;
   virtual wxString GetObjectTypeName() = 0;
   virtual IObject* GetChildPtr (unsigned int idx) = 0;
   virtual ~IObject(){}
+
+  // Same lookups by interned name, they avoid hashing the name on every call.
+  // They are appended after the original methods and have names of their own,
+  // so the vtable slots of plugins built against older headers do not move.
+  virtual PropertyAtom GetPropertyAtom (const wxString& pname) = 0;
+  virtual bool     IsNullByAtom (PropertyAtom patom) = 0;
+  virtual int      GetPropertyAsIntegerByAtom (PropertyAtom patom) = 0;
+  virtual wxFontContainer   GetPropertyAsFontByAtom    (PropertyAtom patom) = 0;
+  virtual wxColour GetPropertyAsColourByAtom  (PropertyAtom patom) = 0;
+  virtual wxString GetPropertyAsStringByAtom  (PropertyAtom patom) = 0;
+  virtual wxPoint  GetPropertyAsPointByAtom   (PropertyAtom patom) = 0;
+  virtual wxSize   GetPropertyAsSizeByAtom    (PropertyAtom patom) = 0;
+  virtual wxBitmap GetPropertyAsBitmapByAtom  (PropertyAtom patom) = 0;
+  virtual wxArrayInt GetPropertyAsArrayIntByAtom(PropertyAtom patom) = 0;
+  virtual wxArrayString GetPropertyAsArrayStringByAtom(PropertyAtom patom) = 0;
+  virtual std::vector<std::pair<int, int>> GetPropertyAsVectorIntPairByAtom(PropertyAtom patom) = 0;
+  virtual double GetPropertyAsFloatByAtom(PropertyAtom patom) = 0;
 };
 
 // Interface which intends to contain all the components for a plugin
@@ -380,54 +380,69 @@ void ObjectToXrcFilter::LinkStringList( const wxArrayString &array, ticpp::Eleme
 
 void ObjectToXrcFilter::AddWindowProperties()
 {
+	// Every window goes through here, look the names up only once
+	static const PropertyAtom styleAtom = m_obj->GetPropertyAtom( wxT( "style" ) );
+	static const PropertyAtom windowStyleAtom = m_obj->GetPropertyAtom( wxT( "window_style" ) );
+	static const PropertyAtom extraStyleAtom = m_obj->GetPropertyAtom( wxT( "extra_style" ) );
+	static const PropertyAtom windowExtraStyleAtom = m_obj->GetPropertyAtom( wxT( "window_extra_style" ) );
+	static const PropertyAtom posAtom = m_obj->GetPropertyAtom( wxT( "pos" ) );
+	static const PropertyAtom sizeAtom = m_obj->GetPropertyAtom( wxT( "size" ) );
+	static const PropertyAtom bgAtom = m_obj->GetPropertyAtom( wxT( "bg" ) );
+	static const PropertyAtom fgAtom = m_obj->GetPropertyAtom( wxT( "fg" ) );
+	static const PropertyAtom enabledAtom = m_obj->GetPropertyAtom( wxT( "enabled" ) );
+	static const PropertyAtom focusedAtom = m_obj->GetPropertyAtom( wxT( "focused" ) );
+	static const PropertyAtom hiddenAtom = m_obj->GetPropertyAtom( wxT( "hidden" ) );
+	static const PropertyAtom fontAtom = m_obj->GetPropertyAtom( wxT( "font" ) );
+	static const PropertyAtom tooltipAtom = m_obj->GetPropertyAtom( wxT( "tooltip" ) );
+
 	wxString style;
-	if ( !m_obj->IsNull( _( "style" ) ) )
-		style = m_obj->GetPropertyAsString( _T( "style" ) );
-	if ( !m_obj->IsNull( _( "window_style" ) ) ){
+	if ( !m_obj->IsNullByAtom( styleAtom ) )
+		style = m_obj->GetPropertyAsStringByAtom( styleAtom );
+	if ( !m_obj->IsNullByAtom( windowStyleAtom ) ){
 		if ( !style.IsEmpty() ) style += _T( '|' );
-		style += m_obj->GetPropertyAsString( _T( "window_style" ) );
+		style += m_obj->GetPropertyAsStringByAtom( windowStyleAtom );
 	}
 	if ( !style.IsEmpty() ) AddPropertyValue( _T( "style" ), style );
 
 	wxString extraStyle;
-	if ( !m_obj->IsNull( _( "extra_style" ) ) )
-		extraStyle = m_obj->GetPropertyAsString( _T( "extra_style" ) );
-	if ( !m_obj->IsNull( _( "window_extra_style" ) ) ){
+	if ( !m_obj->IsNullByAtom( extraStyleAtom ) )
+		extraStyle = m_obj->GetPropertyAsStringByAtom( extraStyleAtom );
+	if ( !m_obj->IsNullByAtom( windowExtraStyleAtom ) ){
 		if ( !extraStyle.IsEmpty() ) extraStyle += _T( '|' );
-		extraStyle += m_obj->GetPropertyAsString( _T( "window_extra_style" ) );
+		extraStyle += m_obj->GetPropertyAsStringByAtom( windowExtraStyleAtom );
 	}
 	if ( !extraStyle.IsEmpty() ) AddPropertyValue( _T( "exstyle" ), extraStyle );
 
-	if ( !m_obj->IsNull( _( "pos" ) ) )
-		AddProperty( _( "pos" ), _( "pos" ), XRC_TYPE_SIZE );
+	if ( !m_obj->IsNullByAtom( posAtom ) )
+		AddProperty( wxT( "pos" ), wxT( "pos" ), XRC_TYPE_SIZE );
 
-	if ( !m_obj->IsNull( _( "size" ) ) )
-		AddProperty( _( "size" ), _( "size" ), XRC_TYPE_SIZE );
+	if ( !m_obj->IsNullByAtom( sizeAtom ) )
+		AddProperty( wxT( "size" ), wxT( "size" ), XRC_TYPE_SIZE );
 
-	if ( !m_obj->IsNull( _( "bg" ) ) )
-		AddProperty( _( "bg" ), _( "bg" ), XRC_TYPE_COLOUR );
+	if ( !m_obj->IsNullByAtom( bgAtom ) )
+		AddProperty( wxT( "bg" ), wxT( "bg" ), XRC_TYPE_COLOUR );
 
-	if ( !m_obj->IsNull( _( "fg" ) ) )
-		AddProperty( _( "fg" ), _( "fg" ), XRC_TYPE_COLOUR );
+	if ( !m_obj->IsNullByAtom( fgAtom ) )
+		AddProperty( wxT( "fg" ), wxT( "fg" ), XRC_TYPE_COLOUR );
 
-	if (!m_obj->IsNull(_("enabled")) && m_obj->GetPropertyAsInteger(_("enabled")) == 0) {
-		AddProperty(_("enabled"), _("enabled"), XRC_TYPE_BOOL);
+	if (!m_obj->IsNullByAtom(enabledAtom) && m_obj->GetPropertyAsIntegerByAtom(enabledAtom) == 0) {
+		AddProperty(wxT("enabled"), wxT("enabled"), XRC_TYPE_BOOL);
 	}
-	if ( !m_obj->IsNull( _( "focused" ) ) )
-		AddPropertyValue( _( "focused" ), _( "0" ) );
+	if ( !m_obj->IsNullByAtom( focusedAtom ) )
+		AddPropertyValue( wxT( "focused" ), _( "0" ) );
 
-	if (!m_obj->IsNull(_("hidden")) && m_obj->GetPropertyAsInteger(_("hidden")) != 0) {
-		AddProperty(_("hidden"), _("hidden"), XRC_TYPE_BOOL);
+	if (!m_obj->IsNullByAtom(hiddenAtom) && m_obj->GetPropertyAsIntegerByAtom(hiddenAtom) != 0) {
+		AddProperty(wxT("hidden"), wxT("hidden"), XRC_TYPE_BOOL);
 	}
-	if ( !m_obj->IsNull( _( "font" ) ) )
-		AddProperty( _( "font" ), _( "font" ), XRC_TYPE_FONT );
+	if ( !m_obj->IsNullByAtom( fontAtom ) )
+		AddProperty( wxT( "font" ), wxT( "font" ), XRC_TYPE_FONT );
 
-	if ( !m_obj->IsNull( _( "tooltip" ) ) )
-		AddProperty( _( "tooltip" ), wxT( "tooltip" ), XRC_TYPE_TEXT );
+	if ( !m_obj->IsNullByAtom( tooltipAtom ) )
+		AddProperty( wxT( "tooltip" ), wxT( "tooltip" ), XRC_TYPE_TEXT );
 
-	if ( !m_obj->IsNull( _( "subclass" ) ) )
+	if ( !m_obj->IsNull( wxT( "subclass" ) ) )
 	{
-		wxString subclass = m_obj->GetChildFromParentProperty( _( "subclass" ), wxT( "name" ) );
+		wxString subclass = m_obj->GetChildFromParentProperty( wxT( "subclass" ), wxT( "name" ) );
 		if ( !subclass.empty() )
 		{
 			m_xrcObj->SetAttribute( "subclass", subclass.mb_str( wxConvUTF8 ) );
@@ -794,17 +809,17 @@ void XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName, ticpp::Ele
 			element = xrcProperty->FirstChildElement( "family" );
 			wxString family_str( element->GetText().c_str(), wxConvUTF8 );
 
-			if ( family_str == _( "decorative" ) )
+			if ( family_str == wxT( "decorative" ) )
 				font.SetFamily(wxFONTFAMILY_DECORATIVE);
-			else if ( family_str == _( "roman" ) )
+			else if ( family_str == wxT( "roman" ) )
 				font.SetFamily(wxFONTFAMILY_ROMAN);
-			else if ( family_str == _( "swiss" ) )
+			else if ( family_str == wxT( "swiss" ) )
 				font.SetFamily(wxFONTFAMILY_SWISS);
-			else if ( family_str == _( "script" ) )
+			else if ( family_str == wxT( "script" ) )
 				font.SetFamily(wxFONTFAMILY_SCRIPT);
-			else if ( family_str == _( "modern" ) )
+			else if ( family_str == wxT( "modern" ) )
 				font.SetFamily(wxFONTFAMILY_MODERN);
-			else if ( family_str == _( "teletype" ) )
+			else if ( family_str == wxT( "teletype" ) )
 				font.SetFamily(wxFONTFAMILY_TELETYPE);
 			else
 				font.SetFamily(wxFONTFAMILY_DEFAULT);
@@ -820,9 +835,9 @@ void XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName, ticpp::Ele
 			element = xrcProperty->FirstChildElement( "style" );
 			wxString style_str( element->GetText().c_str(), wxConvUTF8 );
 
-			if ( style_str == _( "slant" ) )
+			if ( style_str == wxT( "slant" ) )
 				font.SetStyle(wxFONTSTYLE_SLANT);
-			else if ( style_str == _( "italic" ) )
+			else if ( style_str == wxT( "italic" ) )
 				font.SetStyle(wxFONTSTYLE_ITALIC);
 			else
 				font.SetStyle(wxFONTSTYLE_NORMAL);
@@ -839,9 +854,9 @@ void XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName, ticpp::Ele
 			element = xrcProperty->FirstChildElement( "weight" );
 			wxString weight_str( element->GetText().c_str(), wxConvUTF8 );
 
-			if ( weight_str == _( "light" ) )
+			if ( weight_str == wxT( "light" ) )
 				font.SetWeight(wxFONTWEIGHT_LIGHT);
-			else if ( weight_str == _( "bold" ) )
+			else if ( weight_str == wxT( "bold" ) )
 				font.SetWeight(wxFONTWEIGHT_BOLD);
 			else
 				font.SetWeight(wxFONTWEIGHT_NORMAL);
@@ -994,17 +1009,17 @@ void XrcToXfbFilter::ImportStringListProperty( const wxString &xrcPropName, ticp
 
 void XrcToXfbFilter::AddWindowProperties()
 {
-	AddProperty( _( "pos" ), _( "pos" ), XRC_TYPE_POINT );
-	AddProperty( _( "size" ), _( "size" ), XRC_TYPE_SIZE );
-	AddProperty( _( "bg" ), _( "bg" ), XRC_TYPE_COLOUR );
-	AddProperty( _( "fg" ), _( "fg" ), XRC_TYPE_COLOUR );
-	AddProperty( _( "font" ), _( "font" ), XRC_TYPE_FONT );
+	AddProperty( wxT( "pos" ), wxT( "pos" ), XRC_TYPE_POINT );
+	AddProperty( wxT( "size" ), wxT( "size" ), XRC_TYPE_SIZE );
+	AddProperty( wxT( "bg" ), wxT( "bg" ), XRC_TYPE_COLOUR );
+	AddProperty( wxT( "fg" ), wxT( "fg" ), XRC_TYPE_COLOUR );
+	AddProperty( wxT( "font" ), wxT( "font" ), XRC_TYPE_FONT );
 	if ( m_xrcObj->FirstChildElement( "enabled", false ) )
 	{
-		AddProperty( _( "enabled"), _("enabled"), XRC_TYPE_BOOL );
+		AddProperty( wxT( "enabled"), wxT("enabled"), XRC_TYPE_BOOL );
 	}
-	AddProperty( _( "hidden"), _("hidden"), XRC_TYPE_BOOL );
-	AddProperty( _( "tooltip"), _("tooltip"), XRC_TYPE_TEXT );
+	AddProperty( wxT( "hidden"), wxT("hidden"), XRC_TYPE_BOOL );
+	AddProperty( wxT( "tooltip"), wxT("tooltip"), XRC_TYPE_TEXT );
 	AddStyleProperty();
 	AddExtraStyleProperty();
 
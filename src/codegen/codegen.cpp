@@ -25,16 +25,25 @@
 
 #include "codegen.h"
 
+#include "codewriter.h"
+#include "fragmentcache.h"
+#include "projectindex.h"
+#include "templateprogram.h"
+
 #include "../model/objectbase.h"
-#include "../rad/appdata.h"
 #include "../utils/wxfbexception.h"
 
+#include <wx/filename.h>
 #include <wx/tokenzr.h>
 
+#include <algorithm>
+
 TemplateParser::TemplateParser(PObjectBase obj, wxString _template)
 :
 m_obj( obj ),
-m_in( _template ),
+m_template( _template ),
+m_outStart( 0 ),
+m_cacheable( true ),
 m_indent( 0 )
 {
 }
@@ -42,7 +51,9 @@ m_indent( 0 )
 TemplateParser::TemplateParser( const TemplateParser & that, wxString _template )
 :
 m_obj( that.m_obj ),
-m_in( _template ),
+m_template( _template ),
+m_outStart( 0 ),
+m_cacheable( false ),
 m_indent( 0 )
 {
 }
@@ -60,9 +71,9 @@ TemplateParser::Token TemplateParser::GetNextToken()
 
 	Token result = TOK_ERROR;
 
-	if (!m_in.Eof())
+	if (!m_in->Eof())
 	{
-		wxChar c = m_in.Peek();
+		wxChar c = m_in->Peek();
 		if ( c == wxT('#') )
 			result = TOK_MACRO;
 		else if (c == wxT('$') )
@@ -164,19 +175,19 @@ TemplateParser::Ident TemplateParser::ParseIdent()
 {
 	Ident ident = ID_ERROR;
 
-	if (!m_in.Eof())
+	if (!m_in->Eof())
 	{
 		wxString macro;
-		m_in.GetC();
+		m_in->GetC();
 
-		wxChar peek( m_in.Peek() );
-		while (peek != wxChar(EOF) && !m_in.Eof() && peek != wxT('#') && peek != wxT('$')
+		wxChar peek( m_in->Peek() );
+		while (peek != wxChar(EOF) && !m_in->Eof() && peek != wxT('#') && peek != wxT('$')
 			&& ( (peek >= wxT('a') && peek <= wxT('z') ) ||
 			(peek >= wxT('A') && peek <= wxT('Z') ) ||
 			(peek >= wxT('0') && peek <= wxT('9') ) ))
 		{
-			macro += wxChar( m_in.GetC() );
-			peek = wxChar( m_in.Peek() );
+			macro += wxChar( m_in->GetC() );
+			peek = wxChar( m_in->Peek() );
 		}
 
 		// Searching the identifier
@@ -196,12 +207,12 @@ wxString TemplateParser::ParsePropertyName( wxString* child )
 	bool foundLeftCurlyBracket = false;
 	bool saveChild = (child != nullptr);
 
-	if (!m_in.Eof())
+	if (!m_in->Eof())
 	{
-		m_in.GetC();
+		m_in->GetC();
 
-		wxChar peek( m_in.Peek() );
-		while (peek != wxChar(EOF) && !m_in.Eof() && peek != wxT('#') && peek != wxT('$')
+		wxChar peek( m_in->Peek() );
+		while (peek != wxChar(EOF) && !m_in->Eof() && peek != wxT('#') && peek != wxT('$')
 			&& ( (peek >= wxT('a') && peek <= wxT('z') ) ||
 			(peek >= wxT('A') && peek <= wxT('Z') ) ||
 			(peek >= wxT('0') && peek <= wxT('9') ) ||
@@ -212,12 +223,12 @@ wxString TemplateParser::ParsePropertyName( wxString* child )
 			{
 				if ( saveChild )
 				{
-					(*child) << wxChar( m_in.GetC() );
+					(*child) << wxChar( m_in->GetC() );
 				}
 			}
 			else
 			{
-				wxChar next = wxChar( m_in.GetC() );
+				wxChar next = wxChar( m_in->GetC() );
 				if ( wxT('{') == next )
 				{
 					foundLeftCurlyBracket = true;
@@ -235,7 +246,7 @@ wxString TemplateParser::ParsePropertyName( wxString* child )
 					propname << next;
 				}
 			}
-			peek = wxChar( m_in.Peek() );
+			peek = wxChar( m_in->Peek() );
 		}
 	}
 	return propname;
@@ -273,21 +284,21 @@ bool TemplateParser::ParseText()
 	wxString text;
 	int sspace = 0;
 
-	if ( !m_in.Eof() )
+	if ( !m_in->Eof() )
 	{
-		wxChar peek( m_in.Peek() );
+		wxChar peek( m_in->Peek() );
 
-		while (peek != wxChar(EOF) && !m_in.Eof() && peek != wxT('#') && peek != wxT('$') )
+		while (peek != wxChar(EOF) && !m_in->Eof() && peek != wxT('#') && peek != wxT('$') )
 		{
-			wxChar c( m_in.GetC() );
+			wxChar c( m_in->GetC() );
 			if (c == wxT('@') )
 			{
-				c = wxChar(m_in.GetC());
+				c = wxChar(m_in->GetC());
 				if(c == wxT(' '))sspace++;
 			}
 
 			text << c;
-			peek = wxChar( m_in.Peek() );
+			peek = wxChar( m_in->Peek() );
 		}
 
 		if ( text.find_first_not_of( wxT("\r\n\t ") ) != text.npos )
@@ -314,40 +325,18 @@ bool TemplateParser::ParseInnerTemplate()
 
 PObjectBase TemplateParser::GetWxParent()
 {
-	PObjectBase wxparent, prev_wxparent;
-
-	std::vector< PObjectBase > candidates;
-	candidates.push_back( m_obj->FindNearAncestor( wxT("container") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("notebook") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("splitter") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("flatnotebook") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("listbook") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("choicebook") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("simplebook") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("auinotebook") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("toolbar") ) );
-	candidates.push_back( m_obj->FindNearAncestor( wxT("wizardpagesimple") ) );
-	candidates.push_back( m_obj->FindNearAncestorByBaseClass( wxT("wxStaticBoxSizer") ) );
-
-	for ( size_t i = 0; i < candidates.size(); i++ )
+	// The deepest of the window ancestors and the nearest wxStaticBoxSizer,
+	// unless the sizer doesn't create its children inside its static box
+	PObjectBase wxparent = m_obj->FindWxParentAncestor();
+	PObjectBase staticBoxSizer = m_obj->FindStaticBoxSizerAncestor();
+
+	if ( staticBoxSizer && ( !wxparent || staticBoxSizer->Deep() > wxparent->Deep() ) )
 	{
-		if ( !wxparent )
-		{
-			wxparent = candidates[i];
-		}
-		else
+		if ( staticBoxSizer->GetClassName() != wxT("wxStaticBoxSizer") ||
+		     staticBoxSizer->GetProperty( wxT("parent") )->GetValueAsInteger() != 0 )
 		{
-			if ( candidates[i] && candidates[i]->Deep() > wxparent->Deep() )
-			{
-				wxparent = candidates[i];
-			}
+			wxparent = staticBoxSizer;
 		}
-
-		if (wxparent && wxparent->GetClassName() == wxT("wxStaticBoxSizer") &&
-		    wxparent->GetProperty("parent")->GetValueAsInteger() == 0) {
-			wxparent = prev_wxparent;
-		}
-		prev_wxparent = wxparent;
 	}
 
 	return wxparent;
@@ -360,24 +349,7 @@ bool TemplateParser::ParseWxParent()
 	if ( wxparent )
 	{
 		PProperty property = GetRelatedProperty( wxparent );
-		//m_out << PropertyToCode(property);
-		const auto& classname = wxparent->GetClassName();
-		if (classname == wxT("wxStaticBoxSizer"))
-		{
-			// We got a wxStaticBoxSizer as parent, use the special PT_WXPARENT_SB type to
-			// generate code to get its static box
-            m_out << ValueToCode(PT_WXPARENT_SB, property->GetValue());
-		}
-		else if (classname == wxT("wxCollapsiblePane"))
-		{
-			// We got a wxCollapsiblePane as parent, use the special PT_WXPARENT_CP type to
-			// generate code to get its pane
-			m_out << ValueToCode(PT_WXPARENT_CP, property->GetValue());
-		}
-		else
-		{
-			m_out << ValueToCode(PT_WXPARENT, property->GetValue());
-		}
+		m_out << WxParentToCode( wxparent, property );
 	}
 	else
 	{
@@ -389,23 +361,60 @@ bool TemplateParser::ParseWxParent()
 	return true;
 }
 
-bool TemplateParser::ParseForm()
+wxString TemplateParser::WxParentToCode( PObjectBase wxparent, PProperty property )
 {
-	PObjectBase form (m_obj);
-	PObjectBase parent(form->GetParent());
+	const auto& classname = wxparent->GetClassName();
+	if (classname == wxT("wxStaticBoxSizer"))
+	{
+		// We got a wxStaticBoxSizer as parent, use the special PT_WXPARENT_SB type to
+		// generate code to get its static box
+		return ValueToCode(PT_WXPARENT_SB, property->GetValue());
+	}
+	else if (classname == wxT("wxCollapsiblePane"))
+	{
+		// We got a wxCollapsiblePane as parent, use the special PT_WXPARENT_CP type to
+		// generate code to get its pane
+		return ValueToCode(PT_WXPARENT_CP, property->GetValue());
+	}
+	else
+	{
+		return ValueToCode(PT_WXPARENT, property->GetValue());
+	}
+}
 
-	if ( !parent )
+namespace
+{
+	// The object below the project on the path of obj, null for the project
+	PObjectBase GetTopLevelObject( PObjectBase obj )
 	{
-		return false;
+		PObjectBase form (obj);
+		PObjectBase parent(form->GetParent());
+
+		if ( !parent )
+		{
+			return PObjectBase();
+		}
+
+		// form is a form when grandparent is null
+		PObjectBase	grandparent = parent->GetParent();
+		while ( grandparent )
+		{
+			form = parent;
+			parent = grandparent;
+			grandparent = grandparent->GetParent();
+		}
+
+		return form;
 	}
+}
 
-	// form is a form when grandparent is null
-	PObjectBase	grandparent = parent->GetParent();
-	while ( grandparent )
+bool TemplateParser::ParseForm()
+{
+	PObjectBase form = GetTopLevelObject( m_obj );
+
+	if ( !form )
 	{
-		form = parent;
-		parent = grandparent;
-		grandparent = grandparent->GetParent();
+		return false;
 	}
 
 	PProperty property = GetRelatedProperty( form );
@@ -416,7 +425,12 @@ bool TemplateParser::ParseForm()
 
 void TemplateParser::ParseLuaTable()
 {
-	const auto& project = AppData()->GetProjectData();
+	// The project of the object, which may be a snapshot and not the live one
+	PObjectBase project = m_obj;
+	for (PObjectBase parent = m_obj->GetParent(); parent; parent = parent->GetParent())
+	{
+		project = parent;
+	}
 	const auto& table = project->GetProperty(wxT("ui_table"));
 	if (table)
 	{
@@ -592,11 +606,11 @@ PProperty TemplateParser::GetProperty( wxString* childName )
 
 void TemplateParser::ignore_whitespaces()
 {
-	wxChar peek( m_in.Peek() );
-	while ( peek != wxChar(EOF) && !m_in.Eof() && peek == wxT(' ') )
+	wxChar peek( m_in->Peek() );
+	while ( peek != wxChar(EOF) && !m_in->Eof() && peek == wxT(' ') )
 	{
-		m_in.GetC();
-		peek = wxChar( m_in.Peek() );
+		m_in->GetC();
+		peek = wxChar( m_in->Peek() );
 	}
 }
 
@@ -678,22 +692,22 @@ wxString TemplateParser::ExtractLiteral()
 	// Whitespaces at the very start are ignored
 	ignore_whitespaces();
 
-	c = wxChar(m_in.GetC()); // Initial quotation mark
+	c = wxChar(m_in->GetC()); // Initial quotation mark
 
 	if ( c == wxT('"') )
 	{
 		bool end = false;
 		// Beginning the template extraction
-		while (!end && !m_in.Eof() && m_in.Peek() != EOF )
+		while (!end && !m_in->Eof() && m_in->Peek() != EOF )
 		{
-			c = wxChar(m_in.GetC()); // obtaining one char
+			c = wxChar(m_in->GetC()); // obtaining one char
 
 			// Checking for a possible closing quotation mark
 			if ( c == wxT('"') )
 			{
-				if ( m_in.Peek() == wxT('"') ) // Char (") denoted as ("")
+				if ( m_in->Peek() == wxT('"') ) // Char (") denoted as ("")
 				{
-					m_in.GetC(); // Second quotation mark is ignored
+					m_in->GetC(); // Second quotation mark is ignored
 					os << wxT('"');
 				}
 				else // Closing
@@ -702,11 +716,11 @@ wxString TemplateParser::ExtractLiteral()
 
 					// All the following chars are ignored up to an space char,
 					// so we can avoid errors like "hello"world" -> "hello"
-					wxChar peek( m_in.Peek() );
-					while (peek != wxChar(EOF) && !m_in.Eof() && peek != wxT(' ') )
+					wxChar peek( m_in->Peek() );
+					while (peek != wxChar(EOF) && !m_in->Eof() && peek != wxT(' ') )
 					{
-						m_in.GetC();
-						peek = wxChar( m_in.Peek() );
+						m_in->GetC();
+						peek = wxChar( m_in->Peek() );
 					}
 				}
 			}
@@ -982,9 +996,75 @@ TemplateParser::Ident TemplateParser::SearchIdent(wxString ident)
 
 wxString TemplateParser::ParseTemplate()
 {
+	FragmentCache::Key key;
+	bool cached = GetFragmentKey( key );
+	if ( cached && FragmentCache::Find( key, m_out ) )
+	{
+		return m_out;
+	}
+
+	wxString code;
+	if ( !m_program )
+	{
+		code = ParseSource();
+	}
+	else
+	{
+		RunProgram( *m_program, nullptr );
+		code = m_out;
+	}
+
+	if ( cached )
+	{
+		FragmentCache::Store( key, code );
+	}
+	return code;
+}
+
+void TemplateParser::ParseTemplate( PCodeWriter writer )
+{
+	if ( m_cacheable && FragmentCache::IsEnabled() )
+	{
+		// The code is kept for the next generation, there's no point in streaming it
+		writer->WriteLn( ParseTemplate() );
+		return;
+	}
+
+	if ( !m_program )
+	{
+		writer->WriteLn( ParseSource() );
+		return;
+	}
+
+	RunProgram( *m_program, writer.get() );
+
+	// The last line, which WriteLn() outputs even when it is empty
+	writer->WriteLn( m_out );
+}
+
+bool TemplateParser::GetFragmentKey( FragmentCache::Key& key )
+{
+	if ( !m_cacheable || !FragmentCache::IsEnabled() || !GetCacheSettings( key.settings ) )
+	{
+		return false;
+	}
+
+	key.settings << wxT('\x01') << m_pred << wxT('\x01') << m_npred;
+	key.code = m_template;
+	FragmentCache::SetDependencies( key, m_obj );
+	return true;
+}
+
+wxString TemplateParser::ParseSource()
+{
+	if ( !m_in )
+	{
+		m_in.reset( new wxStringInputStream( m_template ) );
+	}
+
     try
     {
-        while (!m_in.Eof())
+        while (!m_in->Eof())
         {
             Token token = GetNextToken();
             switch (token)
@@ -1011,6 +1091,354 @@ wxString TemplateParser::ParseTemplate()
 	return m_out;
 }
 
+namespace
+{
+	struct ProgramFrame
+	{
+		ProgramFrame( TemplateParser* parser, PTemplateParser owner, const TemplateProgram::Block* block )
+		:
+		parser( parser ),
+		owner( owner ),
+		block( block ),
+		pc( 0 ),
+		looping( false ),
+		item( 0 )
+		{
+		}
+
+		TemplateParser*               parser;
+		PTemplateParser               owner; // keeps the parsers of nested blocks alive
+		const TemplateProgram::Block* block;
+		size_t                        pc;
+
+		// #foreach being run at pc
+		bool                    looping;
+		std::vector< wxString > items;
+		size_t                  item;
+	};
+
+	bool Contains( const std::vector< wxString >& values, const wxString& value )
+	{
+		return std::find( values.begin(), values.end(), value ) != values.end();
+	}
+}
+
+void TemplateParser::RunProgram( const TemplateProgram& program, CodeWriter* writer )
+{
+	std::vector< ProgramFrame > frames;
+	frames.push_back( ProgramFrame( this, PTemplateParser(), &program.GetMain() ) );
+
+	// The output buffer belongs to the parser of the running block
+	auto pushBlock = [&frames]( TemplateParser* caller, PTemplateParser nested, const TemplateProgram::Block* block )
+	{
+		nested->m_out.swap( caller->m_out );
+		nested->m_outStart = nested->m_out.size();
+		frames.push_back( ProgramFrame( nested.get(), nested, block ) );
+	};
+
+	while ( !frames.empty() )
+	{
+		ProgramFrame& frame = frames.back();
+		TemplateParser* parser = frame.parser;
+
+		if ( writer )
+		{
+			size_t end = parser->m_out.rfind( wxT('\n') );
+			if ( end != wxString::npos )
+			{
+				size_t begin = 0;
+				for ( size_t pos = parser->m_out.find( wxT('\n') ); pos <= end; pos = parser->m_out.find( wxT('\n'), begin ) )
+				{
+					writer->WriteLn( parser->m_out.substr( begin, pos - begin ) );
+					begin = pos + 1;
+				}
+				parser->m_out.erase( 0, begin );
+				for ( ProgramFrame& running : frames )
+				{
+					running.parser->m_outStart = ( running.parser->m_outStart > begin ? running.parser->m_outStart - begin : 0 );
+				}
+			}
+		}
+
+		if ( frame.pc >= frame.block->code.size() )
+		{
+			// The block is done, its code goes back to the macro that started it
+			if ( frames.size() > 1 )
+			{
+				ProgramFrame& caller = frames[ frames.size() - 2 ];
+				caller.parser->m_out.swap( parser->m_out );
+				if ( caller.block->code[ caller.pc ].op != TemplateProgram::OP_FOREACH )
+				{
+					caller.pc++;
+				}
+			}
+			frames.pop_back();
+			continue;
+		}
+
+		const TemplateProgram::Instruction& instruction = frame.block->code[ frame.pc ];
+		PObjectBase obj = parser->m_obj;
+
+		// False when the object the macro refers to, or its property, doesn't
+		// exist: TemplateParser reads the source differently then
+		bool compiledPath = true;
+		const TemplateProgram::Block* block = nullptr;
+
+		switch ( instruction.op )
+		{
+			case TemplateProgram::OP_TEXT:
+				parser->m_out << instruction.text;
+				break;
+
+			case TemplateProgram::OP_PROPERTY:
+			{
+				PProperty property = obj->GetProperty( instruction.atom );
+				if ( !property )
+				{
+					wxLogError( wxT("The property '%s' does not exist for objects of class '%s'"), instruction.name.c_str(), obj->GetClassName().c_str() );
+				}
+				else if ( instruction.child.empty() )
+				{
+					parser->m_out << parser->PropertyToCode( property );
+				}
+				else
+				{
+					parser->m_out << property->GetChildFromParent( instruction.child );
+				}
+				break;
+			}
+
+			case TemplateProgram::OP_WXPARENT:
+			{
+				PObjectBase wxparent = parser->GetWxParent();
+				if ( !wxparent )
+				{
+					parser->m_out << parser->RootWxParentToCode();
+					break;
+				}
+
+				PProperty property = wxparent->GetProperty( instruction.atom );
+				if ( !property )
+				{
+					compiledPath = false;
+					break;
+				}
+				parser->m_out << parser->WxParentToCode( wxparent, property );
+				break;
+			}
+
+			case TemplateProgram::OP_PARENT:
+			case TemplateProgram::OP_FORM:
+			case TemplateProgram::OP_CHILD:
+			{
+				PObjectBase relative;
+				if ( instruction.op == TemplateProgram::OP_PARENT )
+					relative = obj->GetParent();
+				else if ( instruction.op == TemplateProgram::OP_FORM )
+					relative = GetTopLevelObject( obj );
+				else if ( obj->GetChildCount() > 0 )
+					relative = obj->GetChild( 0 );
+
+				if ( !relative )
+				{
+					compiledPath = false;
+					break;
+				}
+				parser->m_out << parser->PropertyToCode( relative->GetProperty( instruction.atom ) );
+				break;
+			}
+
+			case TemplateProgram::OP_IFNOTNULL:
+			case TemplateProgram::OP_IFNULL:
+			case TemplateProgram::OP_IFEQUAL:
+			case TemplateProgram::OP_IFNOTEQUAL:
+			{
+				PObjectBase relative;
+				switch ( instruction.relative )
+				{
+					case TemplateProgram::REL_WXPARENT:
+						relative = parser->GetWxParent();
+						break;
+					case TemplateProgram::REL_PARENT:
+						relative = obj->GetParent();
+						break;
+					case TemplateProgram::REL_CHILD:
+						if ( obj->GetChildCount() > 0 )
+							relative = obj->GetChild( 0 );
+						break;
+					default:
+						relative = obj;
+						break;
+				}
+
+				PProperty property = ( relative ? relative->GetProperty( instruction.atom ) : PProperty() );
+				if ( !property )
+				{
+					compiledPath = false;
+					break;
+				}
+
+				const wxString& childName = instruction.child;
+				bool run = false;
+				if ( instruction.op == TemplateProgram::OP_IFNOTNULL )
+				{
+					run = !property->IsNull() && ( childName.empty() || !property->GetChildFromParent( childName ).empty() );
+				}
+				else if ( instruction.op == TemplateProgram::OP_IFNULL )
+				{
+					run = property->IsNull() || ( !childName.empty() && property->GetChildFromParent( childName ).empty() );
+				}
+				else
+				{
+					wxString propValue = ( childName.empty() ? property->GetValue() : property->GetChildFromParent( childName ) );
+					if ( instruction.op == TemplateProgram::OP_IFEQUAL )
+						run = Contains( instruction.values, propValue );
+					else
+						run = ( propValue != instruction.text );
+				}
+
+				if ( run )
+					block = instruction.block.get();
+				break;
+			}
+
+			case TemplateProgram::OP_IFPARENTTYPEEQUAL:
+			case TemplateProgram::OP_IFPARENTTYPENOTEQUAL:
+			case TemplateProgram::OP_IFPARENTCLASSEQUAL:
+			case TemplateProgram::OP_IFPARENTCLASSNOTEQUAL:
+			{
+				PObjectBase parent( obj->GetParent() );
+				if ( !parent )
+					break;
+
+				bool equal;
+				if ( instruction.op == TemplateProgram::OP_IFPARENTTYPEEQUAL || instruction.op == TemplateProgram::OP_IFPARENTTYPENOTEQUAL )
+					equal = Contains( instruction.values, parent->GetObjectTypeName() );
+				else
+					equal = Contains( instruction.values, parent->GetClassName() );
+
+				bool wantEqual = ( instruction.op == TemplateProgram::OP_IFPARENTTYPEEQUAL || instruction.op == TemplateProgram::OP_IFPARENTCLASSEQUAL );
+				if ( equal == wantEqual )
+					block = instruction.block.get();
+				break;
+			}
+
+			case TemplateProgram::OP_IFTYPEEQUAL:
+			case TemplateProgram::OP_IFTYPENOTEQUAL:
+				if ( Contains( instruction.values, obj->GetObjectTypeName() ) == ( instruction.op == TemplateProgram::OP_IFTYPEEQUAL ) )
+					block = instruction.block.get();
+				break;
+
+			case TemplateProgram::OP_FOREACH:
+			{
+				if ( !frame.looping )
+				{
+					PProperty property = obj->GetProperty( instruction.atom );
+					if ( !property )
+					{
+						compiledPath = false;
+						break;
+					}
+
+					frame.items.clear();
+					if (property->GetType() == PT_INTLIST || property->GetType() == PT_UINTLIST || property->GetType() == PT_INTPAIRLIST || property->GetType() == PT_UINTPAIRLIST)
+					{
+						wxStringTokenizer tkz( property->GetValue(), wxT(","));
+						while (tkz.HasMoreTokens())
+						{
+							wxString token = tkz.GetNextToken();
+							token.Trim(true);
+							token.Trim(false);
+							// Pair values get interpreted as adjacent parameters, all supported languages use comma as parameter separator
+							token.Replace(wxT(":"), wxT(", "));
+							frame.items.push_back( token );
+						}
+					}
+					else if (property->GetType() == PT_STRINGLIST)
+					{
+						wxArrayString array = property->GetValueAsArrayString();
+						for ( unsigned int i = 0 ; i < array.Count(); i++ )
+						{
+							frame.items.push_back( parser->ValueToCode( PT_WXSTRING_I18N, array[i] ) );
+						}
+					}
+					else
+					{
+						wxLogError(wxT("Property type not compatible with \"foreach\" macro"));
+						break;
+					}
+					frame.looping = true;
+					frame.item = 0;
+				}
+
+				if ( frame.item < frame.items.size() )
+				{
+					PTemplateParser nested = parser->CreateParser( parser, wxEmptyString );
+					nested->SetPredefined( frame.items[ frame.item ], wxString::Format( wxT("%i"), (int)frame.item ) );
+					frame.item++;
+					parser->m_out << wxT("\n");
+					pushBlock( parser, nested, instruction.block.get() );
+					continue;
+				}
+
+				frame.looping = false;
+				frame.items.clear();
+				break;
+			}
+
+			case TemplateProgram::OP_PRED:
+				parser->ParsePred();
+				break;
+
+			case TemplateProgram::OP_NPRED:
+				parser->ParseNPred();
+				break;
+
+			case TemplateProgram::OP_NEWLINE:
+				parser->ParseNewLine();
+				break;
+
+			case TemplateProgram::OP_APPEND:
+				parser->ReplaceAppendedBrackets();
+				break;
+
+			case TemplateProgram::OP_CLASS:
+				parser->ParseClass();
+				break;
+
+			case TemplateProgram::OP_INDENT:
+				parser->ParseIndent();
+				break;
+
+			case TemplateProgram::OP_UNINDENT:
+				parser->ParseUnindent();
+				break;
+
+			case TemplateProgram::OP_UTBL:
+				parser->ParseLuaTable();
+				break;
+		}
+
+		if ( !compiledPath )
+		{
+			// Let the parser go on from the macro, with the output and the
+			// indentation of the block so far
+			parser->m_in.reset( new wxStringInputStream( TemplateProgram::GetRemainder( *frame.block, instruction.source ) ) );
+			parser->ParseSource();
+			frame.pc = frame.block->code.size();
+		}
+		else if ( block )
+		{
+			PTemplateParser nested = parser->CreateParser( parser, wxEmptyString );
+			pushBlock( parser, nested, block );
+		}
+		else
+		{
+			frame.pc++;
+		}
+	}
+}
+
 /**
 * Obtaining the template enclosed between '@{' y '@}'.
 * Note: whitespaces at the very start will be ignored.
@@ -1026,8 +1454,8 @@ wxString TemplateParser::ExtractInnerTemplate()
 	ignore_whitespaces();
 
 	// The two following characters must be '@{'
-	c1 = wxChar(m_in.GetC());
-	c2 = wxChar(m_in.GetC());
+	c1 = wxChar(m_in->GetC());
+	c2 = wxChar(m_in->GetC());
 
 	if (c1 == wxT('@') && c2 == wxT('{') )
 	{
@@ -1036,14 +1464,14 @@ wxString TemplateParser::ExtractInnerTemplate()
 		int level = 1;
 		bool end = false;
 		// Beginning with the template extraction
-		while ( !end && !m_in.Eof() && m_in.Peek() != EOF )
+		while ( !end && !m_in->Eof() && m_in->Peek() != EOF )
 		{
-			c1 = wxChar(m_in.GetC());
+			c1 = wxChar(m_in->GetC());
 
 			// Checking if there are initial or closing braces
 			if (c1 == wxT('@') )
 			{
-				c2 = wxChar(m_in.GetC());
+				c2 = wxChar(m_in->GetC());
 
 				if (c2 == wxT('}') )
 				{
@@ -1108,18 +1536,24 @@ bool TemplateParser::ParseNewLine()
 void TemplateParser::ParseAppend()
 {
 	ignore_whitespaces();
+	ReplaceAppendedBrackets();
+}
+
+void TemplateParser::ReplaceAppendedBrackets()
+{
 	//NOTE: This macro is usually used to attach some postfix to a name to create another unique name.
 	//      If the name contains array brackets the resulting name is not a valid identifier.
 	//      You cannot simply replace all brackets, depending on how many times #append is used in a template
 	//      there might be preceeding brackets that need to be preserved. Here we assume #append is used directly
 	//      after an array name to attach something to it, we have to search for the last delimiter or start of line
 	//      and replace all brackets after this one, not before.
-	if (!m_out.empty() && m_out.GetChar(m_out.size() - 1) == wxT(']'))
+	//      Only the output of the current block is considered, it starts at m_outStart.
+	if (m_out.size() > m_outStart && m_out.GetChar(m_out.size() - 1) == wxT(']'))
 	{
 		auto pos = m_out.find_last_of(wxT(" \t\r\n.>"));
-		if (pos == wxString::npos)
+		if (pos == wxString::npos || pos < m_outStart)
 		{
-			pos = 0;
+			pos = m_outStart;
 		}
 		else
 		{
@@ -1195,8 +1629,61 @@ bool TemplateParser::IsEqual(const wxString& value, const wxString& set)
 
 
 
+const char* const VERSION = "3.9.0";
+const char* const REVISION = "";
+
 CodeGenerator::~CodeGenerator() = default;
 
+PProjectIndex CodeGenerator::GetProjectIndex( PObjectBase project )
+{
+	if ( !m_projectIndex || m_projectIndex->GetProject() != project )
+	{
+		m_projectIndex = std::make_shared< ProjectIndex >( project );
+	}
+	return m_projectIndex;
+}
+
+wxString CodeGenerator::GetOutputPath( PObjectBase project, const wxString& projectPath, const wxString& pathName )
+{
+	wxFileName path;
+	// Get the output path
+	PProperty ppath = project->GetProperty( pathName );
+
+	if ( ppath )
+	{
+		wxString pathEntry = ppath->GetValue();
+
+		if ( pathEntry.empty() )
+		{
+			THROW_WXFBEX( wxT( "You must set the \"") + pathName + wxT("\" property of the project to a valid path for output files" ) );
+		}
+
+		path = wxFileName::DirName( pathEntry );
+
+		if ( !path.IsAbsolute() )
+		{
+			if ( projectPath.empty() )
+			{
+				THROW_WXFBEX( wxT( "You must save the project when using a relative path for output files" ) );
+			}
+
+			path = wxFileName(  projectPath +
+								wxFileName::GetPathSeparator() +
+								pathEntry +
+								wxFileName::GetPathSeparator() );
+
+			path.Normalize();
+		}
+	}
+
+	if ( !path.DirExists() )
+	{
+		THROW_WXFBEX( wxT( "Invalid Path: " ) << path.GetPath() << wxT( "\nYou must set the \"") + pathName + wxT("\" property of the project to a valid path for output files" ) );
+	}
+
+	return path.GetPath( wxPATH_GET_VOLUME | wxPATH_GET_SEPARATOR );
+}
+
 
 void CodeGenerator::FindArrayObjects(PObjectBase obj, ArrayItems& arrays, bool skipRoot)
 {
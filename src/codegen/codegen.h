@@ -32,10 +32,13 @@
 #ifndef __CODEGEN__
 #define __CODEGEN__
 
+#include "fragmentcache.h"
 #include "../model/types.h"
 #include "../utils/wxfbdefs.h"
 
 #include <map>
+#include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include <wx/sstream.h>
@@ -91,13 +94,22 @@
 
 /**
 * Template Parser
+*
+* The templates of the object definitions are compiled once into a
+* TemplateProgram (see templateprogram.h) when they are loaded. The parser
+* reads the source only for the templates, or the parts of them, that have
+* no program.
 */
 class TemplateParser
 {
 private:
 	PObjectBase m_obj;
-	wxStringInputStream m_in;
+	wxString m_template;
+	PTemplateProgram m_program; // compiled m_template, if any
+	std::unique_ptr< wxStringInputStream > m_in; // created when the source is parsed
 	wxString m_out;
+	size_t m_outStart; // output of the current block, m_out is shared by the blocks of a program
+	bool m_cacheable;  // false for the parsers of nested blocks, whose output is part of another one
 	wxString m_pred;
 	wxString m_npred;
 	void ignore_whitespaces();
@@ -192,6 +204,26 @@ private:
 	PProperty GetProperty(wxString* childName = nullptr);
 	PObjectBase GetWxParent();
 	PProperty GetRelatedProperty( PObjectBase relative );
+	wxString WxParentToCode( PObjectBase wxparent, PProperty property );
+	void ReplaceAppendedBrackets();
+
+	/**
+	* Key of the code in the fragment cache, returns false if it can't be cached.
+	*/
+	bool GetFragmentKey( FragmentCache::Key& key );
+
+	/**
+	* Parses the source of the template.
+	*/
+	wxString ParseSource();
+
+	/**
+	* Runs a compiled template. Nested blocks are kept on an explicit stack,
+	* each one with its own parser as the #if and #foreach macros create them.
+	* The blocks write to a single buffer, which is passed from parser to
+	* parser. With a writer, complete lines are flushed to it as they are made.
+	*/
+	void RunProgram( const TemplateProgram& program, CodeWriter* writer );
 
 	/**
 	* Parse a macro.
@@ -212,6 +244,14 @@ private:
 	bool ParsePred();
 	bool ParseNPred();
 
+	/**
+	* Settings of the parser that change the code, for the fragment cache
+	* (see fragmentcache.h). Returns false if the code mustn't be cached, e.g.
+	* because the parser collects data while parsing. Parsers aren't cached
+	* unless they override this.
+	*/
+	virtual bool GetCacheSettings( wxString& settings ) { return false; }
+
 public:
 	TemplateParser( PObjectBase obj, wxString _template);
 	TemplateParser( const TemplateParser & that, wxString _template );
@@ -246,10 +286,58 @@ public:
 	*/
 	wxString ParseTemplate();
 
+	/**
+	* Analyzes a template writing the code straight to the writer, line by
+	* line. Same as writer->WriteLn( ParseTemplate() ), without building the
+	* whole code first.
+	*/
+	void ParseTemplate( PCodeWriter writer );
+
 	/**
 	* Set the string for the #pred and #npred macros
 	*/
 	void SetPredefined( wxString pred, wxString npred ) { m_pred = pred; m_npred = npred; }
+
+	/**
+	* Runs this program instead of parsing the template, it must have been
+	* compiled from the template given to the constructor. See
+	* CodeInfo::GetProgram().
+	*/
+	void SetProgram( PTemplateProgram program ) { m_program = program; }
+};
+
+/**
+* Lines of code in the order they are added, with hashed lookups. Used to
+* write each include line once.
+*/
+class IncludeList
+{
+public:
+	/**
+	* Adds the line, even if it is already there.
+	*/
+	void Add( const wxString& line ) { m_lines.push_back( line ); m_set.insert( line ); }
+
+	/**
+	* Adds the line if it isn't there yet. Returns false if it was.
+	*/
+	bool AddUnique( const wxString& line )
+	{
+		if ( !m_set.insert( line ).second )
+		{
+			return false;
+		}
+		m_lines.push_back( line );
+		return true;
+	}
+
+	bool Contains( const wxString& line ) const { return m_set.count( line ) > 0; }
+	bool empty() const { return m_lines.empty(); }
+	const std::vector< wxString >& GetLines() const { return m_lines; }
+
+private:
+	std::vector< wxString > m_lines;
+	std::unordered_set< wxString, wxStringHash, wxStringEqual > m_set;
 };
 
 /**
@@ -318,7 +406,37 @@ public:
 	* Returns true if it is an array and extracts the basename and the indexes of the dimensions.
 	* Returns false if it is not.
 	*/
-	bool ParseArrayName(const wxString& name, wxString& baseName, ArrayItem& item);
+	static bool ParseArrayName(const wxString& name, wxString& baseName, ArrayItem& item);
+
+	/**
+	* Shares the index of the project with other generators working on the
+	* same tree. If no index is set, GenerateCode() builds its own.
+	*/
+	void SetProjectIndex( PProjectIndex index ) { m_projectIndex = index; }
+
+	/**
+	* Sets the directory of the project file, the relative paths found in the
+	* properties are resolved against it.
+	*/
+	void SetProjectPath( const wxString& path ) { m_projectPath = path; }
+
+	/**
+	* Directory named by a path property of the project ("path",
+	* "embedded_files_path"), relative to the directory of the project file.
+	* @throw wxFBException If the property is empty or the directory does not exist.
+	*/
+	static wxString GetOutputPath( PObjectBase project, const wxString& projectPath, const wxString& pathName = wxT("path") );
+
+protected:
+	/**
+	* The index of the project, built on first use.
+	*/
+	PProjectIndex GetProjectIndex( PObjectBase project );
+
+	wxString m_projectPath;
+
+private:
+	PProjectIndex m_projectIndex;
 };
 
 
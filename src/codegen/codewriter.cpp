@@ -26,12 +26,12 @@
 
 #include "codewriter.h"
 
-#include "../md5/md5.hh"
+#include "generationmanifest.h"
 #include "../utils/typeconv.h"
 #include "../utils/wxfbexception.h"
 
 #include <wx/file.h>
-#include <wx/regex.h>
+#include <wx/filename.h>
 #include <wx/tokenzr.h>
 #include <wx/stc/stc.h>
 
@@ -74,7 +74,7 @@ bool CodeWriter::IsSingleLine(const wxString& code) const
 
 void CodeWriter::ProcessLine(wxString line, bool rawIndents)
 {
-	static const wxRegEx reIndent = wxRegEx(wxT("%TAB%\\s*"), wxRE_ADVANCED);
+	static const wxString indentMarker = wxT("%TAB%");
 
 	// Cleanup whitespace
 	if (!rawIndents)
@@ -82,11 +82,25 @@ void CodeWriter::ProcessLine(wxString line, bool rawIndents)
 		line.Trim(false);
 	}
 	line.Trim();
-	// Remove and count indentations defined in code templates by #indent and #unindent macros to use own indentation mode
-	auto templateIndents = reIndent.Replace(&line, wxT(""));
-	if (templateIndents < 0)
+	// Remove and count indentations defined in code templates by #indent and #unindent macros to use own indentation mode,
+	// the markers and the whitespace following them are dropped in a single pass over the line
+	int templateIndents = 0;
+	auto pos = line.find(indentMarker);
+	if (pos != wxString::npos)
 	{
-		templateIndents = 0;
+		wxString stripped;
+		stripped.reserve(line.size());
+		size_t start = 0;
+		for (; pos != wxString::npos; pos = line.find(indentMarker, start))
+		{
+			stripped.append(line, start, pos - start);
+			++templateIndents;
+			for (start = pos + indentMarker.size(); start < line.size() && wxIsspace(line[start]); ++start)
+			{
+			}
+		}
+		stripped.append(line, start, wxString::npos);
+		line.swap(stripped);
 	}
 
 	m_indent += templateIndents;
@@ -136,6 +150,17 @@ void CodeWriter::Write(const wxString& code, bool rawIndents)
 	DoWrite(code);
 }
 
+void CodeWriter::WriteFormatted(const wxString& code)
+{
+	if (code.empty())
+	{
+		return;
+	}
+
+	DoWrite(code);
+	m_isLineWriting = false;
+}
+
 void CodeWriter::SetIndentWithSpaces( bool on )
 {
 	m_indent_with_spaces = on;
@@ -188,66 +213,96 @@ const wxString& StringCodeWriter::GetString() const
 	return m_buffer;
 }
 
-FileCodeWriter::FileCodeWriter(const wxString& file, bool useMicrosoftBOM, bool useUtf8)
+void StringCodeWriter::SetString(const wxString& code)
+{
+	m_buffer = code;
+}
+
+FileCodeWriter::FileCodeWriter(const wxString& file, bool useMicrosoftBOM, bool useUtf8, PGenerationManifest manifest)
 :
 m_filename(file),
 m_useMicrosoftBOM(useMicrosoftBOM),
-m_useUtf8(useUtf8)
+m_useUtf8(useUtf8),
+m_manifest(manifest),
+m_written(false)
 {
 	Clear();
 }
 
 FileCodeWriter::~FileCodeWriter()
 {
-	WriteBuffer();
+	if (!m_written)
+	{
+		WriteBuffer();
+	}
 }
 
-void FileCodeWriter::WriteBuffer()
+std::string FileCodeWriter::Encode(const wxString& code, bool useMicrosoftBOM, bool useUtf8)
 {
-	static const unsigned char MICROSOFT_BOM[3] = { 0xEF, 0xBB, 0xBF };
+	static const char MICROSOFT_BOM[3] = { '\xEF', '\xBB', '\xBF' };
 
-	const std::string& data = (m_useUtf8 ? _STDSTR(m_buffer) : _ANSISTR(m_buffer));
+	std::string data;
+	if (useUtf8 && useMicrosoftBOM)
+	{
+		data.assign(MICROSOFT_BOM, 3);
+	}
+	data += (useUtf8 ? _STDSTR(code) : _ANSISTR(code));
+	return data;
+}
 
-	// Compare buffer with existing file (if any) to determine if
-	// writing the file is necessary
-	bool shouldWrite = true;
-	std::ifstream fileIn(m_filename.mb_str(wxConvFile), std::ios::binary | std::ios::in);
+bool FileCodeWriter::WriteBuffer()
+{
+	m_written = true;
+	const std::string data = Encode(m_buffer, m_useMicrosoftBOM, m_useUtf8);
 
-	if (fileIn)
+	// Compare buffer with existing file (if any) to determine if writing the
+	// file is necessary, the manifest knows without reading the file
+	GenerationManifest::Match match = (m_manifest ? m_manifest->Compare(m_filename, data) : GenerationManifest::MATCH_UNKNOWN);
+	if (match == GenerationManifest::MATCH_UNKNOWN)
 	{
-		MD5 diskHash(fileIn);
-		unsigned char* diskDigest = diskHash.raw_digest();
-
-		MD5 bufferHash;
-		if (m_useUtf8 && m_useMicrosoftBOM)
+		match = (HasContent(m_filename, data) ? GenerationManifest::MATCH_SAME : GenerationManifest::MATCH_DIFFERENT);
+		if (match == GenerationManifest::MATCH_SAME && m_manifest)
 		{
-			bufferHash.update(MICROSOFT_BOM, 3);
+			m_manifest->Update(m_filename, data);
 		}
-		bufferHash.update(reinterpret_cast<const unsigned char*>(data.c_str()), data.size());
-		bufferHash.finalize();
-		unsigned char* bufferDigest = bufferHash.raw_digest();
+	}
 
-		shouldWrite = (0 != std::memcmp(diskDigest, bufferDigest, 16));
+	if (match == GenerationManifest::MATCH_SAME)
+	{
+		return true;
+	}
 
-		delete[] diskDigest;
-		delete[] bufferDigest;
+	wxTempFile fileOut;
+	if (!fileOut.Open(m_filename) || !fileOut.Write(data.c_str(), data.length()) || !fileOut.Commit())
+	{
+		wxLogError( _("Unable to create file: %s"), m_filename.c_str() );
+		return false;
 	}
 
-	if (shouldWrite)
+	if (m_manifest)
 	{
-		wxFile fileOut;
-		if (!fileOut.Create(m_filename, true))
-		{
-			wxLogError( _("Unable to create file: %s"), m_filename.c_str() );
-			return;
-		}
+		m_manifest->Update(m_filename, data);
+	}
+	return true;
+}
 
-		if (m_useUtf8 && m_useMicrosoftBOM)
-		{
-			fileOut.Write(MICROSOFT_BOM, 3);
-		}
-		fileOut.Write(data.c_str(), data.length());
+bool FileCodeWriter::IsUpToDate(const wxString& file, const wxString& code, bool useMicrosoftBOM, bool useUtf8)
+{
+	return HasContent(file, Encode(code, useMicrosoftBOM, useUtf8));
+}
+
+bool FileCodeWriter::HasContent(const wxString& file, const std::string& data)
+{
+	// Different sizes need no reading
+	wxULongLong size = wxFileName::GetSize(file);
+	if (size == wxInvalidSize || size != wxULongLong(data.size()))
+	{
+		return false;
 	}
+
+	std::ifstream fileIn(file.mb_str(wxConvFile), std::ios::binary | std::ios::in);
+	std::string content(data.size(), '\0');
+	return (fileIn.read(&content[0], content.size()) && content == data);
 }
 
 void FileCodeWriter::Clear()
@@ -264,8 +319,8 @@ void FileCodeWriter::Clear()
 	}
 	else
 	{
-		wxFile file;
-		if ( !file.Create( m_filename, true ) )
+		// The file is created when it is written, check it can be
+		if ( !wxFileName( m_filename ).IsDirWritable() )
 		{
 			THROW_WXFBEX( _("Unable to create file: ") << m_filename );
 		}
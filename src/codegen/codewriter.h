@@ -26,6 +26,11 @@
 #ifndef __CODE_WRITER__
 #define __CODE_WRITER__
 
+#include "../utils/wxfbdefs.h"
+
+#include <functional>
+#include <string>
+
 #include <wx/string.h>
 
 /** Abstracts the code generation from the target.
@@ -101,6 +106,15 @@ public:
 	 */
 	void Write(const wxString& code, bool rawIndents = false);
 
+	/**
+	 * Write complete lines that were already formatted by another writer
+	 *
+	 * Used to join parts of the output generated separately, the code is written as-is.
+	 *
+	 * @param code Lines of code, ending with a newline
+	 */
+	void WriteFormatted(const wxString& code);
+
 	// Sets the option to indent with spaces
 	void SetIndentWithSpaces( bool on );
 
@@ -139,6 +153,9 @@ public:
 
 	void Clear() override;
 	const wxString& GetString() const;
+
+	/// Replaces the code written so far, e.g. with code generated by another writer.
+	void SetString(const wxString& code);
 };
 
 class FileCodeWriter : public StringCodeWriter
@@ -147,15 +164,41 @@ private:
 	wxString m_filename;
 	bool m_useMicrosoftBOM;
 	bool m_useUtf8;
+	PGenerationManifest m_manifest;
+	bool m_written;
 
-protected:
-	void WriteBuffer();
+	static std::string Encode(const wxString& code, bool useMicrosoftBOM, bool useUtf8);
+	static bool HasContent(const wxString& file, const std::string& data);
 
 public:
-	FileCodeWriter(const wxString& file, bool useMicrosoftBOM = false, bool useUtf8 = true);
+	/**
+	* @param manifest What was last written, to skip unchanged files without
+	*                 reading them back. Optional.
+	*/
+	FileCodeWriter(const wxString& file, bool useMicrosoftBOM = false, bool useUtf8 = true, PGenerationManifest manifest = PGenerationManifest());
 	~FileCodeWriter() override;
 
 	void Clear() final;
+
+	/**
+	* Writes the file if its content changed. The file is written aside and
+	* renamed over the old one, so it is never left half written. Returns
+	* false if it could not be written. The destructor writes the file if
+	* this was not called.
+	*/
+	bool WriteBuffer();
+
+	/**
+	* Whether the file already holds the code, encoded as this writer would
+	* write it. Nothing is written.
+	*/
+	static bool IsUpToDate(const wxString& file, const wxString& code, bool useMicrosoftBOM = false, bool useUtf8 = true);
 };
 
+/**
+* Creates the writer of a file generated besides the main ones, e.g. for an
+* embedded bitmap, so that the caller decides when the file is written.
+*/
+typedef std::function< PCodeWriter( const wxString& file, bool useMicrosoftBOM, bool useUtf8 ) > CodeWriterFactory;
+
 #endif //__CODE_WRITER__
@@ -25,24 +25,28 @@
 
 #include "cppcg.h"
 
+#include "../model/database.h"
 #include "../model/objectbase.h"
-#include "../rad/appdata.h"
 #include "../utils/filetocarray.h"
 #include "../utils/typeconv.h"
 #include "../utils/wxfbexception.h"
 #include "codewriter.h"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
 
 #include <wx/filename.h>
 #include <wx/tokenzr.h>
 
-CppTemplateParser::CppTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath )
+CppTemplateParser::CppTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString projectPath )
 		:
 		TemplateParser( obj, _template ),
 		m_i18n( useI18N ),
 		m_useRelativePath( useRelativePath ),
-		m_basePath( basePath )
+		m_basePath( basePath ),
+		m_projectPath( projectPath )
 {
 	if ( !wxFileName::DirExists( m_basePath ) )
 	{
@@ -55,7 +59,8 @@ CppTemplateParser::CppTemplateParser( const CppTemplateParser & that, wxString _
 		TemplateParser( that, _template ),
 		m_i18n( that.m_i18n ),
 		m_useRelativePath( that.m_useRelativePath ),
-		m_basePath( that.m_basePath )
+		m_basePath( that.m_basePath ),
+		m_projectPath( that.m_projectPath )
 {
 }
 
@@ -64,6 +69,13 @@ wxString CppTemplateParser::RootWxParentToCode()
 	return wxT( "this" );
 }
 
+bool CppTemplateParser::GetCacheSettings( wxString& settings )
+{
+	// Bitmap paths depend on the location of the project too
+	settings << ( m_i18n ? wxT( "1" ) : wxT( "0" ) ) << ( m_useRelativePath ? wxT( "1" ) : wxT( "0" ) ) << m_basePath << wxT( '\x01' ) << m_projectPath;
+	return true;
+}
+
 PTemplateParser CppTemplateParser::CreateParser( const TemplateParser* oldparser, wxString _template )
 {
 	const CppTemplateParser* cppOldParser = dynamic_cast< const CppTemplateParser* >( oldparser );
@@ -249,7 +261,7 @@ wxString CppTemplateParser::ValueToCode( PropertyType type, wxString value )
 				wxString absPath;
 				try
 				{
-					absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
+					absPath = TypeConv::MakeAbsolutePath( path, m_projectPath );
 				}
 				catch ( wxFBException& ex )
 				{
@@ -276,7 +288,7 @@ wxString CppTemplateParser::ValueToCode( PropertyType type, wxString value )
 				wxString absPath;
 				try
 				{
-					absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
+					absPath = TypeConv::MakeAbsolutePath( path, m_projectPath );
 				}
 				catch ( wxFBException& ex )
 				{
@@ -352,8 +364,13 @@ CppCodeGenerator::CppCodeGenerator()
 {
 	SetupPredefinedMacros();
 	m_useRelativePath = false;
+	m_useArrayEnum = false;
+	m_useArrayLoops = false;
+	m_useForwardDeclarations = false;
+	m_useLayoutTables = false;
 	m_i18n = false;
 	m_firstID = 1000;
+	m_maxThreads = std::max( 1u, std::thread::hardware_concurrency() );
 }
 
 wxString CppCodeGenerator::ConvertCppString( wxString text )
@@ -477,8 +494,7 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	m_source->WriteLn( wxT("}") );
 
 	// Do events in both files
-	EventVector events;
-	FindEventHandlers( form, events );
+	EventVector events = ProjectIndex::IndexForm( form ).events;
 
 	if ( events.size() > 0 )
 	{
@@ -566,6 +582,32 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	}
 }
 
+wxString CppCodeGenerator::GetGeneratedComment()
+{
+	return wxString::Format(
+		wxT("///////////////////////////////////////////////////////////////////////////\n")
+		wxT("// C++ code generated with wxFormBuilder (version %s%s ") wxT(__DATE__) wxT(")\n")
+		wxT("// http://www.wxformbuilder.org/\n")
+		wxT("//\n")
+		wxT("// PLEASE DO *NOT* EDIT THIS FILE!\n")
+		wxT("///////////////////////////////////////////////////////////////////////////\n"),
+		VERSION, REVISION
+	);
+}
+
+void CppCodeGenerator::GenerateFormsHeader( const std::vector< wxString >& headers )
+{
+	m_header->Clear();
+	m_header->WriteLn( GetGeneratedComment() );
+	m_header->WriteLn( wxT("#pragma once") );
+	m_header->WriteLn( wxEmptyString );
+
+	for ( const wxString& header : headers )
+	{
+		m_header->WriteLn( wxT( "#include \"" ) + header + wxT( "\"" ) );
+	}
+}
+
 bool CppCodeGenerator::GenerateCode( PObjectBase project )
 {
 	if ( !project )
@@ -587,6 +629,10 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 		m_useArrayEnum = true;
 	}
 
+	m_useArrayLoops = ( project->GetPropertyAsInteger( wxT("use_array_loops") ) != 0 );
+	m_useForwardDeclarations = ( project->GetPropertyAsInteger( wxT("use_forward_declarations") ) != 0 );
+	m_useLayoutTables = ( project->GetPropertyAsInteger( wxT("use_layout_tables") ) != 0 );
+
 	m_i18n = false;
 	PProperty i18nProperty = project->GetProperty( wxT( "internationalize" ) );
 	if ( i18nProperty && i18nProperty->GetValueAsInteger() )
@@ -597,15 +643,7 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 
 	m_header->Clear();
 	m_source->Clear();
-	wxString code = wxString::Format(
-		wxT("///////////////////////////////////////////////////////////////////////////\n")
-		wxT("// C++ code generated with wxFormBuilder (version %s%s ") wxT(__DATE__) wxT(")\n")
-		wxT("// http://www.wxformbuilder.org/\n")
-		wxT("//\n")
-		wxT("// PLEASE DO *NOT* EDIT THIS FILE!\n")
-		wxT("///////////////////////////////////////////////////////////////////////////\n"),
-		VERSION, REVISION
-	);
+	wxString code = GetGeneratedComment();
 
 	m_header->WriteLn( code );
 	m_source->WriteLn( code );
@@ -632,12 +670,15 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 		m_header->WriteLn( code );
 	}
 
+	// What is needed from the whole project, in one go
+	PProjectIndex index = GetProjectIndex( project );
+
 	// Generate the subclass sets
 	std::set< wxString > subclasses;
 	std::set< wxString > subclassSourceIncludes;
-	std::vector< wxString > headerIncludes;
+	IncludeList headerIncludes;
 
-	GenSubclassSets( project, &subclasses, &subclassSourceIncludes, &headerIncludes );
+	GenSubclassSets( *index, &subclasses, &subclassSourceIncludes, &headerIncludes );
 
 	// Write the forward declaration lines
 	std::set< wxString >::iterator subclass_it;
@@ -652,11 +693,20 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 
 	// Generating in the .h header file those include from components dependencies.
 	std::set< wxString > templates;
-	GenIncludes( project, &headerIncludes, &templates );
+	IncludeList sourceIncludes;
+	std::set< wxString > declarations;
+	if ( m_useForwardDeclarations )
+	{
+		GenForwardDeclarations( *index, &headerIncludes, &sourceIncludes, &declarations );
+	}
+	else
+	{
+		GenIncludes( *index, &headerIncludes, &templates );
+	}
 
 	// Write the include lines
-	std::vector<wxString>::iterator include_it;
-	for ( include_it = headerIncludes.begin(); include_it != headerIncludes.end(); ++include_it )
+	std::vector<wxString>::const_iterator include_it;
+	for ( include_it = headerIncludes.GetLines().begin(); include_it != headerIncludes.GetLines().end(); ++include_it )
 	{
 		m_header->WriteLn( *include_it );
 	}
@@ -665,6 +715,16 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 		m_header->WriteLn(wxEmptyString);
 	}
 
+	// Write the declarations of the classes of the members
+	for ( const wxString& declaration : declarations )
+	{
+		m_header->WriteLn( declaration );
+	}
+	if ( !declarations.empty() )
+	{
+		m_header->WriteLn(wxEmptyString);
+	}
+
 	// class decoration
 	PProperty propClassDecoration = project->GetProperty( wxT( "class_decoration" ) );
 	wxString classDecoration;
@@ -696,8 +756,7 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 			if ( !headerVal.empty() )
 			{
 				wxString include = wxT( "#include \"" ) + headerVal + wxT( "\"" );
-				std::vector< wxString >::iterator findInclude = std::find( headerIncludes.begin(), headerIncludes.end(), include );
-				if ( findInclude == headerIncludes.end() )
+				if ( !headerIncludes.Contains( include ) )
 				{
 					m_header->WriteLn( include );
 					m_header->WriteLn( wxEmptyString );
@@ -732,12 +791,35 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 	// Generated header
 	m_source->WriteLn( wxT( "#include \"" ) + file + wxT( ".h\"" ) );
 
+	// Headers of the members that the header only declares
+	if ( !sourceIncludes.empty() )
+	{
+		m_source->WriteLn( wxEmptyString );
+	}
+	for ( const wxString& include : sourceIncludes.GetLines() )
+	{
+		m_source->WriteLn( include );
+	}
+
 	m_source->WriteLn( wxEmptyString );
-	GenEmbeddedBitmapIncludes( project );
+	GenEmbeddedBitmapIncludes( *index );
 
 	code = GetCode( project, wxT( "cpp_epilogue" ) );
 	m_source->WriteLn( code );
 
+	// Only if a sizer adds its items from a table
+	if ( m_useLayoutTables )
+	{
+		for ( const PObjectBase& obj : index->GetObjects() )
+		{
+			if ( obj->GetObjectInfo()->IsSubclassOf( wxT("sizer") ) && CanUseLayoutTable( obj ) )
+			{
+				GenLayoutTableRuntime();
+				break;
+			}
+		}
+	}
+
 	// namespace
 	PProperty propNamespace = project->GetProperty( wxT( "namespace" ) );
 	wxArrayString namespaceArray;
@@ -772,27 +854,10 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 	// Generating "defines" for macros
 	if ( !useEnum )
 	{
-		GenDefines( project );
+		GenDefines( *index );
 	}
 
-	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
-	{
-		PObjectBase child = project->GetChild( i );
-
-		// Preprocess to find arrays
-		ArrayItems arrays;
-		FindArrayObjects(child, arrays, true);
-
-		EventVector events;
-		FindEventHandlers( child, events );
-		GenClassDeclaration(child, useEnum, classDecoration, events, arrays);
-		if ( !m_useConnect )
-		{
-			GenEvents( child, events );
-		}
-		GenConstructor(child, events, arrays);
-		GenDestructor( child, events );
-	}
+	GenFormClasses( *index, useEnum, classDecoration, namespaceArray.Count() );
 
 	// namespace
 	if ( namespaceArray.Count() > 0 )
@@ -808,6 +873,103 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 	return true;
 }
 
+void CppCodeGenerator::GenFormClass( const ProjectIndex::FormIndex& form, bool useEnum, const wxString& classDecoration )
+{
+	PObjectBase child = form.form;
+
+	// The declaration state of the arrays is per class
+	ArrayItems arrays = form.arrays;
+	const EventVector& events = form.events;
+	GenClassDeclaration(child, useEnum, classDecoration, events, form.macros, arrays);
+	if ( !m_useConnect )
+	{
+		GenEvents( child, events );
+	}
+	GenConstructor(child, events, arrays);
+	GenDestructor( child, events );
+}
+
+void CppCodeGenerator::GenFormClasses( const ProjectIndex& index, bool useEnum, const wxString& classDecoration, unsigned int headerIndent )
+{
+	const std::vector< ProjectIndex::FormIndex >& forms = index.GetForms();
+
+	size_t threads = std::min< size_t >( forms.size(), m_maxThreads );
+	if ( threads < 2 )
+	{
+		for ( const ProjectIndex::FormIndex& form : forms )
+		{
+			GenFormClass( form, useEnum, classDecoration );
+		}
+		return;
+	}
+
+	struct FormJob
+	{
+		PObjectBase       form;
+		PStringCodeWriter header;
+		PStringCodeWriter source;
+	};
+
+	// Each form gets a copy of the project object with only that form, so no
+	// object, nor the caches of its properties, is shared between threads.
+	// The tree is only changed here, before the threads start.
+	std::vector< FormJob > jobs( forms.size() );
+	for ( size_t i = 0; i < forms.size(); ++i )
+	{
+		PObjectBase project = index.GetProject()->CreateSnapshot( false );
+		jobs[ i ].form = forms[ i ].form->CreateSnapshot();
+		project->AddChild( jobs[ i ].form );
+		jobs[ i ].form->SetParent( project );
+
+		jobs[ i ].header = std::make_shared< StringCodeWriter >();
+		jobs[ i ].source = std::make_shared< StringCodeWriter >();
+		for ( unsigned int indent = 0; indent < headerIndent; ++indent )
+		{
+			jobs[ i ].header->Indent();
+		}
+	}
+
+	std::atomic< size_t > next( 0 );
+	auto work = [&]()
+	{
+		for ( size_t i = next++; i < jobs.size(); i = next++ )
+		{
+			CppCodeGenerator worker;
+			worker.m_header = jobs[ i ].header;
+			worker.m_source = jobs[ i ].source;
+			worker.m_useRelativePath = m_useRelativePath;
+			worker.m_useArrayEnum = m_useArrayEnum;
+			worker.m_useArrayLoops = m_useArrayLoops;
+			worker.m_useLayoutTables = m_useLayoutTables;
+			worker.m_i18n = m_i18n;
+			worker.m_basePath = m_basePath;
+			worker.m_projectPath = m_projectPath;
+			worker.m_firstID = m_firstID;
+			worker.m_useConnect = m_useConnect;
+			worker.m_disconnectEvents = m_disconnectEvents;
+			worker.GenFormClass( ProjectIndex::IndexForm( jobs[ i ].form ), useEnum, classDecoration );
+		}
+	};
+
+	std::vector< std::future< void > > results;
+	for ( size_t i = 1; i < threads; ++i )
+	{
+		results.push_back( std::async( std::launch::async, work ) );
+	}
+	work();
+	for ( std::future< void >& result : results )
+	{
+		result.get();
+	}
+
+	// Same output as if they were generated one after the other
+	for ( const FormJob& job : jobs )
+	{
+		m_header->WriteFormatted( job.header->GetString() );
+		m_source->WriteFormatted( job.source->GetString() );
+	}
+}
+
 void CppCodeGenerator::GenEvents( PObjectBase class_obj, const EventVector &events, bool disconnect )
 {
 	if ( events.empty() )
@@ -903,8 +1065,8 @@ bool CppCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info, con
 		if ( !_template.empty() )
 		{
 			_template.Replace( wxT( "#handler" ), handlerName.c_str() ); // Ugly patch!
-			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-			m_source->WriteLn( parser.ParseTemplate() );
+			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+			parser.ParseTemplate( m_source );
 			return true;
 		}
 	}
@@ -1028,7 +1190,8 @@ void CppCodeGenerator::GenValVarsBase( PObjectInfo info, PObjectBase obj )
 
 	if ( !_template.empty() )
 	{
-		CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+		CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT( "valvar_declaration" ) ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
@@ -1064,7 +1227,8 @@ void CppCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 		wxString _template = code_info->GetTemplate( wxT( "generated_event_handlers" ) );
 		if ( !_template.empty() )
 		{
-			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+			parser.SetProgram( code_info->GetProgram( wxT( "generated_event_handlers" ) ) );
 			wxString code = parser.ParseTemplate();
 
 			if ( !code.empty() )
@@ -1097,12 +1261,30 @@ wxString CppCodeGenerator::GetCode( PObjectBase obj, wxString name )
 
 	_template = code_info->GetTemplate( name );
 
-	CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+	CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+	parser.SetProgram( code_info->GetProgram( name ) );
 	wxString code = parser.ParseTemplate();
 
 	return code;
 }
 
+void CppCodeGenerator::WriteCode( PCodeWriter writer, PObjectBase obj, wxString name )
+{
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
+
+	if ( !code_info )
+	{
+		wxLogError( wxT( "Missing \"%s\" template for \"%s\" class. Review your XML object description" ),
+					name.c_str(), obj->GetClassName().c_str() );
+		writer->WriteLn();
+		return;
+	}
+
+	CppTemplateParser parser( obj, code_info->GetTemplate( name ), m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+	parser.SetProgram( code_info->GetProgram( name ) );
+	parser.ParseTemplate( writer );
+}
+
 wxString CppCodeGenerator::GetDeclaration(PObjectBase obj, ArrayItems& arrays, bool useEnum)
 {
 	// Get the name
@@ -1179,7 +1361,7 @@ wxString CppCodeGenerator::GetDeclaration(PObjectBase obj, ArrayItems& arrays, b
 	return code;
 }
 
-void CppCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum, const wxString& classDecoration, const EventVector &events, ArrayItems& arrays)
+void CppCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum, const wxString& classDecoration, const EventVector &events, const std::vector< wxString >& macros, ArrayItems& arrays)
 {
 	PProperty propName = class_obj->GetProperty( wxT( "name" ) );
 	if ( !propName )
@@ -1228,7 +1410,7 @@ void CppCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum,
 	m_header->Indent();
 
 	if ( use_enum )
-		GenEnumIds( class_obj );
+		GenEnumIds( macros );
 
 	GenAttributeDeclaration(class_obj, P_PROTECTED, arrays);
 
@@ -1273,7 +1455,7 @@ void CppCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum,
 	m_header->WriteLn(wxEmptyString);
 
 	// The constructor is also included within public
-	m_header->WriteLn( GetCode( class_obj, wxT( "cons_decl" ) ) );
+	WriteCode( m_header, class_obj, wxT( "cons_decl" ) );
 
 	// Destructor
 	m_header->WriteLn( wxString::Format( wxT( "~%s();" ), class_name.c_str() ) );
@@ -1287,10 +1469,10 @@ void CppCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum,
 	m_header->WriteLn(wxEmptyString);
 }
 
-void CppCodeGenerator::GenEnumIds( PObjectBase class_obj )
+void CppCodeGenerator::GenEnumIds( const std::vector< wxString >& values )
 {
 	std::vector< wxString > macros;
-	FindMacros( class_obj, &macros );
+	FindMacros( values, &macros );
 
 	std::vector< wxString >::iterator it = macros.begin();
 	if ( it != macros.end() )
@@ -1332,18 +1514,13 @@ void CppCodeGenerator::GenEnumIds( PObjectBase class_obj )
 	}
 }
 
-void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::set< wxString >* sourceIncludes, std::vector< wxString >* headerIncludes )
+void CppCodeGenerator::GenSubclassSets( const ProjectIndex& index, std::set< wxString >* subclasses, std::set< wxString >* sourceIncludes, IncludeList* headerIncludes )
 {
-	// Call GenSubclassForwardDeclarations on all children as well
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
-	{
-		GenSubclassSets( obj->GetChild( i ), subclasses, sourceIncludes, headerIncludes );
-	}
-
-	// Fill the set
-	PProperty subclass = obj->GetProperty( wxT( "subclass" ) );
-	if ( subclass )
+	// Children come before their parents, as they always did
+	for ( const PObjectBase& obj : index.GetSubclassedObjects() )
 	{
+		// Fill the set
+		PProperty subclass = obj->GetProperty( wxT( "subclass" ) );
 		std::map< wxString, wxString > children;
 		subclass->SplitParentProperty( &children );
 
@@ -1353,14 +1530,14 @@ void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 		if ( children.end() == name )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		wxString nameVal = name->second;
 		if ( nameVal.empty() )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		//check if user wants to include the header or forward declare
@@ -1402,7 +1579,7 @@ void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 							  _( "subclass" ),
 							  originalValue.c_str()
 						   );
-				return;
+				continue;
 			}
 
 			forwardDecl = subClassPrefix + wxT( "class " ) + nameVal + wxT( ";" ) + subClassSuffix;
@@ -1424,20 +1601,20 @@ void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 				subclasses->insert(forwardDecl);
 			}
 
-			return;
+			continue;
 		}
 
 		// Got a header
 		PObjectInfo info = obj->GetObjectInfo();
 		if ( !info )
 		{
-			return;
+			continue;
 		}
 
 		PObjectPackage pkg = info->GetPackage();
 		if ( !pkg )
 		{
-			return;
+			continue;
 		}
 
 		wxString include = wxT( "#include \"" ) + headerVal + wxT( "\"" );
@@ -1445,11 +1622,7 @@ void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 			 obj->GetChild( 1, wxT("menu") ) ||
 			 !forward_declare )
 		{
-			std::vector< wxString >::iterator it = std::find( headerIncludes->begin(), headerIncludes->end(), include );
-			if ( headerIncludes->end() == it )
-			{
-				headerIncludes->push_back( include );
-			}
+			headerIncludes->AddUnique( include );
 		}
 		else
 		{
@@ -1459,24 +1632,23 @@ void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 	}
 }
 
-void CppCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>* includes, std::set< wxString >* templates )
+void CppCodeGenerator::GenIncludes( const ProjectIndex& index, IncludeList* includes, std::set< wxString >* templates )
 {
-	GenObjectIncludes( project, includes, templates );
-}
-
-void CppCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
-{
-	// Call GenIncludes on all children as well
-	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
+	// The includes of the children come first
+	for ( const PObjectBase& obj : index.GetObjectsBottomUp() )
 	{
-		GenObjectIncludes( project->GetChild( i ), includes, templates );
+		GenObjectIncludes( obj, includes, templates );
 	}
+}
 
+void CppCodeGenerator::GenObjectIncludes( PObjectBase obj, IncludeList* includes, std::set< wxString >* templates )
+{
 	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
 	if ( code_info )
 	{
-		CppTemplateParser parser( project, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath );
+		CppTemplateParser parser( obj, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT( "include" ) ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1488,10 +1660,10 @@ void CppCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxSt
 	}
 
 	// Generate includes for base classes
-	GenBaseIncludes( project->GetObjectInfo(), project, includes, templates );
+	GenBaseIncludes( obj->GetObjectInfo(), obj, includes, templates );
 }
 
-void CppCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates )
+void CppCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, IncludeList* includes, std::set< wxString >* templates )
 {
 	if ( !info )
 	{
@@ -1508,7 +1680,8 @@ void CppCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 	PCodeInfo code_info = info->GetCodeInfo( wxT( "C++" ) );
 	if ( code_info )
 	{
-		CppTemplateParser parser( obj, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath );
+		CppTemplateParser parser( obj, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT( "include" ) ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1520,7 +1693,98 @@ void CppCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 	}
 }
 
-void CppCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes )
+void CppCodeGenerator::GenForwardDeclarations( const ProjectIndex& index, IncludeList* headerIncludes, IncludeList* sourceIncludes, std::set< wxString >* declarations )
+{
+	// Some ports of wxWidgets define these classes as macros, they can not be declared
+	static const std::set< wxString > aliases =
+	{
+		wxT( "wxActivityIndicator" ),
+		wxT( "wxAnimationCtrl" ),
+		wxT( "wxCalendarCtrl" ),
+		wxT( "wxCollapsiblePane" ),
+		wxT( "wxDatePickerCtrl" ),
+		wxT( "wxFileCtrl" ),
+		wxT( "wxHyperlinkCtrl" ),
+		wxT( "wxInfoBar" ),
+		wxT( "wxListCtrl" ),
+		wxT( "wxSearchCtrl" ),
+		wxT( "wxSpinCtrl" ),
+		wxT( "wxSpinCtrlDouble" ),
+		wxT( "wxStatusBar" ),
+		wxT( "wxTimePickerCtrl" ),
+		wxT( "wxToolBar" ),
+		wxT( "wxTreeCtrl" ),
+	};
+
+	std::set< wxString > headerTemplates;
+	std::set< wxString > sourceTemplates;
+
+	// The includes of the children come first
+	for ( const PObjectBase& obj : index.GetObjectsBottomUp() )
+	{
+		// The project and the forms, the base classes must be complete
+		bool inHeader = ( obj == index.GetProject() || obj->GetParent() == index.GetProject() );
+
+		// The event classes may be typedefs, they come with the header of the object
+		for ( unsigned int i = 0; i < obj->GetEventCount() && !inHeader; i++ )
+		{
+			inHeader = !obj->GetEvent( i )->GetValue().empty();
+		}
+
+		// Each line of the declaration must be a pointer to a plain class
+		std::set< wxString > classes;
+		PProperty permission = obj->GetProperty( wxT( "permission" ) );
+		if ( !inHeader && permission && permission->GetValue() != wxT( "none" ) )
+		{
+			wxStringTokenizer tkz( GetCode( obj, wxT( "declaration" ) ), wxT( "\n" ), wxTOKEN_STRTOK );
+			while ( tkz.HasMoreTokens() && !inHeader )
+			{
+				wxString line = tkz.GetNextToken();
+				line.Trim( false );
+				line.Trim( true );
+				if ( line.empty() )
+				{
+					continue;
+				}
+
+				wxString name;
+				wxString type = line.BeforeFirst( wxT( '*' ), &name ).Trim();
+				name.Trim( false );
+
+				bool valid = ( !type.empty() && !wxIsdigit( type[0] ) && name.EndsWith( wxT( ";" ) ) && aliases.count( type ) == 0 );
+				for ( wxChar c : type )
+				{
+					valid = ( valid && ( wxIsalnum( c ) || c == wxT( '_' ) ) );
+				}
+				for ( wxChar c : name.Left( name.length() - 1 ) )
+				{
+					valid = ( valid && ( wxIsalnum( c ) || c == wxT( '_' ) || c == wxT( '[' ) || c == wxT( ']' ) ) );
+				}
+
+				if ( valid )
+				{
+					classes.insert( wxT( "class " ) + type + wxT( ";" ) );
+				}
+				else
+				{
+					inHeader = true;
+				}
+			}
+		}
+
+		if ( inHeader )
+		{
+			GenObjectIncludes( obj, headerIncludes, &headerTemplates );
+		}
+		else
+		{
+			GenObjectIncludes( obj, sourceIncludes, &sourceTemplates );
+			declarations->insert( classes.begin(), classes.end() );
+		}
+	}
+}
+
+void CppCodeGenerator::AddUniqueIncludes( const wxString& include, IncludeList* includes )
 {
 	// Split on newlines to only generate unique include lines
 	// This strips blank lines and trims
@@ -1546,45 +1810,26 @@ void CppCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector<
 
 		if ( inPreproc )
 		{
-			includes->push_back( line );
+			includes->Add( line );
 			continue;
 		}
 
 		// If it is not an include line, it will be written
 		if ( !line.StartsWith( wxT( "#include" ) ) )
 		{
-			includes->push_back( line );
+			includes->Add( line );
 			continue;
 		}
 
 		// If it is an include, it must be unique to be written
-		std::vector< wxString >::iterator it = std::find( includes->begin(), includes->end(), line );
-		if ( includes->end() == it )
-		{
-			includes->push_back( line );
-		}
-	}
-}
-
-void CppCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set )
-{
-	unsigned int ch_count = obj->GetChildCount();
-	if ( ch_count > 0 )
-	{
-		unsigned int i;
-		for ( i = 0; i < ch_count; i++ )
-		{
-			PObjectBase child = obj->GetChild( i );
-			info_set.insert( child->GetObjectInfo() );
-			FindDependencies( child, info_set );
-		}
+		includes->AddUnique( line );
 	}
 }
 
 void CppCodeGenerator::GenConstructor(PObjectBase class_obj, const EventVector &events, ArrayItems& arrays)
 {
 	m_source->WriteLn();
-	m_source->WriteLn( GetCode( class_obj, wxT( "cons_def" ) ) );
+	WriteCode( m_source, class_obj, wxT( "cons_def" ) );
 	m_source->WriteLn( wxT( "{" ) );
 	m_source->Indent();
 
@@ -1668,15 +1913,33 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 			}
 		}
 
-		m_source->WriteLn( GetCode( obj, wxT( "construction" ) ) );
+		WriteCode( m_source, obj, wxT( "construction" ) );
 
 		GenSettings( obj->GetObjectInfo(), obj );
 
 		bool isWidget = !info->IsSubclassOf( wxT( "sizer" ) );
+		bool useLayoutTable = ( !isWidget && m_useLayoutTables && CanUseLayoutTable( obj ) );
 
 		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
 		{
+			if ( !isWidget && m_useArrayLoops )
+			{
+				unsigned int count = GenArrayLoop( obj, i, useLayoutTable, arrays );
+				if ( count > 0 )
+				{
+					i += count - 1;
+					continue;
+				}
+			}
+
 			PObjectBase child = obj->GetChild( i );
+			if ( useLayoutTable )
+			{
+				// The items are added all at once, after their objects are constructed
+				GenConstruction(child->GetChild(0), false, arrays);
+				continue;
+			}
+
 			GenConstruction(child, isWidget, arrays);
 
 			if ( type == wxT( "toolbar" ) )
@@ -1687,6 +1950,11 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 
 		if ( !isWidget ) // sizers
 		{
+			if ( useLayoutTable )
+			{
+				GenLayoutTable( obj );
+			}
+
 			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
 			if ( !afterAddChild.empty() )
 			{
@@ -1706,8 +1974,8 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 					wxT("#ifnull #parent $size")
 					wxT("@{ #nl $name->Fit( #wxparent $name ); @}");
 
-				CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-				m_source->WriteLn( parser.ParseTemplate() );
+				CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+				parser.ParseTemplate( m_source );
 			}
 		}
 		else if ( type == wxT( "splitter" ) )
@@ -1721,8 +1989,8 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 					wxString _template = wxT( "$name->Initialize( " );
 					_template = _template + sub1->GetProperty( wxT( "name" ) )->GetValue() + wxT( " );" );
 
-					CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-					m_source->WriteLn( parser.ParseTemplate() );
+					CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				case 2:
@@ -1744,8 +2012,8 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 					_template = _template + sub1->GetProperty( wxT( "name" ) )->GetValue() +
 								wxT( ", " ) + sub2->GetProperty( wxT( "name" ) )->GetValue() + wxT( ", $sashpos );" );
 
-					CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-					m_source->WriteLn( parser.ParseTemplate() );
+					CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				default:
@@ -1801,7 +2069,7 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 			return;
 		}
 
-		m_source->WriteLn( GetCode( obj, temp_name ) );
+		WriteCode( m_source, obj, temp_name );
 	}
 	else if ( type == wxT( "notebookpage" )		||
 			  type == wxT( "flatnotebookpage" )	||
@@ -1813,12 +2081,12 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 			)
 	{
 		GenConstruction(obj->GetChild(0), false, arrays);
-		m_source->WriteLn( GetCode( obj, wxT( "page_add" ) ) );
+		WriteCode( m_source, obj, wxT( "page_add" ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT( "treelistctrlcolumn" ) )
 	{
-		m_source->WriteLn( GetCode( obj, wxT( "column_add" ) ) );
+		WriteCode( m_source, obj, wxT( "column_add" ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT( "tool" ) )
@@ -1838,13 +2106,13 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 				if ( _("Load From Icon Resource") == source && wxDefaultSize == toolsize )
 				{
 					prop->SetValue( wxString::Format( wxT( "%s; %s [%i; %i]" ), path.c_str(), source.c_str(), toolbarsize.GetWidth(), toolbarsize.GetHeight() ) );
-					m_source->WriteLn( GetCode( obj, wxT( "construction" ) ) );
+					WriteCode( m_source, obj, wxT( "construction" ) );
 					prop->SetValue( oldVal );
 					return;
 				}
 			}
 		}
-		m_source->WriteLn( GetCode( obj, wxT( "construction" ) ) );
+		WriteCode( m_source, obj, wxT( "construction" ) );
 	}
 	else
 	{
@@ -1856,57 +2124,608 @@ void CppCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 	}
 }
 
-void CppCodeGenerator::FindMacros( PObjectBase obj, std::vector<wxString>* macros )
+namespace
 {
-	// iterate through all of the properties of all objects, add the macros
-	// to the vector
-	unsigned int i;
+	/**
+	* Range of a token in a piece of generated code.
+	*/
+	struct CodeToken
+	{
+		size_t start;
+		size_t length;
+	};
+
+	/**
+	* Splits generated code in identifiers, numbers, literals, comments and
+	* single punctuation characters, the white space is skipped.
+	*/
+	std::vector< CodeToken > TokenizeCode( const std::wstring& code )
+	{
+		std::vector< CodeToken > tokens;
+		size_t i = 0;
+		while ( i < code.length() )
+		{
+			const wchar_t c = code[ i ];
+			const size_t start = i++;
+			if ( wxIsspace( c ) )
+			{
+				continue;
+			}
 
-	for ( i = 0; i < obj->GetPropertyCount(); i++ )
+			if ( c == L'"' || c == L'\'' )
+			{
+				for ( ; i < code.length() && code[ i ] != c; ++i )
+				{
+					if ( code[ i ] == L'\\' )
+					{
+						++i;
+					}
+				}
+				i = std::min( i + 1, code.length() );
+			}
+			else if ( c == L'/' && i < code.length() && code[ i ] == L'/' )
+			{
+				i = std::min( code.find( L'\n', i ), code.length() );
+			}
+			else if ( wxIsalnum( c ) || c == L'_' )
+			{
+				const bool isNumber = ( wxIsdigit( c ) != 0 );
+				while ( i < code.length() && ( wxIsalnum( code[ i ] ) || code[ i ] == L'_' || ( isNumber && code[ i ] == L'.' ) ) )
+				{
+					++i;
+				}
+			}
+			tokens.push_back( { start, i - start } );
+		}
+		return tokens;
+	}
+
+	bool IsInteger( const std::wstring& token )
+	{
+		return !token.empty() && token.find_first_not_of( L"0123456789" ) == std::wstring::npos;
+	}
+
+	/**
+	* Turns the leading tabs of generated lines into indentation markers, so
+	* the code keeps its indentation when written again by another writer.
+	*/
+	wxString MarkIndentation( const wxString& code )
 	{
-		PProperty prop = obj->GetProperty( i );
-		if ( prop->GetType() == PT_MACRO )
+		wxString lines;
+		wxStringTokenizer tkz( code, wxT( "\n" ), wxTOKEN_RET_EMPTY_ALL );
+		while ( tkz.HasMoreTokens() )
 		{
-			wxString value = prop->GetValue();
-			// Skip wx IDs
-			if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
-				 ( m_predMacros.end() == m_predMacros.find( value ) ) )
+			wxString line = tkz.GetNextToken();
+			while ( line.StartsWith( wxT( "\t" ), &line ) )
 			{
-				if ( macros->end() == std::find( macros->begin(), macros->end(), value ) )
+				lines << wxT( "%TAB% " );
+			}
+			lines << line << wxT( "\n" );
+		}
+		lines.RemoveLast();
+		return lines;
+	}
+}
+
+unsigned int CppCodeGenerator::GenArrayLoop( PObjectBase sizer, unsigned int first, bool useLayoutTable, ArrayItems& arrays )
+{
+	// The elements of the array, next to each other
+	std::vector< PObjectBase > items;
+	wxString arrayName;
+	PObjectInfo arrayInfo;
+	for ( unsigned int i = first; i < sizer->GetChildCount(); i++ )
+	{
+		PObjectBase item = sizer->GetChild( i );
+		if ( item->GetClassName() != wxT( "sizeritem" ) || item->GetChildCount() != 1 )
+		{
+			break;
+		}
+
+		// Elements declared in the constructor would need their declaration in the loop
+		PObjectBase element = item->GetChild( 0 );
+		PProperty name = element->GetProperty( wxT( "name" ) );
+		PProperty permission = element->GetProperty( wxT( "permission" ) );
+		wxString baseName;
+		ArrayItem index;
+		if ( !name || !permission || permission->GetValue() == wxT( "none" ) || element->GetChildCount() != 0 ||
+			 !ParseArrayName( name->GetValue(), baseName, index ) )
+		{
+			break;
+		}
+
+		if ( items.empty() )
+		{
+			arrayName = baseName;
+			arrayInfo = element->GetObjectInfo();
+		}
+		else if ( baseName != arrayName || element->GetObjectInfo() != arrayInfo )
+		{
+			break;
+		}
+		items.push_back( item );
+	}
+
+	if ( items.size() < 2 )
+	{
+		return 0;
+	}
+
+	// The code of each element, as it would be generated
+	std::vector< std::wstring > codes;
+	std::vector< std::vector< CodeToken > > tokens;
+	PCodeWriter source = m_source;
+	try
+	{
+		for ( const PObjectBase& item : items )
+		{
+			PStringCodeWriter writer = std::make_shared< StringCodeWriter >();
+			m_source = writer;
+			GenConstruction( ( useLayoutTable ? item->GetChild( 0 ) : item ), false, arrays );
+			codes.push_back( writer->GetString().ToStdWstring() );
+			tokens.push_back( TokenizeCode( codes.back() ) );
+		}
+	}
+	catch ( ... )
+	{
+		m_source = source;
+		throw;
+	}
+	m_source = source;
+
+	auto token = [&codes, &tokens]( size_t element, size_t position )
+	{
+		const CodeToken& range = tokens[ element ][ position ];
+		return codes[ element ].substr( range.start, range.length );
+	};
+
+	// What is different between the elements becomes a column of the table,
+	// or the index of the loop
+	struct Column
+	{
+		size_t                  from;   // first token replaced
+		size_t                  to;     // last token replaced
+		wxString                code;   // what replaces them
+		wxString                type;   // empty for the index of the loop
+		std::vector< wxString > values;
+	};
+	std::vector< Column > columns;
+
+	const std::vector< CodeToken >& model = tokens.front();
+	bool loop = true;
+	for ( size_t i = 1; i < items.size() && loop; i++ )
+	{
+		loop = ( tokens[ i ].size() == model.size() );
+	}
+
+	for ( size_t p = 0; p < model.size() && loop; p++ )
+	{
+		std::vector< std::wstring > values;
+		bool differs = false;
+		for ( size_t i = 0; i < items.size(); i++ )
+		{
+			values.push_back( token( i, p ) );
+			differs = ( differs || values[ i ] != values[ 0 ] );
+		}
+		if ( !differs )
+		{
+			continue;
+		}
+
+		Column column;
+		column.from = p;
+		column.to = p;
+		const wxString field = wxString::Format( wxT( "%sValues[i].v%u" ), arrayName, (unsigned int)columns.size() );
+
+		bool isIndex = true;
+		bool isInteger = true;
+		bool isLiteral = true;
+		bool isId = true;
+		for ( size_t i = 0; i < items.size(); i++ )
+		{
+			isIndex = ( isIndex && values[ i ] == std::to_wstring( i ) );
+			isInteger = ( isInteger && IsInteger( values[ i ] ) );
+			isLiteral = ( isLiteral && values[ i ][ 0 ] == L'"' );
+
+			// Identifiers are only taken when they are the value of a macro property, an id
+			bool found = false;
+			PObjectBase element = items[ i ]->GetChild( 0 );
+			for ( unsigned int j = 0; j < element->GetPropertyCount() && !found; j++ )
+			{
+				PProperty prop = element->GetProperty( j );
+				found = ( prop->GetType() == PT_MACRO && prop->GetValue() == wxString( values[ i ] ) );
+			}
+			isId = ( isId && found );
+		}
+
+		if ( isIndex )
+		{
+			column.code = wxT( "i" );
+		}
+		else if ( isInteger || isId )
+		{
+			column.type = wxT( "int" );
+			column.code = field;
+		}
+		else if ( isLiteral )
+		{
+			const bool isWrapped = ( p >= 2 && p + 1 < model.size() && token( 0, p - 1 ) == L"(" && token( 0, p + 1 ) == L")" );
+			const std::wstring wrapper = ( isWrapped ? token( 0, p - 2 ) : std::wstring() );
+			if ( wrapper == L"wxT" || wrapper == L"_" )
+			{
+				// The strings to translate are marked in the table and translated in the loop
+				column.from = p - 2;
+				column.to = p + 1;
+				column.type = wxT( "const wxChar*" );
+				column.code = ( wrapper == L"_" ? wxT( "wxGetTranslation( " ) + field + wxT( " )" ) : field );
+				for ( std::wstring& value : values )
 				{
-					macros->push_back( value );
+					value = ( wrapper == L"_" ? L"wxTRANSLATE(" : L"wxT(" ) + value + L")";
 				}
 			}
+			else
+			{
+				column.type = wxT( "const char*" );
+				column.code = field;
+			}
 		}
+		else
+		{
+			loop = false;
+			break;
+		}
+
+		if ( !column.type.empty() )
+		{
+			for ( const std::wstring& value : values )
+			{
+				column.values.push_back( value );
+			}
+		}
+		columns.push_back( column );
 	}
 
-	for ( i = 0; i < obj->GetChildCount(); i++ )
+	if ( !loop )
 	{
-		FindMacros( obj->GetChild( i ), macros );
+		// The elements are written as they were generated
+		for ( const std::wstring& elementCode : codes )
+		{
+			if ( !elementCode.empty() )
+			{
+				// Without the end of the last line, WriteLn() adds it
+				m_source->WriteLn( MarkIndentation( wxString( elementCode ).RemoveLast() ) );
+			}
+		}
+		return items.size();
 	}
+
+	// The code of the first element, with what differs replaced, keeping the
+	// indentation of its lines for the writer
+	const std::wstring& code = codes.front();
+	std::wstring body;
+	size_t end = 0;
+	for ( const Column& column : columns )
+	{
+		body += code.substr( end, model[ column.from ].start - end );
+		body += column.code.ToStdWstring();
+		end = model[ column.to ].start + model[ column.to ].length;
+	}
+	body += code.substr( end );
+
+	const wxString lines = MarkIndentation( wxString( body ).Trim().Trim( false ) );
+
+	unsigned int fields = 0;
+	for ( const Column& column : columns )
+	{
+		if ( !column.type.empty() )
+		{
+			fields++;
+		}
+	}
+
+	wxString count = wxString::Format( wxT( "%u" ), (unsigned int)items.size() );
+	if ( fields > 0 )
+	{
+		m_source->WriteLn( wxT( "{" ) );
+		m_source->Indent();
+		m_source->WriteLn( wxT( "static const struct" ) );
+		m_source->WriteLn( wxT( "{" ) );
+		m_source->Indent();
+		unsigned int field = 0;
+		for ( const Column& column : columns )
+		{
+			if ( !column.type.empty() )
+			{
+				m_source->WriteLn( wxString::Format( wxT( "%s v%u;" ), column.type, field++ ) );
+			}
+		}
+		m_source->Unindent();
+		m_source->WriteLn( wxT( "} " ) + arrayName + wxT( "Values[] =" ) );
+		m_source->WriteLn( wxT( "{" ) );
+		m_source->Indent();
+		for ( size_t i = 0; i < items.size(); i++ )
+		{
+			wxString row;
+			for ( const Column& column : columns )
+			{
+				if ( !column.type.empty() )
+				{
+					row << ( row.empty() ? wxT( "{ " ) : wxT( ", " ) ) << column.values[ i ];
+				}
+			}
+			m_source->WriteLn( row + wxT( " }," ) );
+		}
+		m_source->Unindent();
+		m_source->WriteLn( wxT( "};" ) );
+		count = wxT( "WXSIZEOF( " ) + arrayName + wxT( "Values )" );
+	}
+
+	m_source->WriteLn( wxT( "for ( unsigned int i = 0; i < " ) + count + wxT( "; i++ )" ) );
+	m_source->WriteLn( wxT( "{" ) );
+	m_source->Indent();
+	m_source->WriteLn( lines );
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "}" ) );
+
+	if ( fields > 0 )
+	{
+		m_source->Unindent();
+		m_source->WriteLn( wxT( "}" ) );
+	}
+
+	return items.size();
 }
 
-void CppCodeGenerator::FindEventHandlers( PObjectBase obj, EventVector &events )
+namespace
 {
-	unsigned int i;
-	for ( i = 0; i < obj->GetEventCount(); i++ )
+	/**
+	* Fewer items are shorter as Add() calls than as a table and its loop.
+	*/
+	const unsigned int MIN_LAYOUT_TABLE_ITEMS = 4;
+
+	/**
+	* Extracts the arguments that follow the object from an item template of
+	* the form "#parent $name->Add( <object>, <arguments> ); #nl".
+	*/
+	bool GetLayoutAddArgs( const wxString& _template, const wxString& object, wxString* args )
 	{
-		PEvent event = obj->GetEvent( i );
-		if ( !event->GetValue().IsEmpty() )
-			events.push_back( event );
+		static const wxString prefix = wxT( "#parent $name->Add(" );
+
+		wxString code = _template;
+		code.Trim().Trim( false );
+		if ( code.EndsWith( wxT( "#nl" ) ) )
+		{
+			code.RemoveLast( 3 );
+			code.Trim();
+		}
+		if ( !code.StartsWith( prefix ) || !code.EndsWith( wxT( ");" ) ) )
+		{
+			return false;
+		}
+		code = code.Mid( prefix.length(), code.length() - prefix.length() - 2 );
+
+		// Split at the commas outside of parentheses
+		std::vector< wxString > values( 1 );
+		int depth = 0;
+		for ( wxChar c : code )
+		{
+			if ( wxT( '(' ) == c )
+			{
+				++depth;
+			}
+			else if ( wxT( ')' ) == c )
+			{
+				--depth;
+			}
+			else if ( wxT( ',' ) == c && 0 == depth )
+			{
+				values.emplace_back();
+				continue;
+			}
+			values.back() += c;
+		}
+
+		// The object, then the proportion, the flag and the border
+		wxString objectArgs;
+		size_t count = 0;
+		for ( ; count < values.size() && objectArgs != object; ++count )
+		{
+			objectArgs += ( count > 0 ? wxT( ", " ) : wxT( "" ) ) + values[ count ].Trim().Trim( false );
+		}
+		if ( objectArgs != object || values.size() - count != 3 )
+		{
+			return false;
+		}
+
+		args->clear();
+		for ( ; count < values.size(); ++count )
+		{
+			*args += wxT( ", " ) + values[ count ].Trim().Trim( false );
+		}
+		return true;
 	}
+}
 
-	for ( i = 0; i < obj->GetChildCount(); i++ )
+bool CppCodeGenerator::GetLayoutTableRows( PObjectBase item, wxString* window, wxString* sizer, wxString* spacer )
+{
+	PCodeInfo code_info = item->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
+	if ( !code_info )
 	{
-		PObjectBase child = obj->GetChild( i );
-		FindEventHandlers( child, events );
+		return false;
+	}
+
+	wxString windowArgs, sizerArgs, spacerArgs;
+	if ( !GetLayoutAddArgs( code_info->GetTemplate( wxT( "window_add" ) ), wxT( "#child $name" ), &windowArgs ) ||
+		 !GetLayoutAddArgs( code_info->GetTemplate( wxT( "sizer_add" ) ), wxT( "#child $name" ), &sizerArgs ) ||
+		 !GetLayoutAddArgs( code_info->GetTemplate( wxT( "spacer_add" ) ), wxT( "#child $width, #child $height" ), &spacerArgs ) )
+	{
+		return false;
+	}
+
+	*window = wxT( "{ wxFB_LAYOUT_WINDOW" ) + windowArgs + wxT( ", 0, 0 }," );
+	*sizer = wxT( "{ wxFB_LAYOUT_SIZER" ) + sizerArgs + wxT( ", 0, 0 }," );
+	*spacer = wxT( "{ wxFB_LAYOUT_SPACER" ) + spacerArgs + wxT( ", #child $width, #child $height }," );
+	return true;
+}
+
+bool CppCodeGenerator::CanUseLayoutTable( PObjectBase sizer )
+{
+	if ( sizer->GetChildCount() < MIN_LAYOUT_TABLE_ITEMS )
+	{
+		return false;
+	}
+
+	// The items are added the way their templates say, or not from a table
+	wxString window, sizerRow, spacer;
+	if ( !GetLayoutTableRows( sizer->GetChild( 0 ), &window, &sizerRow, &spacer ) )
+	{
+		return false;
+	}
+
+	for ( unsigned int i = 0; i < sizer->GetChildCount(); i++ )
+	{
+		PObjectBase item = sizer->GetChild( i );
+		if ( item->GetClassName() != wxT( "sizeritem" ) || item->GetChildCount() != 1 )
+		{
+			return false;
+		}
+
+		// Custom controls may not be a wxWindow, their items keep the Add() call
+		PObjectInfo childInfo = item->GetChild( 0 )->GetObjectInfo();
+		if ( !childInfo->IsSubclassOf( wxT( "wxWindow" ) ) &&
+			 !childInfo->IsSubclassOf( wxT( "sizer" ) ) &&
+			 childInfo->GetClassName() != wxT( "spacer" ) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void CppCodeGenerator::GenLayoutTable( PObjectBase sizer )
+{
+	// The name of the sizer may be an array element
+	wxString table;
+	for ( wxChar c : sizer->GetPropertyAsString( wxT( "name" ) ) )
+	{
+		table += ( wxIsalnum( c ) ? c : wxT( '_' ) );
+	}
+
+	// CanUseLayoutTable() checked the templates of the items
+	wxString windowRow, sizerRow, spacerRow;
+	GetLayoutTableRows( sizer->GetChild( 0 ), &windowRow, &sizerRow, &spacerRow );
+
+	wxString objects;
+	m_source->WriteLn( wxT( "static const wxFBLayoutItem " ) + table + wxT( "Items[] =" ) );
+	m_source->WriteLn( wxT( "{" ) );
+	m_source->Indent();
+	for ( unsigned int i = 0; i < sizer->GetChildCount(); i++ )
+	{
+		PObjectBase item = sizer->GetChild( i );
+		PObjectBase child = item->GetChild( 0 );
+
+		wxString _template;
+		if ( child->GetObjectInfo()->IsSubclassOf( wxT( "wxWindow" ) ) )
+		{
+			_template = windowRow;
+			objects += wxT( " " ) + child->GetPropertyAsString( wxT( "name" ) ) + wxT( "," );
+		}
+		else if ( child->GetObjectInfo()->IsSubclassOf( wxT( "sizer" ) ) )
+		{
+			_template = sizerRow;
+			objects += wxT( " " ) + child->GetPropertyAsString( wxT( "name" ) ) + wxT( "," );
+		}
+		else
+		{
+			_template = spacerRow;
+			objects += wxT( " NULL," );
+		}
+
+		CppTemplateParser parser( item, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.ParseTemplate( m_source );
+	}
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "};" ) );
+
+	objects.RemoveLast();
+	m_source->WriteLn( wxT( "wxObject* const " ) + table + wxT( "Objects[] = {" ) + objects + wxT( " };" ) );
+	m_source->WriteLn( wxString::Format( wxT( "wxFBAddLayoutItems( %s, %sItems, %sObjects, WXSIZEOF( %sItems ) );" ),
+		sizer->GetPropertyAsString( wxT( "name" ) ), table, table, table ) );
+}
+
+void CppCodeGenerator::GenLayoutTableRuntime()
+{
+	m_source->WriteLn( wxT( "namespace" ) );
+	m_source->WriteLn( wxT( "{" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "enum { wxFB_LAYOUT_WINDOW, wxFB_LAYOUT_SIZER, wxFB_LAYOUT_SPACER };" ) );
+	m_source->WriteLn();
+	m_source->WriteLn( wxT( "struct wxFBLayoutItem" ) );
+	m_source->WriteLn( wxT( "{" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "int kind;" ) );
+	m_source->WriteLn( wxT( "int proportion;" ) );
+	m_source->WriteLn( wxT( "int flag;" ) );
+	m_source->WriteLn( wxT( "int border;" ) );
+	m_source->WriteLn( wxT( "int width;" ) );
+	m_source->WriteLn( wxT( "int height;" ) );
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "};" ) );
+	m_source->WriteLn();
+	m_source->WriteLn( wxT( "inline void wxFBAddLayoutItems( wxSizer* sizer, const wxFBLayoutItem* items, wxObject* const* objects, size_t count )" ) );
+	m_source->WriteLn( wxT( "{" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "for ( size_t i = 0; i < count; i++ )" ) );
+	m_source->WriteLn( wxT( "{" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "const wxFBLayoutItem& item = items[i];" ) );
+	m_source->WriteLn( wxT( "switch ( item.kind )" ) );
+	m_source->WriteLn( wxT( "{" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "case wxFB_LAYOUT_WINDOW:" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "sizer->Add( static_cast< wxWindow* >( objects[i] ), item.proportion, item.flag, item.border );" ) );
+	m_source->WriteLn( wxT( "break;" ) );
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "case wxFB_LAYOUT_SIZER:" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "sizer->Add( static_cast< wxSizer* >( objects[i] ), item.proportion, item.flag, item.border );" ) );
+	m_source->WriteLn( wxT( "break;" ) );
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "default:" ) );
+	m_source->Indent();
+	m_source->WriteLn( wxT( "sizer->Add( item.width, item.height, item.proportion, item.flag, item.border );" ) );
+	m_source->WriteLn( wxT( "break;" ) );
+	m_source->Unindent();
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "}" ) );
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "}" ) );
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "}" ) );
+	m_source->Unindent();
+	m_source->WriteLn( wxT( "}" ) );
+	m_source->WriteLn();
+}
+
+void CppCodeGenerator::FindMacros( const std::vector< wxString >& values, std::vector<wxString>* macros )
+{
+	// The values are unique already, in the order of the objects
+	for ( const wxString& value : values )
+	{
+		// Skip wx IDs
+		if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
+			 ( m_predMacros.end() == m_predMacros.find( value ) ) )
+		{
+			macros->push_back( value );
+		}
 	}
 }
 
-void CppCodeGenerator::GenDefines( PObjectBase project )
+void CppCodeGenerator::GenDefines( const ProjectIndex& index )
 {
 	std::vector< wxString > macros;
-	FindMacros( project, &macros );
+	FindMacros( index.GetMacros(), &macros );
 
 	// Remove the default macro from the set, for backward compatiblity
 	std::vector< wxString >::iterator it;
@@ -1947,7 +2766,8 @@ void CppCodeGenerator::GenSettings( PObjectInfo info, PObjectBase obj )
 
 	if ( !_template.empty() )
 	{
-		CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+		CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT( "settings" ) ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
@@ -1974,7 +2794,8 @@ void CppCodeGenerator::GenDestruction( PObjectBase obj )
 
 		if ( !_template.empty() )
 		{
-			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+			parser.SetProgram( code_info->GetProgram( wxT( "destruction" ) ) );
 			wxString code = parser.ParseTemplate();
 			if ( !code.empty() )
 			{
@@ -2012,7 +2833,8 @@ void CppCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxA
 
 	if ( !_template.empty() )
 	{
-		CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+		CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT( "toolbar_add" ) ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
@@ -2031,12 +2853,12 @@ void CppCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxA
 ///////////////////////////////////////////////////////////////////////
 
 
-void CppCodeGenerator::GenEmbeddedBitmapIncludes( PObjectBase project )
+void CppCodeGenerator::GenEmbeddedBitmapIncludes( const ProjectIndex& index )
 {
 	std::set< wxString > include_set;
 
 	// We begin obtaining the "include" list
-	FindEmbeddedBitmapProperties( project, include_set );
+	FindEmbeddedBitmapProperties( index, include_set );
 
 	if ( include_set.empty() )
 	{
@@ -2056,62 +2878,44 @@ void CppCodeGenerator::GenEmbeddedBitmapIncludes( PObjectBase project )
 	m_source->WriteLn();
 }
 
-void CppCodeGenerator::FindEmbeddedBitmapProperties( PObjectBase obj, std::set<wxString>& embedset )
+void CppCodeGenerator::FindEmbeddedBitmapProperties( const ProjectIndex& index, std::set<wxString>& embedset )
 {
-	// We go through (browse) for each property in "obj" object. If any of the
-	// PT_BITMAP type is found, then the proper "include" string is added
-	// in "set". After that, we recursively do it the same with the child objects.
-	unsigned int i, count;
-
-	count = obj->GetPropertyCount();
-
-	for ( i = 0; i < count; i++ )
-	{
-		PProperty property = obj->GetProperty( i );
-		if ( property->GetType() == PT_BITMAP )
-		{
-			wxString propValue = property->GetValue();
-
-			wxString path;
-			wxString source;
-			wxSize icoSize;
-			TypeConv::ParseBitmapWithResource( propValue, &path, &source, &icoSize );
-
-			wxFileName bmpFileName( path );
-			if ( bmpFileName.GetExt().Upper() == wxT( "XPM" ) )
-			{
-				wxString absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
-
-				// It's supposed that "path" contains an absolut path to the file
-				// and not a relative one.
-				wxString relPath = ( m_useRelativePath ? TypeConv::MakeRelativePath( absPath, m_basePath ) : absPath );
-
-				wxString inc;
-				inc << wxT( "#include \"" ) << relPath << wxT( "\"" );
-				embedset.insert( inc );
-			}
-			else if ( source == _("Load From Embedded File") )
-			{
-				wxString absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
-				wxString includePath = FileToCArray::Generate( absPath );
-				wxString inc;
-				inc << wxT( "#include \"" ) << includePath << wxT( "\"" );
-				embedset.insert( inc );
-			}
-			// NOTE: This is currently not necessary because the default code already contains this header.
-			//       Because the unique include filtering is not global this cannot be enabled without creating a duplicate entry.
-			//else if (source == _("Load From XRC"))
-			//{
-			//	embedset.insert(wxT("#include <wx/xrc/xmlres.h>"));
-			//}
-		}
-	}
-
-	count = obj->GetChildCount();
-	for ( i = 0; i < count; i++ )
-	{
-		PObjectBase child = obj->GetChild( i );
-		FindEmbeddedBitmapProperties( child, embedset );
+	// For each value of the PT_BITMAP properties of the project, the proper
+	// "include" string is added in "set".
+	for ( const wxString& propValue : index.GetBitmaps() )
+	{
+		wxString path;
+		wxString source;
+		wxSize icoSize;
+		TypeConv::ParseBitmapWithResource( propValue, &path, &source, &icoSize );
+
+		wxFileName bmpFileName( path );
+		if ( bmpFileName.GetExt().Upper() == wxT( "XPM" ) )
+		{
+			wxString absPath = TypeConv::MakeAbsolutePath( path, m_projectPath );
+
+			// It's supposed that "path" contains an absolut path to the file
+			// and not a relative one.
+			wxString relPath = ( m_useRelativePath ? TypeConv::MakeRelativePath( absPath, m_basePath ) : absPath );
+
+			wxString inc;
+			inc << wxT( "#include \"" ) << relPath << wxT( "\"" );
+			embedset.insert( inc );
+		}
+		else if ( source == _("Load From Embedded File") )
+		{
+			wxString absPath = TypeConv::MakeAbsolutePath( path, m_projectPath );
+			wxString includePath = FileToCArray::Generate( absPath, index.GetProject(), m_projectPath, m_writerFactory );
+			wxString inc;
+			inc << wxT( "#include \"" ) << includePath << wxT( "\"" );
+			embedset.insert( inc );
+		}
+		// NOTE: This is currently not necessary because the default code already contains this header.
+		//       Because the unique include filtering is not global this cannot be enabled without creating a duplicate entry.
+		//else if (source == _("Load From XRC"))
+		//{
+		//	embedset.insert(wxT("#include <wx/xrc/xmlres.h>"));
+		//}
 	}
 }
 
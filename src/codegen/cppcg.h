@@ -37,7 +37,10 @@ The value of all properties that are file or a directory paths must be absolute,
 
 #include "codegen.h"
 #include "codeparser.h"
+#include "codewriter.h"
+#include "projectindex.h"
 
+#include <algorithm>
 #include <set>
 #include <vector>
 
@@ -50,15 +53,17 @@ private:
 	bool m_i18n;
 	bool m_useRelativePath;
 	wxString m_basePath;
+	wxString m_projectPath;
 
 public:
-	CppTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath );
+	CppTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString projectPath );
 	CppTemplateParser( const CppTemplateParser & that, wxString _template );
 
 	// overrides for C++
 	PTemplateParser CreateParser(const TemplateParser* oldparser, wxString _template) override;
 	wxString RootWxParentToCode() override;
 	wxString ValueToCode(PropertyType type, wxString value) override;
+	bool GetCacheSettings( wxString& settings ) override;
 };
 
 /**
@@ -81,11 +86,16 @@ private:
 
 	bool m_useRelativePath;
 	bool m_useArrayEnum;
+	bool m_useArrayLoops;
+	bool m_useForwardDeclarations;
+	bool m_useLayoutTables;
 	bool m_i18n;
 	wxString m_basePath;
 	unsigned int m_firstID;
+	unsigned int m_maxThreads;
 	bool m_useConnect;
 	bool m_disconnectEvents;
+	CodeWriterFactory m_writerFactory;
 
 	/**
 	* Predefined macros won't generate defines.
@@ -94,11 +104,22 @@ private:
 
 	void SetupPredefinedMacros();
 
+	/**
+	* The comment at the top of the generated files.
+	*/
+	static wxString GetGeneratedComment();
+
 	/**
 	* Given an object and the name for a template, obtains the code.
 	*/
 	wxString GetCode( PObjectBase obj, wxString name);
 
+	/**
+	* Given an object and the name for a template, writes the code to the
+	* writer as it is generated. Same as writer->WriteLn( GetCode( obj, name ) ).
+	*/
+	void WriteCode( PCodeWriter writer, PObjectBase obj, wxString name );
+
 	/**
 	* Gets the declaration fragment for the specified object.
 	*
@@ -106,31 +127,21 @@ private:
 	*/
 	wxString GetDeclaration(PObjectBase obj, ArrayItems& arrays, bool useEnum);
 
-	/**
-	* Stores the project's objects classes set, for generating the includes.
-	*/
-	void FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set );
-
 	/**
 	* Stores the needed "includes" set for the PT_BITMAP properties.
 	*/
-	void FindEmbeddedBitmapProperties( PObjectBase obj, std::set< wxString >& embedset);
+	void FindEmbeddedBitmapProperties( const ProjectIndex& index, std::set< wxString >& embedset );
 
 	/**
-	* Stores all the properties for "macro" type objects, so that their
-	* related '#define' can be generated subsequently.
+	* Stores the values of the "macro" type properties found by the index
+	* that need a '#define', so that it can be generated subsequently.
 	*/
-	void FindMacros( PObjectBase obj, std::vector< wxString >* macros );
-
-	/**
-	 * Looks for "non-null" event handlers (PEvent) and collects it into a vector.
-	 */
-	void FindEventHandlers(PObjectBase obj, EventVector &events);
+	void FindMacros( const std::vector< wxString >& values, std::vector< wxString >* macros );
 
 	/**
 	* Generates classes declarations inside the header file.
 	*/
-	void GenClassDeclaration(PObjectBase class_obj, bool use_enum, const wxString& classDecoration, const EventVector &events, ArrayItems& arrays);
+	void GenClassDeclaration(PObjectBase class_obj, bool use_enum, const wxString& classDecoration, const EventVector &events, const std::vector< wxString >& macros, ArrayItems& arrays);
 
 	/**
 	* Generates the event table.
@@ -168,31 +179,54 @@ private:
 	/**
 	* Generates the '#include' section for files.
 	*/
-	void GenIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes );
+	void GenIncludes( const ProjectIndex& index, IncludeList* includes, std::set< wxString >* templates );
+	void GenObjectIncludes( PObjectBase obj, IncludeList* includes, std::set< wxString >* templates );
+	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, IncludeList* includes, std::set< wxString >* templates );
+	void AddUniqueIncludes( const wxString& include, IncludeList* includes );
+
+	/**
+	* Same as GenIncludes(), but only what the header needs is included
+	* there: the forms, the members that are not pointers and the objects
+	* with event handlers. The classes of the other members are declared
+	* and their headers are included in the source file.
+	*/
+	void GenForwardDeclarations( const ProjectIndex& index, IncludeList* headerIncludes, IncludeList* sourceIncludes, std::set< wxString >* declarations );
 
 	/**
 	* Generate a set of all subclasses to forward declare in the generated header file.
 	* Also generate sets of header files to be include in either the source or header file.
 	*/
-	void GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::set< wxString >* sourceIncludes, std::vector< wxString >* headerIncludes );
+	void GenSubclassSets( const ProjectIndex& index, std::set< wxString >* subclasses, std::set< wxString >* sourceIncludes, IncludeList* headerIncludes );
 
 	/**
 	* Generates the '#include' section for the embedded bitmap properties.
 	*/
-	void GenEmbeddedBitmapIncludes( PObjectBase project);
+	void GenEmbeddedBitmapIncludes( const ProjectIndex& index );
 
 	/**
 	* Generates the '#define' section for macros.
 	*/
-	void GenDefines( PObjectBase project);
+	void GenDefines( const ProjectIndex& index );
 
 	/**
 	* Generates an enum with wxWindow identifiers.
 	*/
-	void GenEnumIds( PObjectBase class_obj);
+	void GenEnumIds( const std::vector< wxString >& values );
+
+	/**
+	* Generates the class of a form: declaration, event table, constructor
+	* and destructor.
+	*/
+	void GenFormClass( const ProjectIndex::FormIndex& form, bool useEnum, const wxString& classDecoration );
+
+	/**
+	* Generates the classes of all the forms, in the order of the project.
+	* The forms are independent, so they are generated in parallel, each
+	* one from its own copy and into its own writers, and then joined.
+	*
+	* @param headerIndent Indentation of the header, for the namespaces.
+	*/
+	void GenFormClasses( const ProjectIndex& index, bool useEnum, const wxString& classDecoration, unsigned int headerIndent );
 
 	/**
 	* Generates the constructor for a class
@@ -210,6 +244,43 @@ private:
 	*/
 	void GenConstruction(PObjectBase obj, bool is_widget, ArrayItems& arrays);
 
+	/**
+	* Constructs the elements of an array found from the item first of a sizer
+	* in a loop over a table of what is different between them. The elements
+	* must be next to each other, of the same class, without children, and
+	* their code must differ only by literal values.
+	*
+	* @return The number of items generated, 0 if there is no such array.
+	*/
+	unsigned int GenArrayLoop( PObjectBase sizer, unsigned int first, bool useLayoutTable, ArrayItems& arrays );
+
+	/**
+	* Checks if the items of a sizer can be added from a layout table.
+	* Only plain sizer items of windows, sizers and spacers can, and only
+	* when there are enough of them for the table to be shorter.
+	*/
+	bool CanUseLayoutTable( PObjectBase sizer );
+
+	/**
+	* Builds the rows of a layout table from the window_add, sizer_add and
+	* spacer_add templates of a sizer item. Returns false if a template is
+	* not an Add() call with a proportion, a flag and a border, as the table
+	* cannot express anything else.
+	*/
+	bool GetLayoutTableRows( PObjectBase item, wxString* window, wxString* sizer, wxString* spacer );
+
+	/**
+	* Adds the items of a sizer from a layout table, the children must be
+	* constructed already. See GenLayoutTableRuntime().
+	*/
+	void GenLayoutTable( PObjectBase sizer );
+
+	/**
+	* Generates the function, local to the source file, that adds the items
+	* of the layout tables to the sizers.
+	*/
+	void GenLayoutTableRuntime();
+
 	/**
 	* Makes the objects destructions.
 	*/
@@ -290,6 +361,24 @@ public:
 	*/
 	void SetFirstID( const unsigned int id ){ m_firstID = id; }
 
+	/**
+	* Limits the threads the forms are generated on, this one included.
+	* By default all the hardware threads are used.
+	*/
+	void SetMaxThreads( unsigned int threads ) { m_maxThreads = std::max( 1u, threads ); }
+
+	/**
+	* Creates the writers of the files of the embedded bitmaps, which are
+	* written directly by default.
+	*/
+	void SetWriterFactory( const CodeWriterFactory& factory ) { m_writerFactory = factory; }
+
+	/**
+	* Generates the header that includes the headers of the forms, when each
+	* form has its own files. Only the header writer is used.
+	*/
+	void GenerateFormsHeader( const std::vector< wxString >& headers );
+
 	/**
 	* Generate the project's code
 	*/
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "fragmentcache.h"
+
+#include "../model/objectbase.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace
+{
+	// Fragments of a generation, two generations are kept
+	const size_t MAX_CACHED_FRAGMENTS = 262144;
+
+	struct KeyHash
+	{
+		size_t operator()( const FragmentCache::Key& key ) const
+		{
+			wxStringHash hash;
+			size_t result = hash( key.code );
+			result = result * 31 + hash( key.settings );
+			result = result * 31 + key.identity;
+			result = result * 31 + key.revision;
+			result = result * 31 + key.dependencies;
+			return result;
+		}
+	};
+
+	typedef std::unordered_map< FragmentCache::Key, wxString, KeyHash > FragmentMap;
+
+	FragmentMap s_fragments;
+	FragmentMap s_previous;
+	std::shared_mutex s_mutex;
+	std::atomic< bool > s_enabled( false );
+}
+
+void FragmentCache::SetDependencies( Key& key, PObjectBase obj )
+{
+	key.identity = obj->GetIdentity();
+	key.revision = obj->GetRevision();
+	key.dependencies = 0;
+
+	for ( PObjectBase parent = obj->GetParent(); parent; parent = parent->GetParent() )
+	{
+		key.dependencies = key.dependencies * 31 + parent->GetIdentity();
+		key.revision = std::max( key.revision, parent->GetRevision() );
+	}
+
+	// Separates the first child from the ancestors
+	key.dependencies = key.dependencies * 31 + 1;
+	if ( obj->GetChildCount() > 0 )
+	{
+		PObjectBase child = obj->GetChild( 0 );
+		key.dependencies += child->GetIdentity();
+		key.revision = std::max( key.revision, child->GetRevision() );
+	}
+}
+
+bool FragmentCache::Find( const Key& key, wxString& code )
+{
+	{
+		std::shared_lock< std::shared_mutex > lock( s_mutex );
+		FragmentMap::const_iterator it = s_fragments.find( key );
+		if ( it != s_fragments.end() )
+		{
+			code = it->second;
+			return true;
+		}
+
+		it = s_previous.find( key );
+		if ( it == s_previous.end() )
+		{
+			return false;
+		}
+		code = it->second;
+	}
+
+	// Still in use, it survives the next eviction
+	Store( key, code );
+	return true;
+}
+
+void FragmentCache::Store( const Key& key, const wxString& code )
+{
+	std::unique_lock< std::shared_mutex > lock( s_mutex );
+	if ( s_fragments.size() >= MAX_CACHED_FRAGMENTS )
+	{
+		// The fragments not used since the last eviction are stale by now
+		s_previous.swap( s_fragments );
+		s_fragments.clear();
+	}
+	s_fragments[ key ] = code;
+}
+
+void FragmentCache::Enable( bool enable )
+{
+	s_enabled = enable;
+	if ( !enable )
+	{
+		Clear();
+	}
+}
+
+bool FragmentCache::IsEnabled()
+{
+	return s_enabled;
+}
+
+void FragmentCache::Clear()
+{
+	std::unique_lock< std::shared_mutex > lock( s_mutex );
+	s_fragments.clear();
+	s_previous.clear();
+}
@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FRAGMENTCACHE__
+#define __FRAGMENTCACHE__
+
+#include "../utils/wxfbdefs.h"
+
+#include <wx/string.h>
+
+/**
+* Code generated by the templates, kept between generations so that the
+* objects that didn't change since the last one aren't parsed again.
+*
+* A fragment is looked up by the template, the settings of the parser and
+* the objects the template can read: the object itself, its ancestors
+* (#parent, #wxparent, #form, the project settings) and its first child
+* (#child). The identities of those objects and the newest of their
+* revisions tell whether the fragment is still valid, see
+* ObjectBase::GetRevision(). Stale fragments are never found again, they are
+* dropped when the cache is full.
+*/
+class FragmentCache
+{
+public:
+	struct Key
+	{
+		unsigned long identity = 0;     // identity of the object
+		unsigned long revision = 0;     // newest revision of the objects read by the template
+		size_t        dependencies = 0; // hash of the identities of the ancestors and the first child
+		wxString      settings;         // settings of the parser and #pred/#npred values
+		wxString      code;             // the template
+
+		bool operator==( const Key& that ) const
+		{
+			return identity == that.identity && revision == that.revision && dependencies == that.dependencies &&
+				settings == that.settings && code == that.code;
+		}
+	};
+
+	/**
+	* Fills the object part of the key.
+	*/
+	static void SetDependencies( Key& key, PObjectBase obj );
+
+	static bool Find( const Key& key, wxString& code );
+	static void Store( const Key& key, const wxString& code );
+
+	/**
+	* The cache only pays off when the same project is generated again, e.g.
+	* by the code panels after every edit. It is disabled by default, a
+	* single generation streams the code into the writers instead.
+	*/
+	static void Enable( bool enable );
+	static bool IsEnabled();
+
+	static void Clear();
+};
+
+#endif //__FRAGMENTCACHE__
@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "generationmanifest.h"
+
+#include <wx/file.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/log.h>
+
+#include <ctime>
+#include <fstream>
+#include <sstream>
+
+static const char* const MANIFEST_HEADER = "wxFormBuilder generation manifest 2";
+
+GenerationManifest::GenerationManifest( const wxString& filename )
+:
+m_filename( filename ),
+m_modified( false )
+{
+	std::ifstream file( static_cast< const char* >( filename.mb_str( wxConvFile ) ) );
+	std::string line;
+	if ( !file || !std::getline( file, line ) || line != MANIFEST_HEADER )
+	{
+		return;
+	}
+
+	// hash, size, time, time of the record and the name of the file, which is the rest of the line
+	while ( std::getline( file, line ) )
+	{
+		std::istringstream fields( line );
+		Entry entry;
+		std::string name;
+		if ( fields >> std::hex >> entry.hash >> std::dec >> entry.size >> entry.time >> entry.recorded && fields.get() == ' ' && std::getline( fields, name ) )
+		{
+			m_entries[ wxString::FromUTF8( name.c_str() ) ] = entry;
+		}
+	}
+}
+
+std::uint64_t GenerationManifest::Hash( const std::string& content )
+{
+	// FNV-1a, only meant to tell apart two versions of the same file
+	std::uint64_t hash = 14695981039346656037ULL;
+	for ( unsigned char c : content )
+	{
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+bool GenerationManifest::GetFileState( const wxString& file, std::uint64_t* size, long long* time )
+{
+	wxULongLong fileSize = wxFileName::GetSize( file );
+	time_t fileTime = wxFileModificationTime( file );
+	if ( fileSize == wxInvalidSize || fileTime == (time_t)-1 )
+	{
+		return false;
+	}
+
+	*size = fileSize.GetValue();
+	*time = fileTime;
+	return true;
+}
+
+bool GenerationManifest::IsRacy( const Entry& entry )
+{
+	// The time has a resolution of a second, a file modified again in the
+	// second it was recorded would keep its time if its size did not change
+	return ( entry.time >= entry.recorded );
+}
+
+GenerationManifest::Match GenerationManifest::Compare( const wxString& file, const std::string& content ) const
+{
+	std::uint64_t size;
+	long long time;
+	if ( !GetFileState( file, &size, &time ) )
+	{
+		return MATCH_DIFFERENT;
+	}
+
+	std::lock_guard< std::mutex > lock( m_mutex );
+	auto entry = m_entries.find( file );
+	if ( entry == m_entries.end() || entry->second.size != size || entry->second.time != time || IsRacy( entry->second ) )
+	{
+		return MATCH_UNKNOWN;
+	}
+
+	return ( size == content.size() && entry->second.hash == Hash( content ) ? MATCH_SAME : MATCH_DIFFERENT );
+}
+
+void GenerationManifest::Update( const wxString& file, const std::string& content )
+{
+	Entry entry;
+	if ( !GetFileState( file, &entry.size, &entry.time ) )
+	{
+		return;
+	}
+	entry.hash = Hash( content );
+	entry.recorded = std::time( nullptr );
+
+	std::lock_guard< std::mutex > lock( m_mutex );
+	Entry& current = m_entries[ file ];
+	if ( current.size != entry.size || current.time != entry.time || current.hash != entry.hash || IsRacy( current ) )
+	{
+		current = entry;
+		m_modified = true;
+	}
+}
+
+bool GenerationManifest::Save()
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( !m_modified )
+	{
+		return true;
+	}
+
+	std::ostringstream content;
+	content << MANIFEST_HEADER << '\n';
+	for ( const auto& entry : m_entries )
+	{
+		content << std::hex << entry.second.hash << std::dec << ' ' << entry.second.size << ' ' << entry.second.time << ' '
+				<< entry.second.recorded << ' '
+				<< static_cast< const char* >( entry.first.utf8_str() ) << '\n';
+	}
+
+	const std::string& data = content.str();
+	wxTempFile file;
+	if ( !file.Open( m_filename ) || !file.Write( data.c_str(), data.size() ) || !file.Commit() )
+	{
+		wxLogError( _("Unable to write file: %s"), m_filename.c_str() );
+		return false;
+	}
+
+	m_modified = false;
+	return true;
+}
@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __GENERATIONMANIFEST__
+#define __GENERATIONMANIFEST__
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <wx/string.h>
+
+/**
+* What was last written to the generated files of a project: the size and
+* the modification time of each file, and a hash of its content.
+*
+* A file whose size and time did not change since it was written still
+* holds that content, so new content can be compared with the hash without
+* reading the file back. A file recorded in the second of its modification
+* time is read again the next time, when the record is then made. The writers
+* of a generation share the manifest, it can be used from several threads.
+*/
+class GenerationManifest
+{
+public:
+	enum Match
+	{
+		MATCH_SAME,      // the file holds the content
+		MATCH_DIFFERENT, // the file is missing or holds something else
+		MATCH_UNKNOWN    // the file changed since it was written, it must be read
+	};
+
+	/**
+	* Loads the manifest if the file exists.
+	*/
+	explicit GenerationManifest( const wxString& filename );
+
+	/**
+	* Checks if the file holds the content, without reading it.
+	*/
+	Match Compare( const wxString& file, const std::string& content ) const;
+
+	/**
+	* Records that the file holds the content, after it was written or read.
+	*/
+	void Update( const wxString& file, const std::string& content );
+
+	/**
+	* Writes the manifest if it changed. Returns false if it could not.
+	*/
+	bool Save();
+
+	static std::uint64_t Hash( const std::string& content );
+
+private:
+	struct Entry
+	{
+		std::uint64_t size;
+		long long     time;
+		std::uint64_t hash;
+		long long     recorded; // when the entry was made
+	};
+
+	static bool IsRacy( const Entry& entry );
+	static bool GetFileState( const wxString& file, std::uint64_t* size, long long* time );
+
+	wxString           m_filename;
+	bool               m_modified;
+	mutable std::mutex m_mutex;
+	std::unordered_map< wxString, Entry, wxStringHash, wxStringEqual > m_entries;
+};
+
+#endif //__GENERATIONMANIFEST__
@@ -0,0 +1,451 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "generationscheduler.h"
+
+#include "codewriter.h"
+#include "cppcg.h"
+#include "generationmanifest.h"
+#include "luacg.h"
+#include "phpcg.h"
+#include "projectindex.h"
+#include "pythoncg.h"
+#include "xrccg.h"
+#include "../model/objectbase.h"
+#include "../utils/typeconv.h"
+#include "../utils/wxfbexception.h"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+GenerationScheduler::GenerationScheduler( PObjectBase project, const wxString& projectPath )
+:
+m_project( project ),
+m_projectPath( projectPath ),
+m_maxThreads( std::max( 1u, std::thread::hardware_concurrency() ) ),
+m_hasFirstID( false ),
+m_firstID( 1000 ),
+m_useRelativePath( false ),
+m_filePerForm( false ),
+m_useManifest( false ),
+m_useMicrosoftBOM( false ),
+m_useUtf8( false ),
+m_useSpaces( false ),
+m_pluginJobsDone( false ),
+m_pluginJobsSucceeded( false )
+{
+	PProperty pCodeGen = project->GetProperty( wxT("code_generation") );
+	if ( pCodeGen )
+	{
+		static const wxString s_languages[] = { wxT("C++"), wxT("Python"), wxT("PHP"), wxT("Lua"), wxT("XRC") };
+
+		const wxString& languages = pCodeGen->GetValue();
+		for ( const wxString& language : s_languages )
+		{
+			if ( TypeConv::FlagSet( language, languages ) )
+			{
+				m_languages.push_back( language );
+			}
+		}
+	}
+
+	PProperty pFirstID = project->GetProperty( wxT("first_id") );
+	if ( pFirstID )
+	{
+		m_hasFirstID = true;
+		m_firstID = pFirstID->GetValueAsInteger();
+	}
+
+	PProperty pfile = project->GetProperty( wxT("file") );
+	if ( pfile )
+	{
+		m_file = pfile->GetValue();
+	}
+	if ( m_file.empty() )
+	{
+		m_file = wxT("noname");
+	}
+
+	PProperty pRelPath = project->GetProperty( wxT("relative_path") );
+	if ( pRelPath )
+	{
+		m_useRelativePath = ( pRelPath->GetValueAsInteger() ? true : false );
+	}
+
+	PProperty pFilePerForm = project->GetProperty( wxT("file_per_form") );
+	if ( pFilePerForm )
+	{
+		m_filePerForm = ( pFilePerForm->GetValueAsInteger() != 0 );
+	}
+
+	PProperty pUseManifest = project->GetProperty( wxT("generation_manifest") );
+	if ( pUseManifest )
+	{
+		m_useManifest = ( pUseManifest->GetValueAsInteger() != 0 );
+	}
+
+	PProperty pUseMicrosoftBOM = project->GetProperty( wxT("use_microsoft_bom") );
+	if ( pUseMicrosoftBOM )
+	{
+		m_useMicrosoftBOM = ( pUseMicrosoftBOM->GetValueAsInteger() != 0 );
+	}
+
+	PProperty pUseUtf8 = project->GetProperty( wxT("encoding") );
+	if ( pUseUtf8 )
+	{
+		m_useUtf8 = ( pUseUtf8->GetValueAsString() != wxT("ANSI") );
+	}
+
+	PProperty pUseSpaces = project->GetProperty( wxT("indent_with_spaces") );
+	if ( pUseSpaces )
+	{
+		m_useSpaces = ( pUseSpaces->GetValueAsInteger() ? true : false );
+	}
+
+	PProperty pImagePathWrapperFunctionName = project->GetProperty( wxT("image_path_wrapper_function_name") );
+	if ( pImagePathWrapperFunctionName )
+	{
+		m_imagePathWrapperFunctionName = pImagePathWrapperFunctionName->GetValueAsString();
+	}
+}
+
+bool GenerationScheduler::Generate( const wxString& path )
+{
+	if ( !RunJobs( path ) )
+	{
+		wxLogError( _("Code generation failed, no file was written.") );
+		return false;
+	}
+
+	m_manifest.reset();
+	if ( m_useManifest )
+	{
+		m_manifest = std::make_shared< GenerationManifest >( m_path + m_file + wxT(".fbm") );
+	}
+
+	bool success = true;
+	for ( const Job& job : m_jobs )
+	{
+		for ( const Output& output : job.outputs )
+		{
+			try
+			{
+				FileCodeWriter file( output.filename, output.useMicrosoftBOM, output.useUtf8, m_manifest );
+				file.SetString( output.writer->GetString() );
+				if ( file.WriteBuffer() )
+				{
+					m_files.push_back( output.filename );
+				}
+				else
+				{
+					success = false;
+				}
+			}
+			catch ( wxFBException& ex )
+			{
+				wxLogError( ex.what() );
+				success = false;
+			}
+		}
+	}
+
+	if ( m_manifest && !m_manifest->Save() )
+	{
+		success = false;
+	}
+
+	return success;
+}
+
+bool GenerationScheduler::Check( const wxString& path )
+{
+	if ( !RunJobs( path ) )
+	{
+		wxLogError( _("Code generation failed.") );
+		return false;
+	}
+
+	// The files are read, the manifest could miss a change made to them
+	for ( const Job& job : m_jobs )
+	{
+		for ( const Output& output : job.outputs )
+		{
+			m_files.push_back( output.filename );
+			if ( !FileCodeWriter::IsUpToDate( output.filename, output.writer->GetString(), output.useMicrosoftBOM, output.useUtf8 ) )
+			{
+				m_staleFiles.push_back( output.filename );
+			}
+		}
+	}
+
+	return true;
+}
+
+void GenerationScheduler::RunPluginJobs( const wxString& path )
+{
+	CreateJobs( path );
+
+	m_pluginJobsSucceeded = true;
+	for ( Job& job : m_jobs )
+	{
+		if ( UsesPlugins( job.language ) )
+		{
+			m_pluginJobsSucceeded = Run( job ) && m_pluginJobsSucceeded;
+		}
+	}
+	m_pluginJobsDone = true;
+}
+
+bool GenerationScheduler::UsesPlugins( const wxString& language )
+{
+	// The XRC generator calls the components of the plugins, which use the GUI
+	return ( language == wxT("XRC") );
+}
+
+void GenerationScheduler::CreateJobs( const wxString& path )
+{
+	m_path = path;
+	m_files.clear();
+	m_staleFiles.clear();
+
+	// The generators may modify the project temporarily, each one gets its own copy
+	m_jobs.clear();
+	m_jobs.resize( m_languages.size() );
+	for ( size_t i = 0; i < m_jobs.size(); ++i )
+	{
+		m_jobs[ i ].language = m_languages[ i ];
+		m_jobs[ i ].project = ( i == 0 ? m_project : m_project->CreateSnapshot() );
+	}
+}
+
+bool GenerationScheduler::RunJobs( const wxString& path )
+{
+	const bool pluginJobsDone = ( m_pluginJobsDone && path == m_path );
+	m_pluginJobsDone = false;
+	if ( !pluginJobsDone )
+	{
+		CreateJobs( path );
+	}
+
+	// The template based generators run on a thread each, the ones that reach
+	// the plugins run on this thread meanwhile
+	std::vector< std::future< bool > > results;
+	for ( Job& job : m_jobs )
+	{
+		if ( !UsesPlugins( job.language ) )
+		{
+			results.push_back( std::async( std::launch::async, [this, &job]() { return Run( job ); } ) );
+		}
+	}
+
+	bool success = true;
+	if ( pluginJobsDone )
+	{
+		success = m_pluginJobsSucceeded;
+	}
+	else
+	{
+		for ( Job& job : m_jobs )
+		{
+			if ( UsesPlugins( job.language ) )
+			{
+				success = Run( job ) && success;
+			}
+		}
+	}
+
+	for ( std::future< bool >& result : results )
+	{
+		success = result.get() && success;
+	}
+
+	return success;
+}
+
+PStringCodeWriter GenerationScheduler::AddOutput( Job& job, const wxString& suffix, bool useEncoding ) const
+{
+	return AddFile( job, m_path + m_file + suffix, ( useEncoding ? m_useMicrosoftBOM : false ), ( useEncoding ? m_useUtf8 : true ) );
+}
+
+PStringCodeWriter GenerationScheduler::AddFile( Job& job, const wxString& filename, bool useMicrosoftBOM, bool useUtf8 ) const
+{
+	// Several forms can embed the same bitmap, its file is written once
+	for ( const Output& output : job.outputs )
+	{
+		if ( output.filename == filename )
+		{
+			return std::make_shared< StringCodeWriter >();
+		}
+	}
+
+	Output output;
+	output.filename = filename;
+	output.useMicrosoftBOM = useMicrosoftBOM;
+	output.useUtf8 = useUtf8;
+	output.writer = std::make_shared< StringCodeWriter >();
+	job.outputs.push_back( output );
+
+	return output.writer;
+}
+
+bool GenerationScheduler::Run( Job& job ) const
+{
+	try
+	{
+		if ( job.language == wxT("C++") )
+		{
+			if ( m_filePerForm )
+			{
+				return RunCppPerForm( job );
+			}
+
+			CppCodeGenerator codegen;
+			SetupCpp( codegen, job );
+
+			PStringCodeWriter h_cw = AddOutput( job, wxT(".h") );
+			PStringCodeWriter cpp_cw = AddOutput( job, wxT(".cpp") );
+			codegen.SetHeaderWriter( h_cw );
+			codegen.SetSourceWriter( cpp_cw );
+			return codegen.GenerateCode( job.project );
+		}
+		else if ( job.language == wxT("Python") )
+		{
+			PythonCodeGenerator codegen;
+			codegen.UseRelativePath( m_useRelativePath, m_path );
+			codegen.SetProjectPath( m_projectPath );
+			codegen.SetImagePathWrapperFunctionName( m_imagePathWrapperFunctionName );
+			if ( m_hasFirstID )
+			{
+				codegen.SetFirstID( m_firstID );
+			}
+
+			PStringCodeWriter python_cw = AddOutput( job, wxT(".py") );
+			python_cw->SetIndentWithSpaces( m_useSpaces );
+			codegen.SetSourceWriter( python_cw );
+			return codegen.GenerateCode( job.project );
+		}
+		else if ( job.language == wxT("PHP") )
+		{
+			PHPCodeGenerator codegen;
+			codegen.UseRelativePath( m_useRelativePath, m_path );
+			codegen.SetProjectPath( m_projectPath );
+			if ( m_hasFirstID )
+			{
+				codegen.SetFirstID( m_firstID );
+			}
+
+			codegen.SetSourceWriter( AddOutput( job, wxT(".php") ) );
+			return codegen.GenerateCode( job.project );
+		}
+		else if ( job.language == wxT("Lua") )
+		{
+			LuaCodeGenerator codegen;
+			codegen.UseRelativePath( m_useRelativePath, m_path );
+			codegen.SetProjectPath( m_projectPath );
+			if ( m_hasFirstID )
+			{
+				codegen.SetFirstID( m_firstID );
+			}
+
+			codegen.SetSourceWriter( AddOutput( job, wxT(".lua") ) );
+			return codegen.GenerateCode( job.project );
+		}
+		else if ( job.language == wxT("XRC") )
+		{
+			XrcCodeGenerator codegen;
+			codegen.SetWriter( AddOutput( job, wxT(".xrc"), false ) );
+			return codegen.GenerateCode( job.project );
+		}
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( ex.what() );
+	}
+
+	return false;
+}
+
+void GenerationScheduler::SetupCpp( CppCodeGenerator& codegen, Job& job ) const
+{
+	codegen.UseRelativePath( m_useRelativePath, m_path );
+	codegen.SetProjectPath( m_projectPath );
+	codegen.SetWriterFactory( [this, &job]( const wxString& file, bool useMicrosoftBOM, bool useUtf8 ) -> PCodeWriter
+	{
+		return AddFile( job, file, useMicrosoftBOM, useUtf8 );
+	} );
+	if ( m_hasFirstID )
+	{
+		codegen.SetFirstID( m_firstID );
+	}
+
+	// The other languages keep a thread each busy, the forms get what is left
+	const unsigned int others = static_cast< unsigned int >( m_languages.size() ) - 1;
+	codegen.SetMaxThreads( m_maxThreads > others ? m_maxThreads - others : 1 );
+}
+
+bool GenerationScheduler::RunCppPerForm( Job& job ) const
+{
+	ProjectIndex index( job.project );
+
+	std::vector< wxString > headers;
+	for ( const ProjectIndex::FormIndex& form : index.GetForms() )
+	{
+		const wxString suffix = wxT("_") + form.form->GetPropertyAsString( wxT("name") );
+
+		// A copy of the project with only this form, its files named after the form
+		PObjectBase project = job.project->CreateSnapshot( false );
+		PObjectBase copy = form.form->CreateSnapshot();
+		project->AddChild( copy );
+		copy->SetParent( project );
+
+		PProperty pfile = project->GetProperty( wxT("file") );
+		if ( pfile )
+		{
+			pfile->SetValue( m_file + suffix );
+		}
+
+		// The IDs are an enum of each class, numbered from first_id. Defines
+		// numbered across the project would change the files of every form
+		// after the one that gains an ID.
+		PProperty pUseEnum = project->GetProperty( wxT("use_enum") );
+		if ( pUseEnum )
+		{
+			pUseEnum->SetValue( wxT("1") );
+		}
+
+		CppCodeGenerator codegen;
+		SetupCpp( codegen, job );
+		codegen.SetHeaderWriter( AddOutput( job, suffix + wxT(".h") ) );
+		codegen.SetSourceWriter( AddOutput( job, suffix + wxT(".cpp") ) );
+		if ( !codegen.GenerateCode( project ) )
+		{
+			return false;
+		}
+
+		headers.push_back( m_file + suffix + wxT(".h") );
+	}
+
+	CppCodeGenerator codegen;
+	codegen.SetHeaderWriter( AddOutput( job, wxT(".h") ) );
+	codegen.GenerateFormsHeader( headers );
+	return true;
+}
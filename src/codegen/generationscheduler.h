@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __GENERATIONSCHEDULER__
+#define __GENERATIONSCHEDULER__
+
+#include "../utils/wxfbdefs.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <wx/string.h>
+
+class CppCodeGenerator;
+
+/**
+* Generates the files of every language enabled in a project.
+*
+* The settings of the project are read once. Each language is generated from
+* its own copy of the project and into its own writers. The template based
+* languages run on a thread each, so the slowest language sets the time it
+* takes. XRC reaches the components of the plugins, which use the GUI, and
+* runs on the calling thread. The files are written only when all the
+* languages succeeded.
+*/
+class GenerationScheduler
+{
+public:
+	/**
+	* @param project Frozen image of the project, see ObjectBase::CreateSnapshot().
+	* @param projectPath Directory of the project file.
+	*/
+	GenerationScheduler( PObjectBase project, const wxString& projectPath );
+
+	/**
+	* Languages enabled by the code_generation property, in the order their
+	* files are written.
+	*/
+	const std::vector< wxString >& GetLanguages() const { return m_languages; }
+
+	/**
+	* Limits the threads a generation uses, shared by the languages and the
+	* forms of the C++ code. By default all the hardware threads are used.
+	*/
+	void SetMaxThreads( unsigned int threads ) { m_maxThreads = std::max( 1u, threads ); }
+
+	/**
+	* Generates now the languages that reach the plugins (XRC), which must run
+	* on the main thread. The next Generate() or Check() on the same path then
+	* runs only the other languages, and can be called on any thread. It
+	* reports the result of both.
+	*/
+	void RunPluginJobs( const wxString& path );
+
+	/**
+	* Generates the enabled languages into the output path.
+	* Returns false if any of them failed, no file is written then.
+	*/
+	bool Generate( const wxString& path );
+
+	/**
+	* Generates the enabled languages and compares the code with the files in
+	* the output path, nothing is written. Returns false if any of them failed.
+	*/
+	bool Check( const wxString& path );
+
+	/**
+	* Files of the last generation, whether their content changed or not.
+	*/
+	const std::vector< wxString >& GetFiles() const { return m_files; }
+
+	/**
+	* Files whose content would change, found by the last Check().
+	*/
+	const std::vector< wxString >& GetStaleFiles() const { return m_staleFiles; }
+
+private:
+	struct Output
+	{
+		wxString          filename;
+		bool              useMicrosoftBOM;
+		bool              useUtf8;
+		PStringCodeWriter writer;
+	};
+
+	struct Job
+	{
+		wxString              language;
+		PObjectBase           project;
+		std::vector< Output > outputs;
+	};
+
+	/**
+	* Whether the generator of a language calls the code of the plugins.
+	*/
+	static bool UsesPlugins( const wxString& language );
+
+	void CreateJobs( const wxString& path );
+
+	/**
+	* Generates every language into its job, see the class description.
+	*/
+	bool RunJobs( const wxString& path );
+
+	PStringCodeWriter AddOutput( Job& job, const wxString& suffix, bool useEncoding = true ) const;
+	PStringCodeWriter AddFile( Job& job, const wxString& filename, bool useMicrosoftBOM, bool useUtf8 ) const;
+	bool Run( Job& job ) const;
+	void SetupCpp( CppCodeGenerator& codegen, Job& job ) const;
+
+	/**
+	* Generates a header and a source file per form, named after the form,
+	* and a header that includes the headers of all the forms. A form that
+	* did not change keeps the same files.
+	*/
+	bool RunCppPerForm( Job& job ) const;
+
+	PObjectBase             m_project;
+	wxString                m_projectPath;
+	std::vector< wxString > m_languages;
+	wxString                m_path;
+	PGenerationManifest     m_manifest;
+	std::vector< wxString > m_files;
+	std::vector< wxString > m_staleFiles;
+	std::vector< Job >      m_jobs;
+
+	wxString     m_file;
+	unsigned int m_maxThreads;
+	bool         m_hasFirstID;
+	unsigned int m_firstID;
+	bool         m_useRelativePath;
+	bool         m_filePerForm;
+	bool         m_useManifest;
+	bool         m_useMicrosoftBOM;
+	bool         m_useUtf8;
+	bool         m_useSpaces;
+	wxString     m_imagePathWrapperFunctionName;
+	bool         m_pluginJobsDone;
+	bool         m_pluginJobsSucceeded;
+};
+
+#endif //__GENERATIONSCHEDULER__
@@ -28,24 +28,26 @@
 
 #include "luacg.h"
 
+#include "../model/database.h"
 #include "../model/objectbase.h"
-#include "../rad/appdata.h"
 #include "../utils/debug.h"
 #include "../utils/typeconv.h"
 #include "../utils/wxfbexception.h"
 #include "codewriter.h"
+#include "projectindex.h"
 
 #include <algorithm>
 
 #include <wx/filename.h>
 #include <wx/tokenzr.h>
 
-LuaTemplateParser::LuaTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, std::vector<wxString> strUserIDsVec )
+LuaTemplateParser::LuaTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString projectPath, std::vector<wxString> strUserIDsVec )
 :
 TemplateParser(obj,_template),
 m_i18n( useI18N ),
 m_useRelativePath( useRelativePath ),
 m_basePath( basePath ),
+m_projectPath( projectPath ),
 m_strUserIDsVec(strUserIDsVec)
 {
 	if ( !wxFileName::DirExists( m_basePath ) )
@@ -62,6 +64,7 @@ TemplateParser( that, _template ),
 m_i18n( that.m_i18n ),
 m_useRelativePath( that.m_useRelativePath ),
 m_basePath( that.m_basePath ),
+m_projectPath( that.m_projectPath ),
 m_strUserIDsVec(strUserIDsVec)
 {
 	SetupModulePrefixes();
@@ -296,7 +299,7 @@ wxString LuaTemplateParser::ValueToCode( PropertyType type, wxString value )
 				wxString absPath;
 				try
 				{
-					absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
+					absPath = TypeConv::MakeAbsolutePath( path, m_projectPath );
 				}
 				catch( wxFBException& ex )
 				{
@@ -459,8 +462,7 @@ void LuaCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	m_source->WriteLn( wxEmptyString );
 
 
-			EventVector events;
-			FindEventHandlers( form, events );
+			EventVector events = ProjectIndex::IndexForm( form ).events;
 
 
 			if ( events.size() > 0 )
@@ -526,7 +528,7 @@ wxString LuaCodeGenerator::GenEventEntryForInheritedClass( PObjectBase obj, PObj
 			_template.Replace( wxT("#skip"),wxT("\n") + m_strEventHandlerPostfix );
 		}
 
-		LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+		LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
 		code = parser.ParseTemplate();
 		if(code.length() > 0) return code;
 
@@ -591,19 +593,22 @@ bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 		file = wxT("noname");
 	}
 
+	// What is needed from the whole project, in one go
+	PProjectIndex index = GetProjectIndex( project );
+
 	// Generate the subclass sets
 	std::set< wxString > subclasses;
-	std::vector< wxString > headerIncludes;
+	IncludeList headerIncludes;
 
-	GenSubclassSets( project, &subclasses, &headerIncludes );
+	GenSubclassSets( *index, &subclasses, &headerIncludes );
 
 	// Generating  includes
 	std::set< wxString > templates;
-	GenIncludes(project, &headerIncludes, &templates );
+	GenIncludes( project, &headerIncludes, &templates );
 
 	// Write the include lines
-	std::vector<wxString>::iterator include_it;
-	for ( include_it = headerIncludes.begin(); include_it != headerIncludes.end(); ++include_it )
+	std::vector<wxString>::const_iterator include_it;
+	for ( include_it = headerIncludes.GetLines().begin(); include_it != headerIncludes.GetLines().end(); ++include_it )
 	{
 		m_source->WriteLn( *include_it );
 	}
@@ -613,7 +618,7 @@ bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 	}
 
 	// Generating "defines" for macros
-	GenDefines( project );
+	GenDefines( *index );
 
 	PProperty propNamespace = project->GetProperty( wxT( "ui_table" ) );
 	if ( propNamespace )
@@ -640,17 +645,13 @@ bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 	PProperty disconnectMode = project->GetProperty( wxT("disconnect_mode") );
 	m_disconnecMode = disconnectMode->GetValueAsString();
 
-	unsigned int dProjChildCount = project->GetChildCount();
-	for ( unsigned int i = 0; i < dProjChildCount; i++ )
+	for ( const ProjectIndex::FormIndex& form : index->GetForms() )
 	{
-		PObjectBase child = project->GetChild( i );
-
-		// Preprocess to find arrays
-		ArrayItems arrays;
-		FindArrayObjects(child, arrays, true);
+		PObjectBase child = form.form;
 
-		EventVector events;
-		FindEventHandlers( child, events );
+		// The declaration state of the arrays is per class
+		ArrayItems arrays = form.arrays;
+		const EventVector& events = form.events;
 		GenClassDeclaration(child, false, wxEmptyString, events, m_strEventHandlerPostfix, arrays);
 	}
 
@@ -756,7 +757,7 @@ bool LuaCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info, con
 				_template.Replace( wxT("#skip"),wxT("\n") + m_strEventHandlerPostfix );
 			}
 
-			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
 			wxString code = parser.ParseTemplate();
 			wxString strRootCode = parser.RootWxParentToCode();
 			if(code.Find(strRootCode) != -1){
@@ -831,7 +832,8 @@ void LuaCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 		wxString _template = code_info->GetTemplate( wxT("generated_event_handlers") );
 		if ( !_template.empty() )
 		{
-			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+			parser.SetProgram( code_info->GetProgram( wxT("generated_event_handlers") ) );
 			wxString code = parser.ParseTemplate();
 
 			if ( !code.empty() )
@@ -879,7 +881,7 @@ wxString LuaCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent /
 		_template.Replace(wxT("#utbl"), wxEmptyString);
 	}
 
-	LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+	LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
 	wxString code = parser.ParseTemplate();
 
 	//handle unsupported classes
@@ -941,7 +943,12 @@ wxString LuaCodeGenerator::GetConstruction(PObjectBase obj, bool silent, wxStrin
 
 	// UI table code copied from TemplateParser
 	wxString strTableName;
-	const auto& project = AppData()->GetProjectData();
+	// The project of the object, which may be a snapshot and not the live one
+	PObjectBase project = obj;
+	for (PObjectBase parent = obj->GetParent(); parent; parent = parent->GetParent())
+	{
+		project = parent;
+	}
 	const auto& table = project->GetProperty(wxT("ui_table"));
 	if (table)
 	{
@@ -1024,18 +1031,13 @@ void LuaCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool /*use_enu
 
 }
 
-void LuaCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes )
+void LuaCodeGenerator::GenSubclassSets( const ProjectIndex& index, std::set< wxString >* subclasses, IncludeList* headerIncludes )
 {
-	// Call GenSubclassForwardDeclarations on all children as well
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
-	{
-		GenSubclassSets( obj->GetChild( i ), subclasses, headerIncludes );
-	}
-
-	// Fill the set
-	PProperty subclass = obj->GetProperty( wxT("subclass") );
-	if ( subclass )
+	// Children come before their parents, as they always did
+	for ( const PObjectBase& obj : index.GetSubclassedObjects() )
 	{
+		// Fill the set
+		PProperty subclass = obj->GetProperty( wxT("subclass") );
 		std::map< wxString, wxString > children;
 		subclass->SplitParentProperty( &children );
 
@@ -1045,14 +1047,14 @@ void LuaCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 		if ( children.end() == name )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		wxString nameVal = name->second;
 		if ( nameVal.empty() )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		// Now get the header
@@ -1062,50 +1064,47 @@ void LuaCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 		if ( children.end() == header )
 		{
 			// No header, so do nothing
-			return;
+			continue;
 		}
 
 		wxString headerVal = header->second;
 		if ( headerVal.empty() )
 		{
 			// No header, so do nothing
-			return;
+			continue;
 		}
 
 		// Got a header
 		PObjectInfo info = obj->GetObjectInfo();
 		if ( !info )
 		{
-			return;
+			continue;
 		}
 
 		PObjectPackage pkg = info->GetPackage();
 		if ( !pkg )
 		{
-			return;
+			continue;
 		}
 
 		wxString include = wxT("require(\"") + headerVal.Trim() +  wxT("\")\n");
-		std::vector< wxString >::iterator it = std::find( headerIncludes->begin(), headerIncludes->end(), include );
-		if ( headerIncludes->end() == it )
-		{
-			headerIncludes->push_back( include );
-		}
+		headerIncludes->AddUnique( include );
 	}
 }
 
-void LuaCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>* includes, std::set< wxString >* templates )
+void LuaCodeGenerator::GenIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates )
 {
 	GenObjectIncludes( project, includes, templates );
 }
 
-void LuaCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
+void LuaCodeGenerator::GenObjectIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates )
 {
 	// Fill the set
 	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("Lua") );
 	if (code_info)
 	{
-		LuaTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+		LuaTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+		parser.SetProgram( code_info->GetProgram( wxT("include") ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1126,7 +1125,7 @@ void LuaCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxSt
 	GenBaseIncludes( project->GetObjectInfo(), project, includes, templates );
 }
 
-void LuaCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates )
+void LuaCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, IncludeList* includes, std::set< wxString >* templates )
 {
 	if ( !info )
 	{
@@ -1143,7 +1142,8 @@ void LuaCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 	PCodeInfo code_info = info->GetCodeInfo( wxT("Lua") );
 	if ( code_info )
 	{
-		LuaTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+		LuaTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+		parser.SetProgram( code_info->GetProgram( wxT("include") ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1155,7 +1155,7 @@ void LuaCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 	}
 }
 
-void LuaCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes )
+void LuaCodeGenerator::AddUniqueIncludes( const wxString& include, IncludeList* includes )
 {
 	// Split on newlines to only generate unique include lines
 	// This strips blank lines and trims
@@ -1168,26 +1168,7 @@ void LuaCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector<
 		line.Trim( true );
 
 		// If it is an include, it must be unique to be written
-		std::vector< wxString >::iterator it = std::find( includes->begin(), includes->end(), line );
-		if ( includes->end() == it )
-		{
-			includes->push_back( line );
-		}
-	}
-}
-
-void LuaCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set )
-{
-	unsigned int ch_count = obj->GetChildCount();
-	if (ch_count > 0)
-	{
-		unsigned int i;
-		for (i = 0; i<ch_count; i++)
-		{
-			PObjectBase child = obj->GetChild(i);
-			info_set.insert(child->GetObjectInfo());
-			FindDependencies(child, info_set);
-		}
+		includes->AddUnique( line );
 	}
 }
 
@@ -1341,7 +1322,7 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 					wxT("#ifnull #parent $size")
 					wxT("@{ #nl #utbl$name:Fit( #utbl#wxparent $name ) @}");
 
-				LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+				LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
 				wxString res  = parser.ParseTemplate();
 				res.Replace(parser.RootWxParentToCode(), wxEmptyString);
 				m_source->WriteLn(res);
@@ -1359,8 +1340,8 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 					_template = _template + wxT("#utbl") + sub1->GetProperty( wxT("name") )->GetValue() + wxT(" )");
 					_template.Replace(wxT("#utbl"), m_strUITable + wxT("."));
 
-					LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
-					m_source->WriteLn(parser.ParseTemplate());
+					LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				case 2:
@@ -1386,8 +1367,8 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 					_template = _template + wxT("#nl #utbl$name") + wxT(":SetSplitMode(") + wxString::Format(wxT("%d"),(bSplitVertical ? 1 : 0)) + wxT(")");
 					_template.Replace(wxT("#utbl"), m_strUITable + wxT("."));
 
-					LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
-					m_source->WriteLn(parser.ParseTemplate());
+					LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				default:
@@ -1511,7 +1492,8 @@ void LuaCodeGenerator::GenDestruction( PObjectBase obj )
 
 		if ( !_template.empty() )
 		{
-			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+			parser.SetProgram( code_info->GetProgram( wxT( "destruction" ) ) );
 			wxString code = parser.ParseTemplate();
 			if ( !code.empty() )
 			{
@@ -1528,60 +1510,26 @@ void LuaCodeGenerator::GenDestruction( PObjectBase obj )
 	}
 }
 
-void LuaCodeGenerator::FindMacros( PObjectBase obj, std::vector<wxString>* macros )
+void LuaCodeGenerator::FindMacros( const std::vector< wxString >& values, std::vector<wxString>* macros )
 {
-	// iterate through all of the properties of all objects, add the macros
-	// to the vector
-	unsigned int i;
-
-	for ( i = 0; i < obj->GetPropertyCount(); i++ )
+	// The values are unique already, in the order of the objects
+	for ( const wxString& value : values )
 	{
-		PProperty prop = obj->GetProperty( i );
-		if ( prop->GetType() == PT_MACRO )
-		{
-			wxString value = prop->GetValue();
-			if( value.IsEmpty() ) continue;
+		if( value.IsEmpty() ) continue;
 
-			// Skip wx IDs
-			if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
-				 ( m_predMacros.end() == m_predMacros.find( value ) ) )
-			{
-				if ( macros->end() == std::find( macros->begin(), macros->end(), value ) )
-				{
-					macros->push_back( value );
-				}
-			}
+		// Skip wx IDs
+		if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
+			 ( m_predMacros.end() == m_predMacros.find( value ) ) )
+		{
+			macros->push_back( value );
 		}
 	}
-
-	for ( i = 0; i < obj->GetChildCount(); i++ )
-	{
-		FindMacros( obj->GetChild( i ), macros );
-	}
-}
-
-void LuaCodeGenerator::FindEventHandlers(PObjectBase obj, EventVector &events)
-{
-  unsigned int i;
-  unsigned int evt_cnt = obj->GetEventCount();
-  for (i=0; i < evt_cnt; i++)
-  {
-	PEvent event = obj->GetEvent(i);
-	if (!event->GetValue().IsEmpty())
-	  events.push_back(event);
-  }
-
-  for (i=0; i < obj->GetChildCount(); i++)
-  {
-	PObjectBase child = obj->GetChild(i);
-	FindEventHandlers(child,events);
-  }
 }
 
-void LuaCodeGenerator::GenDefines( PObjectBase project)
+void LuaCodeGenerator::GenDefines( const ProjectIndex& index )
 {
 	std::vector< wxString > macros;
-	FindMacros( project, &macros );
+	FindMacros( index.GetMacros(), &macros );
 	m_strUserIDsVec.erase(m_strUserIDsVec.begin(),m_strUserIDsVec.end());
 
 	// Remove the default macro from the set, for backward compatiblity
@@ -1626,7 +1574,8 @@ void LuaCodeGenerator::GenSettings(PObjectInfo info, PObjectBase obj, wxString &
 
 	if ( !_template.empty() )
 	{
-		LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+		LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+		parser.SetProgram( code_info->GetProgram( wxT("settings") ) );
 		wxString code = parser.ParseTemplate();
 
 		wxString strRootCode = parser.RootWxParentToCode();
@@ -1669,7 +1618,8 @@ void LuaCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxA
 
 	if ( !_template.empty() )
 	{
-		LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+		LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_strUserIDsVec );
+		parser.SetProgram( code_info->GetProgram( wxT( "toolbar_add" ) ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
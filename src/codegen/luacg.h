@@ -55,6 +55,7 @@ private:
 	bool m_i18n;
 	bool m_useRelativePath;
 	wxString m_basePath;
+	wxString m_projectPath;
 
 	std::map<wxString, wxString> m_predModulePrefix;
 	std::vector<wxString> m_strUserIDsVec;
@@ -62,7 +63,7 @@ private:
 	void SetupModulePrefixes();
 
 public:
-	LuaTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, std::vector<wxString> strUserIDsVec);
+	LuaTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString projectPath, std::vector<wxString> strUserIDsVec);
 	LuaTemplateParser( const LuaTemplateParser & that, wxString _template, std::vector<wxString> strUserIDsVec);
 
 	// overrides for Lua
@@ -111,21 +112,11 @@ private:
 	*/
 	wxString GetConstruction(PObjectBase obj, bool silent, wxString strSelf, ArrayItems& arrays);
 
-	/**
-	* Stores the project's objects classes set, for generating the includes.
-	*/
-	void FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set );
-
 	/**
 	* Stores all the properties for "macro" type objects, so that their
 	* related '#define' can be generated subsequently.
 	*/
-	void FindMacros( PObjectBase obj, std::vector< wxString >* macros );
-
-	/**
-	 * Looks for "non-null" event handlers (PEvent) and collects it into a vector.
-	 */
-	void FindEventHandlers(PObjectBase obj, EventVector &events);
+	void FindMacros( const std::vector< wxString >& values, std::vector< wxString >* macros );
 
 	/**
 	* Generates classes declarations inside the header file.
@@ -159,20 +150,20 @@ private:
 	/**
 	* Generates the 'import' section for files.
 	*/
-	void GenIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes );
+	void GenIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates );
+	void GenObjectIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates );
+	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, IncludeList* includes, std::set< wxString >* templates );
+	void AddUniqueIncludes( const wxString& include, IncludeList* includes );
 
 	/**
 	* Generate a set of all subclasses to forward declare in the generated file.
 	*/
-	void GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes );
+	void GenSubclassSets( const ProjectIndex& index, std::set< wxString >* subclasses, IncludeList* headerIncludes );
 
 	/**
 	* Generates the '#define' section for macros.
 	*/
-	void GenDefines( PObjectBase project);
+	void GenDefines( const ProjectIndex& index );
 
 	/**
 	* Generates the constructor for a class
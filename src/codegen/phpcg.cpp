@@ -29,9 +29,10 @@
 #include "phpcg.h"
 
 #include "codewriter.h"
+#include "projectindex.h"
 #include "../utils/typeconv.h"
 #include "../utils/debug.h"
-#include "../rad/appdata.h"
+#include "../model/database.h"
 #include "../model/objectbase.h"
 #include "../utils/wxfbexception.h"
 
@@ -40,12 +41,13 @@
 #include <wx/filename.h>
 #include <wx/tokenzr.h>
 
-PHPTemplateParser::PHPTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath )
+PHPTemplateParser::PHPTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString projectPath )
 :
 TemplateParser(obj,_template),
 m_i18n( useI18N ),
 m_useRelativePath( useRelativePath ),
-m_basePath( basePath )
+m_basePath( basePath ),
+m_projectPath( projectPath )
 {
 	if ( !wxFileName::DirExists( m_basePath ) )
 	{
@@ -58,7 +60,8 @@ PHPTemplateParser::PHPTemplateParser( const PHPTemplateParser & that, wxString _
 TemplateParser( that, _template ),
 m_i18n( that.m_i18n ),
 m_useRelativePath( that.m_useRelativePath ),
-m_basePath( that.m_basePath )
+m_basePath( that.m_basePath ),
+m_projectPath( that.m_projectPath )
 {
 }
 
@@ -67,6 +70,13 @@ wxString PHPTemplateParser::RootWxParentToCode()
 	return wxT("$this");
 }
 
+bool PHPTemplateParser::GetCacheSettings( wxString& settings )
+{
+	// Bitmap paths depend on the location of the project too
+	settings << ( m_i18n ? wxT("1") : wxT("0") ) << ( m_useRelativePath ? wxT("1") : wxT("0") ) << m_basePath << wxT('\x01') << m_projectPath;
+	return true;
+}
+
 PTemplateParser PHPTemplateParser::CreateParser( const TemplateParser* oldparser, wxString _template )
 {
 	const PHPTemplateParser* phpOldParser = dynamic_cast< const PHPTemplateParser* >( oldparser );
@@ -256,7 +266,7 @@ wxString PHPTemplateParser::ValueToCode( PropertyType type, wxString value )
 				wxString absPath;
 				try
 				{
-					absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
+					absPath = TypeConv::MakeAbsolutePath( path, m_projectPath );
 				}
 				catch( wxFBException& ex )
 				{
@@ -407,8 +417,7 @@ void PHPCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	m_source->WriteLn( code );
 
 	// Do events
-	EventVector events;
-	FindEventHandlers( form, events );
+	EventVector events = ProjectIndex::IndexForm( form ).events;
 
 	if ( events.size() > 0 )
 	{
@@ -488,19 +497,22 @@ bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 		file = wxT("noname");
 	}
 
+	// What is needed from the whole project, in one go
+	PProjectIndex index = GetProjectIndex( project );
+
 	// Generate the subclass sets
 	std::set< wxString > subclasses;
-	std::vector< wxString > headerIncludes;
+	IncludeList headerIncludes;
 
-	GenSubclassSets( project, &subclasses, &headerIncludes );
+	GenSubclassSets( *index, &subclasses, &headerIncludes );
 
 	// Generating in the .h header file those include from components dependencies.
 	std::set< wxString > templates;
-	GenIncludes(project, &headerIncludes, &templates );
+	GenIncludes( project, &headerIncludes, &templates );
 
 	// Write the include lines
-	std::vector<wxString>::iterator include_it;
-	for ( include_it = headerIncludes.begin(); include_it != headerIncludes.end(); ++include_it )
+	std::vector<wxString>::const_iterator include_it;
+	for ( include_it = headerIncludes.GetLines().begin(); include_it != headerIncludes.GetLines().end(); ++include_it )
 	{
 		m_source->WriteLn( *include_it );
 	}
@@ -518,7 +530,7 @@ bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 	}
 
 	// Generating "defines" for macros
-	GenDefines( project );
+	GenDefines( *index );
 
 	wxString eventHandlerPostfix;
 	PProperty eventKindProp = project->GetProperty( wxT("skip_php_events") );
@@ -534,16 +546,13 @@ bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 	PProperty disconnectMode = project->GetProperty( wxT("disconnect_mode") );
 	m_disconnecMode = disconnectMode->GetValueAsString();
 
-	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
+	for ( const ProjectIndex::FormIndex& form : index->GetForms() )
 	{
-		PObjectBase child = project->GetChild( i );
+		PObjectBase child = form.form;
 
-		// Preprocess to find arrays
-		ArrayItems arrays;
-		FindArrayObjects(child, arrays, true);
-
-		EventVector events;
-		FindEventHandlers( child, events );
+		// The declaration state of the arrays is per class
+		ArrayItems arrays = form.arrays;
+		const EventVector& events = form.events;
 		//GenClassDeclaration( child, useEnum, classDecoration, events, eventHandlerPrefix, eventHandlerPostfix );
 		GenClassDeclaration(child, false, wxEmptyString, events, eventHandlerPostfix, arrays);
 	}
@@ -645,8 +654,8 @@ bool PHPCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info, con
 			else
 				_template.Replace( wxT("#handler"), wxT("array(@$this, \"") + handlerName + wxT("\")") );
 
-			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-			m_source->WriteLn( parser.ParseTemplate() );
+			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+			parser.ParseTemplate( m_source );
 			return true;
 		}
 	}
@@ -715,7 +724,8 @@ void PHPCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 		wxString _template = code_info->GetTemplate( wxT("generated_event_handlers") );
 		if ( !_template.empty() )
 		{
-			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+			parser.SetProgram( code_info->GetProgram( wxT("generated_event_handlers") ) );
 			wxString code = parser.ParseTemplate();
 
 			if ( !code.empty() )
@@ -752,12 +762,30 @@ wxString PHPCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent)
 
 	_template = code_info->GetTemplate(name);
 
-	PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+	PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+	parser.SetProgram( code_info->GetProgram( name ) );
 	wxString code = parser.ParseTemplate();
 
 	return code;
 }
 
+void PHPCodeGenerator::WriteCode( PCodeWriter writer, PObjectBase obj, wxString name )
+{
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT("PHP") );
+
+	if ( !code_info )
+	{
+		wxLogError( wxT("Missing \"%s\" template for \"%s\" class. Review your XML object description"),
+					name.c_str(), obj->GetClassName().c_str() );
+		writer->WriteLn();
+		return;
+	}
+
+	PHPTemplateParser parser( obj, code_info->GetTemplate( name ), m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+	parser.SetProgram( code_info->GetProgram( name ) );
+	parser.ParseTemplate( writer );
+}
+
 wxString PHPCodeGenerator::GetConstruction(PObjectBase obj, ArrayItems& arrays)
 {
 	// Get the name
@@ -849,18 +877,13 @@ void PHPCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool /*use_enu
 	m_source->WriteLn(wxEmptyString);
 }
 
-void PHPCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes )
+void PHPCodeGenerator::GenSubclassSets( const ProjectIndex& index, std::set< wxString >* subclasses, IncludeList* headerIncludes )
 {
-	// Call GenSubclassForwardDeclarations on all children as well
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
-	{
-		GenSubclassSets( obj->GetChild( i ), subclasses, headerIncludes );
-	}
-
-	// Fill the set
-	PProperty subclass = obj->GetProperty( wxT("subclass") );
-	if ( subclass )
+	// Children come before their parents, as they always did
+	for ( const PObjectBase& obj : index.GetSubclassedObjects() )
 	{
+		// Fill the set
+		PProperty subclass = obj->GetProperty( wxT("subclass") );
 		std::map< wxString, wxString > children;
 		subclass->SplitParentProperty( &children );
 
@@ -870,14 +893,14 @@ void PHPCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 		if ( children.end() == name )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		wxString nameVal = name->second;
 		if ( nameVal.empty() )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		// Now get the header
@@ -887,50 +910,47 @@ void PHPCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 		if ( children.end() == header )
 		{
 			// No header, so do nothing
-			return;
+			continue;
 		}
 
 		wxString headerVal = header->second;
 		if ( headerVal.empty() )
 		{
 			// No header, so do nothing
-			return;
+			continue;
 		}
 
 		// Got a header
 		PObjectInfo info = obj->GetObjectInfo();
 		if ( !info )
 		{
-			return;
+			continue;
 		}
 
 		PObjectPackage pkg = info->GetPackage();
 		if ( !pkg )
 		{
-			return;
+			continue;
 		}
 
 		wxString include = wxT("include_once ") + headerVal + wxT(";");
-		std::vector< wxString >::iterator it = std::find( headerIncludes->begin(), headerIncludes->end(), include );
-		if ( headerIncludes->end() == it )
-		{
-			headerIncludes->push_back( include );
-		}
+		headerIncludes->AddUnique( include );
 	}
 }
 
-void PHPCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>* includes, std::set< wxString >* templates )
+void PHPCodeGenerator::GenIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates )
 {
 	GenObjectIncludes( project, includes, templates );
 }
 
-void PHPCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
+void PHPCodeGenerator::GenObjectIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates )
 {
 	// Fill the set
 	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("PHP") );
 	if (code_info)
 	{
-		PHPTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
+		PHPTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT("include") ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -951,7 +971,7 @@ void PHPCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxSt
 	GenBaseIncludes( project->GetObjectInfo(), project, includes, templates );
 }
 
-void PHPCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates )
+void PHPCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, IncludeList* includes, std::set< wxString >* templates )
 {
 	if ( !info )
 	{
@@ -968,7 +988,8 @@ void PHPCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 	PCodeInfo code_info = info->GetCodeInfo( wxT("PHP") );
 	if ( code_info )
 	{
-		PHPTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
+		PHPTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT("include") ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -980,7 +1001,7 @@ void PHPCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 	}
 }
 
-void PHPCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes )
+void PHPCodeGenerator::AddUniqueIncludes( const wxString& include, IncludeList* includes )
 {
 	// Split on newlines to only generate unique include lines
 	// This strips blank lines and trims
@@ -995,31 +1016,12 @@ void PHPCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector<
 		// If it is not an include line, it will be written
 		if ( !line.StartsWith( wxT("import") ) )
 		{
-			includes->push_back( line );
+			includes->Add( line );
 			continue;
 		}
 
 		// If it is an include, it must be unique to be written
-		std::vector< wxString >::iterator it = std::find( includes->begin(), includes->end(), line );
-		if ( includes->end() == it )
-		{
-			includes->push_back( line );
-		}
-	}
-}
-
-void PHPCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set )
-{
-	unsigned int ch_count = obj->GetChildCount();
-	if (ch_count > 0)
-	{
-		unsigned int i;
-		for (i = 0; i<ch_count; i++)
-		{
-			PObjectBase child = obj->GetChild(i);
-			info_set.insert(child->GetObjectInfo());
-			FindDependencies(child, info_set);
-		}
+		includes->AddUnique( line );
 	}
 }
 
@@ -1027,10 +1029,10 @@ void PHPCodeGenerator::GenConstructor(PObjectBase class_obj, const EventVector&
 {
 	m_source->WriteLn();
 	// generate function definition
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_def") ) );
+	WriteCode( m_source, class_obj, wxT("cons_def") );
 	m_source->Indent();
 
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_call") ) );
+	WriteCode( m_source, class_obj, wxT("cons_call") );
 	m_source->WriteLn();
 
 	wxString settings = GetCode( class_obj, wxT("settings") );
@@ -1137,8 +1139,8 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 					wxT("#ifnull #parent $size")
 					wxT("@{ #nl @$$name->Fit( #wxparent $name ); @}");
 
-				PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-				m_source->WriteLn(parser.ParseTemplate());
+				PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+				parser.ParseTemplate( m_source );
 			}
 		}
 		else if ( type == wxT("splitter") )
@@ -1152,8 +1154,8 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 					wxString _template = wxT("@$this->$name->Initialize( ");
 					_template = _template + wxT("@$this->") + sub1->GetProperty( wxT("name") )->GetValue() + wxT(" );");
 
-					PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-					m_source->WriteLn(parser.ParseTemplate());
+					PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				case 2:
@@ -1175,8 +1177,8 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 					_template = _template + wxT("@$this->") + sub1->GetProperty( wxT("name") )->GetValue() +
 						wxT(", @$this->") + sub2->GetProperty( wxT("name") )->GetValue() + wxT(", $sashpos );");
 
-					PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
-					m_source->WriteLn(parser.ParseTemplate());
+					PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				default:
@@ -1233,7 +1235,7 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 			return;
 		}
 
-		m_source->WriteLn( GetCode( obj, temp_name ) );
+		WriteCode( m_source, obj, temp_name );
 	}
 	else if (	type == wxT("notebookpage")		||
 				type == wxT("flatnotebookpage")	||
@@ -1244,12 +1246,12 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, ArrayIte
 			)
 	{
 		GenConstruction(obj->GetChild(0), false, arrays);
-		m_source->WriteLn( GetCode( obj, wxT("page_add") ) );
+		WriteCode( m_source, obj, wxT("page_add") );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("treelistctrlcolumn") )
 	{
-		m_source->WriteLn( GetCode( obj, wxT("column_add") ) );
+		WriteCode( m_source, obj, wxT("column_add") );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("tool") )
@@ -1298,7 +1300,8 @@ void PHPCodeGenerator::GenDestruction( PObjectBase obj )
 
 		if ( !_template.empty() )
 		{
-			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+			parser.SetProgram( code_info->GetProgram( wxT( "destruction" ) ) );
 			wxString code = parser.ParseTemplate();
 			if ( !code.empty() )
 			{
@@ -1315,59 +1318,26 @@ void PHPCodeGenerator::GenDestruction( PObjectBase obj )
 	}
 }
 
-void PHPCodeGenerator::FindMacros( PObjectBase obj, std::vector<wxString>* macros )
+void PHPCodeGenerator::FindMacros( const std::vector< wxString >& values, std::vector<wxString>* macros )
 {
-	// iterate through all of the properties of all objects, add the macros
-	// to the vector
-	unsigned int i;
-
-	for ( i = 0; i < obj->GetPropertyCount(); i++ )
+	// The values are unique already, in the order of the objects
+	for ( const wxString& value : values )
 	{
-		PProperty prop = obj->GetProperty( i );
-		if ( prop->GetType() == PT_MACRO )
-		{
-			wxString value = prop->GetValue();
-			if( value.IsEmpty() ) continue;
+		if( value.IsEmpty() ) continue;
 
-			// Skip wx IDs
-			if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
-				 ( m_predMacros.end() == m_predMacros.find( value ) ) )
-			{
-				if ( macros->end() == std::find( macros->begin(), macros->end(), value ) )
-				{
-					macros->push_back( value );
-				}
-			}
+		// Skip wx IDs
+		if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
+			 ( m_predMacros.end() == m_predMacros.find( value ) ) )
+		{
+			macros->push_back( value );
 		}
 	}
-
-	for ( i = 0; i < obj->GetChildCount(); i++ )
-	{
-		FindMacros( obj->GetChild( i ), macros );
-	}
-}
-
-void PHPCodeGenerator::FindEventHandlers(PObjectBase obj, EventVector &events)
-{
-  unsigned int i;
-  for (i=0; i < obj->GetEventCount(); i++)
-  {
-	PEvent event = obj->GetEvent(i);
-	if (!event->GetValue().IsEmpty())
-	  events.push_back(event);
-  }
-
-  for (i=0; i < obj->GetChildCount(); i++)
-  {
-	PObjectBase child = obj->GetChild(i);
-	FindEventHandlers(child,events);
-  }
 }
 
-void PHPCodeGenerator::GenDefines( PObjectBase project)
+void PHPCodeGenerator::GenDefines( const ProjectIndex& index )
 {
 	std::vector< wxString > macros;
-	FindMacros( project, &macros );
+	FindMacros( index.GetMacros(), &macros );
 
 	// Remove the default macro from the set, for backward compatiblity
 	std::vector< wxString >::iterator it;
@@ -1410,7 +1380,8 @@ void PHPCodeGenerator::GenSettings(PObjectInfo info, PObjectBase obj)
 
 	if ( !_template.empty() )
 	{
-		PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+		PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT("settings") ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
@@ -1447,7 +1418,8 @@ void PHPCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxA
 
 	if ( !_template.empty() )
 	{
-		PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
+		PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath );
+		parser.SetProgram( code_info->GetProgram( wxT( "toolbar_add" ) ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
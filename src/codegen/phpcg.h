@@ -58,15 +58,17 @@ private:
 	bool m_i18n;
 	bool m_useRelativePath;
 	wxString m_basePath;
+	wxString m_projectPath;
 
 public:
-	PHPTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath );
+	PHPTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString projectPath );
 	PHPTemplateParser( const PHPTemplateParser & that, wxString _template );
 
 	// overrides for PHP
 	PTemplateParser CreateParser(const TemplateParser* oldparser, wxString _template) override;
 	wxString RootWxParentToCode() override;
 	wxString ValueToCode(PropertyType type, wxString value) override;
+	bool GetCacheSettings( wxString& settings ) override;
 };
 
 /**
@@ -96,6 +98,12 @@ private:
 	*/
 	wxString GetCode( PObjectBase obj, wxString name, bool silent = false);
 
+	/**
+	* Given an object and the name for a template, writes the code to the
+	* writer as it is generated. Same as writer->WriteLn( GetCode( obj, name ) ).
+	*/
+	void WriteCode( PCodeWriter writer, PObjectBase obj, wxString name );
+
 	/**
 	* Gets the construction fragment for the specified object.
 	*
@@ -103,21 +111,11 @@ private:
 	*/
 	wxString GetConstruction(PObjectBase obj, ArrayItems& arrays);
 
-	/**
-	* Stores the project's objects classes set, for generating the includes.
-	*/
-	void FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set );
-
 	/**
 	* Stores all the properties for "macro" type objects, so that their
 	* related '#define' can be generated subsequently.
 	*/
-	void FindMacros( PObjectBase obj, std::vector< wxString >* macros );
-
-	/**
-	 * Looks for "non-null" event handlers (PEvent) and collects it into a vector.
-	 */
-	void FindEventHandlers(PObjectBase obj, EventVector &events);
+	void FindMacros( const std::vector< wxString >& values, std::vector< wxString >* macros );
 
 	/**
 	* Generates classes declarations inside the header file.
@@ -146,20 +144,20 @@ private:
 	/**
 	* Generates the 'import' section for files.
 	*/
-	void GenIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes );
+	void GenIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates );
+	void GenObjectIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates );
+	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, IncludeList* includes, std::set< wxString >* templates );
+	void AddUniqueIncludes( const wxString& include, IncludeList* includes );
 
 	/**
 	* Generate a set of all subclasses to forward declare in the generated file.
 	*/
-	void GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes );
+	void GenSubclassSets( const ProjectIndex& index, std::set< wxString >* subclasses, IncludeList* headerIncludes );
 
 	/**
 	* Generates the '#define' section for macros.
 	*/
-	void GenDefines( PObjectBase project);
+	void GenDefines( const ProjectIndex& index );
 
 	/**
 	* Generates the constructor for a class
@@ -0,0 +1,590 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "projectgenerator.h"
+
+#include "codegen.h"
+#include "generationmanifest.h"
+#include "generationscheduler.h"
+#include "../model/objectbase.h"
+#include "../utils/typeconv.h"
+#include "../utils/wxfbexception.h"
+
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <set>
+#include <thread>
+
+#include <wx/cmdline.h>
+#include <wx/file.h>
+#include <wx/filename.h>
+#include <wx/textfile.h>
+
+ProjectGenerator::ProjectGenerator( const wxString& dataDir )
+:
+m_objDb( new ObjectDatabase() ),
+m_hasLibraries( false ),
+m_keepProjects( false )
+{
+	m_objDb->SetXmlPath( dataDir + wxFILE_SEP_PATH + wxT("xml") + wxFILE_SEP_PATH );
+	m_objDb->SetIconPath( dataDir + wxFILE_SEP_PATH + wxT("resources") + wxFILE_SEP_PATH + wxT("icons") + wxFILE_SEP_PATH );
+	m_objDb->SetPluginPath( dataDir + wxFILE_SEP_PATH + wxT("plugins") + wxFILE_SEP_PATH );
+	m_objDb->SetCodeGenerationOnly( true );
+}
+
+bool ProjectGenerator::Init()
+{
+	try
+	{
+		m_objDb->LoadObjectTypes();
+		m_objDb->LoadPlugins( PwxFBManager() );
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( _("Error loading application: %s"), ex.what() );
+		return false;
+	}
+
+	return true;
+}
+
+bool ProjectGenerator::Generate( const wxString& file, const wxString& languages )
+{
+	Options options;
+	options.languages = languages;
+	return Generate( std::vector< wxString >( 1, file ), options );
+}
+
+bool ProjectGenerator::Generate( const std::vector< wxString >& files, const Options& options )
+{
+	const unsigned int cores = std::max( 1u, std::thread::hardware_concurrency() );
+	unsigned int jobs = options.jobs;
+	if ( 0 == jobs )
+	{
+		jobs = cores;
+	}
+
+	// The projects that run at the same time share the hardware threads
+	const size_t concurrent = std::max< size_t >( 1, std::min< size_t >( jobs, files.size() ) );
+	const unsigned int threadsPerProject = std::max( 1u, static_cast< unsigned int >( cores / concurrent ) );
+
+	m_generatedFiles.clear();
+	m_staleFiles.clear();
+
+	std::vector< Task > tasks( files.size() );
+	std::vector< bool > results( files.size(), false );
+	auto report = [&]( size_t i, bool success )
+	{
+		results[ i ] = success;
+		if ( success && tasks[ i ].scheduler )
+		{
+			const std::vector< wxString >& generated = tasks[ i ].scheduler->GetFiles();
+			m_generatedFiles.insert( m_generatedFiles.end(), generated.begin(), generated.end() );
+
+			const std::vector< wxString >& stale = tasks[ i ].scheduler->GetStaleFiles();
+			m_staleFiles.insert( m_staleFiles.end(), stale.begin(), stale.end() );
+		}
+
+		if ( files.size() > 1 )
+		{
+			if ( success )
+			{
+				wxLogMessage( _("%s: generated"), files[ i ].c_str() );
+			}
+			else
+			{
+				wxLogMessage( _("%s: FAILED"), files[ i ].c_str() );
+			}
+		}
+	};
+
+	// The projects are loaded here, one after the other, and generated by the workers
+	std::deque< std::pair< size_t, std::future< bool > > > running;
+	auto finishOldest = [&]()
+	{
+		report( running.front().first, running.front().second.get() );
+		running.pop_front();
+
+		// The messages of the other threads are shown from this one
+		wxLog::FlushActive();
+	};
+
+	for ( size_t i = 0; i < files.size(); ++i )
+	{
+		Task& task = tasks[ i ];
+		task.check = options.check;
+		if ( !Prepare( files[ i ], options.languages, task ) )
+		{
+			report( i, false );
+			continue;
+		}
+		if ( task.scheduler )
+		{
+			task.scheduler->SetMaxThreads( threadsPerProject );
+		}
+
+		if ( task.needsLibraries && !m_hasLibraries )
+		{
+			// Importing changes the object database and the working directory
+			while ( !running.empty() )
+			{
+				finishOldest();
+			}
+			ImportLibraries();
+		}
+
+		// The generators that reach the plugins use the GUI, they run here
+		if ( task.needsLibraries )
+		{
+			task.scheduler->RunPluginJobs( task.outputPath );
+		}
+
+		if ( jobs <= 1 )
+		{
+			report( i, Run( task ) );
+			continue;
+		}
+
+		while ( running.size() >= jobs )
+		{
+			finishOldest();
+		}
+		running.emplace_back( i, std::async( std::launch::async, [task]() { return Run( task ); } ) );
+	}
+
+	while ( !running.empty() )
+	{
+		finishOldest();
+	}
+
+	const size_t failed = std::count( results.begin(), results.end(), false );
+	if ( files.size() > 1 )
+	{
+		wxLogMessage( _("%lu of %lu projects generated, %lu failed."),
+			static_cast< unsigned long >( files.size() - failed ), static_cast< unsigned long >( files.size() ), static_cast< unsigned long >( failed ) );
+	}
+
+	// A check writes nothing, the depfile of the last build stays valid
+	if ( !options.depfile.empty() && !options.check && !WriteDepfile( options.depfile, tasks, results ) )
+	{
+		return false;
+	}
+
+	return ( 0 == failed );
+}
+
+bool ProjectGenerator::ReadProjectList( const wxString& file, std::vector< wxString >& projects )
+{
+	wxTextFile list;
+	if ( !wxFileName::FileExists( file ) || !list.Open( file ) )
+	{
+		wxLogError( _("Unable to read the project list: %s"), file.c_str() );
+		return false;
+	}
+
+	wxFileName listName( file );
+	listName.MakeAbsolute();
+	const wxString listPath = listName.GetPath();
+
+	for ( size_t i = 0; i < list.GetLineCount(); ++i )
+	{
+		wxString line = list[ i ].Strip( wxString::both );
+		if ( line.empty() || line.StartsWith( wxT("#") ) )
+		{
+			continue;
+		}
+
+		wxFileName project( line );
+		project.MakeAbsolute( listPath );
+		projects.push_back( project.GetFullPath() );
+	}
+
+	return true;
+}
+
+void ProjectGenerator::AddCommandLineOptions( wxCmdLineParser& parser )
+{
+	parser.AddOption( wxT("l"), wxT("language"),
+		wxT("Override the code_generation property from the passed file and generate the passed ")
+		wxT("languages. Separate multiple languages with commas.") );
+	parser.AddOption( wxT("p"), wxT("project-list"),
+		wxT("Also generate the project files listed in the passed file, one per line. Relative paths ")
+		wxT("are relative to the list.") );
+	parser.AddOption( wxT("j"), wxT("jobs"),
+		wxT("Number of projects generated at the same time, 0 to use all the processors. The ")
+		wxT("default is 1."),
+		wxCMD_LINE_VAL_NUMBER );
+	parser.AddOption( wxEmptyString, wxT("depfile"),
+		wxT("Write the passed file with a make rule per project, listing the files its generated ")
+		wxT("files are made from.") );
+	parser.AddSwitch( wxEmptyString, wxT("check"),
+		wxT("Write nothing, print the generated files whose content would change and return 8 if ")
+		wxT("there are any.") );
+}
+
+int ProjectGenerator::ParseCommandLine( const wxCmdLineParser& parser, bool requireProject, std::vector< wxString >& projects, Options& options )
+{
+	wxString language;
+	if ( parser.Found( wxT("l"), &language ) )
+	{
+		if ( language.empty() )
+		{
+			wxLogError( _("Empty language option. Nothing generated.") );
+			return 3;
+		}
+		language.Replace( wxT(","), wxT("|"), true );
+		options.languages = language;
+	}
+
+	for ( size_t i = 0; i < parser.GetParamCount(); ++i )
+	{
+		projects.push_back( parser.GetParam( i ) );
+	}
+
+	wxString projectList;
+	if ( parser.Found( wxT("p"), &projectList ) && !ReadProjectList( projectList, projects ) )
+	{
+		return 2;
+	}
+
+	if ( projects.empty() && requireProject )
+	{
+		wxLogError( _("You must pass a path to a project file. Nothing to generate.") );
+		return 2;
+	}
+
+	long jobs = 1;
+	if ( parser.Found( wxT("j"), &jobs ) && jobs < 0 )
+	{
+		wxLogError( _("The number of jobs cannot be negative. Nothing generated.") );
+		return 1;
+	}
+	options.jobs = static_cast< unsigned int >( jobs );
+
+	options.check = parser.Found( wxT("check") );
+	if ( parser.Found( wxT("depfile"), &options.depfile ) )
+	{
+		// The generator daemon runs in another directory
+		wxFileName depfile( options.depfile );
+		depfile.MakeAbsolute();
+		options.depfile = depfile.GetFullPath();
+	}
+
+	return 0;
+}
+
+bool ProjectGenerator::Prepare( const wxString& file, const wxString& languages, Task& task )
+{
+	wxFileName fileName( file );
+	fileName.MakeAbsolute();
+	task.file = fileName.GetFullPath();
+
+	// The time of a file has a resolution of a second, the content tells
+	// whether a kept project is still the same
+	bool read = false;
+	std::uint64_t size = 0;
+	std::uint64_t hash = 0;
+	wxFile projectFile;
+	if ( projectFile.Open( task.file ) && projectFile.Length() >= 0 )
+	{
+		std::string content( static_cast< size_t >( projectFile.Length() ), '\0' );
+		if ( content.empty() || projectFile.Read( &content[ 0 ], content.size() ) == static_cast< ssize_t >( content.size() ) )
+		{
+			read = true;
+			size = content.size();
+			hash = GenerationManifest::Hash( content );
+		}
+	}
+	projectFile.Close();
+
+	PObjectBase project;
+	std::map< wxString, LoadedProject >::iterator loaded = m_projects.find( task.file );
+	if ( loaded != m_projects.end() && read && loaded->second.size == size && loaded->second.hash == hash )
+	{
+		// The copy keeps the identities and revisions, the code of the fragments is reused
+		project = loaded->second.project->CreateSnapshot();
+	}
+	else
+	{
+		project = m_objDb->LoadProject( task.file );
+		if ( !project )
+		{
+			return false;
+		}
+
+		if ( m_keepProjects )
+		{
+			// The objects that did not change keep the code of their fragments
+			if ( loaded != m_projects.end() )
+			{
+				project->MatchIdentities( loaded->second.project );
+			}
+
+			LoadedProject& entry = m_projects[ task.file ];
+			entry.size = size;
+			entry.hash = hash;
+			entry.project = project;
+			project = project->CreateSnapshot();
+		}
+	}
+
+	if ( !languages.empty() )
+	{
+		// Setting the same value would still count as a change of the project
+		PProperty codeGen = project->GetProperty( wxT("code_generation") );
+		if ( codeGen && codeGen->GetValue() != languages )
+		{
+			codeGen->SetValue( languages );
+		}
+	}
+
+	const wxString projectPath = fileName.GetPath();
+	task.project = project;
+	task.projectPath = projectPath;
+	task.scheduler = std::make_shared< GenerationScheduler >( project, projectPath );
+
+	// Only the XRC generator needs the component libraries of the plugins
+	const std::vector< wxString >& enabled = task.scheduler->GetLanguages();
+	task.needsLibraries = ( std::find( enabled.begin(), enabled.end(), wxT("XRC") ) != enabled.end() );
+
+	if ( enabled.empty() )
+	{
+		return true;
+	}
+
+	try
+	{
+		task.outputPath = CodeGenerator::GetOutputPath( project, projectPath );
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( ex.what() );
+		return false;
+	}
+
+	return true;
+}
+
+bool ProjectGenerator::Run( const Task& task )
+{
+	if ( task.scheduler->GetLanguages().empty() )
+	{
+		return true;
+	}
+
+	if ( task.check )
+	{
+		if ( !task.scheduler->Check( task.outputPath ) )
+		{
+			wxLogError( _("Unable to generate the code of %s"), task.file.c_str() );
+			return false;
+		}
+
+		return true;
+	}
+
+	if ( !task.scheduler->Generate( task.outputPath ) )
+	{
+		wxLogError( _("Unable to generate the code of %s"), task.file.c_str() );
+		return false;
+	}
+
+	wxLogStatus( wxT( "Code generated on \'%s\'." ), task.outputPath.c_str() );
+	return true;
+}
+
+void ProjectGenerator::ImportLibraries()
+{
+	if ( !m_hasLibraries )
+	{
+		m_objDb->ImportComponentLibraries( PwxFBManager() );
+		m_hasLibraries = true;
+	}
+}
+
+std::vector< wxString > ProjectGenerator::GetDependencies( const Task& task ) const
+{
+	std::vector< wxString > candidates( 1, task.file );
+	const std::vector< wxString >& common = m_objDb->GetCommonFiles();
+	candidates.insert( candidates.end(), common.begin(), common.end() );
+
+	// The code templates of the languages that are not generated are not read
+	const std::vector< wxString >& languages = task.scheduler->GetLanguages();
+	auto isRead = [&languages]( const wxString& file )
+	{
+		const wxString ext = wxFileName( file ).GetExt().Lower();
+		if ( ext == wxT("cppcode") )
+		{
+			return ( std::find( languages.begin(), languages.end(), wxT("C++") ) != languages.end() );
+		}
+		if ( ext == wxT("pythoncode") )
+		{
+			return ( std::find( languages.begin(), languages.end(), wxT("Python") ) != languages.end() );
+		}
+		if ( ext == wxT("phpcode") )
+		{
+			return ( std::find( languages.begin(), languages.end(), wxT("PHP") ) != languages.end() );
+		}
+		if ( ext == wxT("luacode") )
+		{
+			return ( std::find( languages.begin(), languages.end(), wxT("Lua") ) != languages.end() );
+		}
+		return true;
+	};
+
+	std::set< PObjectInfo > classes;
+	std::vector< PObjectBase > pending( 1, task.project );
+	while ( !pending.empty() )
+	{
+		PObjectBase obj = pending.back();
+		pending.pop_back();
+
+		PObjectInfo info = obj->GetObjectInfo();
+		if ( info && classes.insert( info ).second )
+		{
+			std::vector< PObjectInfo > bases;
+			info->GetBaseClasses( bases );
+			bases.push_back( info );
+			for ( PObjectInfo base : bases )
+			{
+				const std::vector< wxString >& definitions = base->GetDefinitionFiles();
+				candidates.insert( candidates.end(), definitions.begin(), definitions.end() );
+			}
+		}
+
+		for ( unsigned int i = 0; i < obj->GetPropertyCount(); i++ )
+		{
+			PProperty prop = obj->GetProperty( i );
+			const wxString& value = prop->GetValue();
+			if ( value.empty() )
+			{
+				continue;
+			}
+
+			switch ( prop->GetType() )
+			{
+				case PT_BITMAP:
+				{
+					wxString image, source;
+					wxSize icoSize;
+					TypeConv::ParseBitmapWithResource( value, &image, &source, &icoSize );
+					if ( source == _("Load From File") || source == _("Load From Embedded File") )
+					{
+						candidates.push_back( TypeConv::MakeAbsolutePath( image, task.projectPath ) );
+					}
+					break;
+				}
+				case PT_FILE:
+					candidates.push_back( TypeConv::MakeAbsolutePath( value, task.projectPath ) );
+					break;
+				case PT_PATH:
+					// The paths of the project are where the code goes, not what it is made from
+					if ( obj != task.project )
+					{
+						candidates.push_back( TypeConv::MakeAbsolutePath( value, task.projectPath ) );
+					}
+					break;
+				default:
+					break;
+			}
+		}
+
+		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		{
+			pending.push_back( obj->GetChild( i ) );
+		}
+	}
+
+	std::vector< wxString > dependencies;
+	std::set< wxString > listed;
+	for ( const wxString& candidate : candidates )
+	{
+		wxFileName fileName( candidate );
+		fileName.MakeAbsolute();
+		const wxString path = fileName.GetFullPath();
+		if ( isRead( path ) && ( wxFileName::FileExists( path ) || wxFileName::DirExists( path ) ) && listed.insert( path ).second )
+		{
+			dependencies.push_back( path );
+		}
+	}
+
+	return dependencies;
+}
+
+bool ProjectGenerator::WriteDepfile( const wxString& depfile, const std::vector< Task >& tasks, const std::vector< bool >& results ) const
+{
+	// Make syntax, the paths of both sides are escaped the same way
+	auto escape = []( const wxString& path )
+	{
+		wxString escaped;
+		for ( wxString::const_iterator c = path.begin(); c != path.end(); ++c )
+		{
+			if ( *c == wxT(' ') || *c == wxT('#') )
+			{
+				escaped << wxT('\\');
+			}
+			else if ( *c == wxT('$') )
+			{
+				escaped << wxT('$');
+			}
+			escaped << *c;
+		}
+		return escaped;
+	};
+
+	wxString content;
+	for ( size_t i = 0; i < tasks.size(); ++i )
+	{
+		const Task& task = tasks[ i ];
+		if ( !results[ i ] || !task.scheduler || task.scheduler->GetFiles().empty() )
+		{
+			continue;
+		}
+
+		wxString rule;
+		for ( const wxString& output : task.scheduler->GetFiles() )
+		{
+			wxFileName fileName( output );
+			fileName.MakeAbsolute();
+			rule << ( rule.empty() ? wxT("") : wxT(" ") ) << escape( fileName.GetFullPath() );
+		}
+		rule << wxT(":");
+		for ( const wxString& dependency : GetDependencies( task ) )
+		{
+			rule << wxT(" \\\n  ") << escape( dependency );
+		}
+		rule << wxT("\n");
+
+		content << rule;
+	}
+
+	const wxScopedCharBuffer data = content.utf8_str();
+	wxTempFile file;
+	if ( !file.Open( depfile ) || !file.Write( data.data(), data.length() ) || !file.Commit() )
+	{
+		wxLogError( _("Unable to write the dependency file: %s"), depfile.c_str() );
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECTGENERATOR__
+#define __PROJECTGENERATOR__
+
+#include "../model/database.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+class GenerationScheduler;
+class wxCmdLineParser;
+
+/**
+* Generates the code of project files without the designer.
+*
+* No window is created and the plugins are loaded for code generation only,
+* without their icons and component libraries, so it works without a
+* display. The plugins are loaded once for all the projects generated.
+*/
+class ProjectGenerator
+{
+public:
+	/**
+	* @param dataDir Directory holding the xml and plugins directories.
+	*/
+	explicit ProjectGenerator( const wxString& dataDir );
+
+	/**
+	* Loads the object types and the plugins.
+	* Returns false if they could not be loaded.
+	*/
+	bool Init();
+
+	/**
+	* Generates the code of a project file into the output path of the project.
+	* @param languages Replaces the code_generation property if not empty.
+	*/
+	bool Generate( const wxString& file, const wxString& languages = wxEmptyString );
+
+	struct Options
+	{
+		wxString     languages; // replaces the code_generation property if not empty
+		unsigned int jobs = 1;  // projects generated at the same time, all the cores if 0
+		wxString     depfile;   // make rules of the generated files, not written if empty
+		bool         check = false; // compares the code with the files instead of writing them
+	};
+
+	/**
+	* Generates the code of several project files. The status of each project
+	* and a summary are logged. Returns false if any of them failed.
+	*/
+	bool Generate( const std::vector< wxString >& files, const Options& options );
+
+	/**
+	* Files of the projects generated by the last call to Generate(), whether
+	* their content changed or not.
+	*/
+	const std::vector< wxString >& GetGeneratedFiles() const { return m_generatedFiles; }
+
+	/**
+	* Files whose content would change, found by the last call to Generate()
+	* in check mode.
+	*/
+	const std::vector< wxString >& GetStaleFiles() const { return m_staleFiles; }
+
+	/**
+	* Keeps the loaded projects to generate them again while the content of
+	* their file does not change. The code of their objects is then found in
+	* the FragmentCache, if it is enabled. A modified project is loaded again
+	* and its unchanged objects keep their identities, so their code is still
+	* found. Off by default, each project is loaded again.
+	*/
+	void KeepProjects( bool keep ) { m_keepProjects = keep; }
+
+	/**
+	* Reads a list of project files, one per line. Empty lines and lines
+	* starting with # are skipped, relative paths are relative to the list.
+	*/
+	static bool ReadProjectList( const wxString& file, std::vector< wxString >& projects );
+
+	/**
+	* Adds the generation options shared by "wxformbuilder -g" and
+	* wxformbuilder-gen to a command line parser.
+	*/
+	static void AddCommandLineOptions( wxCmdLineParser& parser );
+
+	/**
+	* Reads the options added by AddCommandLineOptions() and the project files
+	* passed, from a parsed command line.
+	* @param requireProject Fail if no project file is passed.
+	* @return 0, or the exit code if the options are not valid.
+	*/
+	static int ParseCommandLine( const wxCmdLineParser& parser, bool requireProject, std::vector< wxString >& projects, Options& options );
+
+private:
+	struct Task
+	{
+		wxString                               file;
+		wxString                               projectPath;
+		wxString                               outputPath;
+		PObjectBase                            project;
+		std::shared_ptr< GenerationScheduler > scheduler;
+		bool                                   needsLibraries;
+		bool                                   check;
+	};
+
+	/**
+	* Loads a project and reads its settings. The object database is not
+	* thread safe, this is done on the calling thread.
+	*/
+	bool Prepare( const wxString& file, const wxString& languages, Task& task );
+
+	/**
+	* Generates a prepared project, on any thread.
+	*/
+	static bool Run( const Task& task );
+
+	/**
+	* Imports the component libraries of the plugins, once.
+	*/
+	void ImportLibraries();
+
+	/**
+	* Files read to generate a project: the project, the definitions and code
+	* templates of the classes it uses, and the files its properties refer to.
+	* Only the files that exist are listed, with absolute paths.
+	*/
+	std::vector< wxString > GetDependencies( const Task& task ) const;
+
+	/**
+	* Writes a make rule per project, its generated files depending on the
+	* files read to generate it.
+	*/
+	bool WriteDepfile( const wxString& depfile, const std::vector< Task >& tasks, const std::vector< bool >& results ) const;
+
+	struct LoadedProject
+	{
+		std::uint64_t size;
+		std::uint64_t hash; // GenerationManifest::Hash() of the content
+		PObjectBase   project;
+	};
+
+	PObjectDatabase                     m_objDb;
+	bool                                m_hasLibraries;
+	bool                                m_keepProjects;
+	std::map< wxString, LoadedProject > m_projects;
+	std::vector< wxString >             m_generatedFiles;
+	std::vector< wxString >             m_staleFiles;
+};
+
+#endif //__PROJECTGENERATOR__
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectindex.h"
+
+#include "../model/objectbase.h"
+
+ProjectIndex::ProjectIndex()
+:
+m_indexProject( false )
+{
+}
+
+ProjectIndex::ProjectIndex( PObjectBase project )
+:
+m_indexProject( true ),
+m_project( project )
+{
+	// The forms are referred to by pointer while they are filled
+	m_forms.reserve( project->GetChildCount() );
+	Visit( project, nullptr );
+}
+
+ProjectIndex::FormIndex ProjectIndex::IndexForm( PObjectBase form )
+{
+	ProjectIndex index;
+	index.m_forms.resize( 1 );
+
+	FormState state;
+	state.index = &index.m_forms.front();
+	state.index->form = form;
+	index.Visit( form, &state );
+
+	return index.m_forms.front();
+}
+
+void ProjectIndex::Visit( PObjectBase obj, FormState* form )
+{
+	bool isForm = ( form && form->index->form == obj );
+
+	if ( m_indexProject )
+	{
+		m_objects.push_back( obj );
+	}
+
+	for ( unsigned int i = 0; i < obj->GetPropertyCount(); i++ )
+	{
+		PProperty prop = obj->GetProperty( i );
+		if ( prop->GetType() == PT_MACRO )
+		{
+			const wxString& value = prop->GetValue();
+			if ( m_indexProject && m_macroSet.insert( value ).second )
+			{
+				m_macros.push_back( value );
+			}
+			if ( form && form->macros.insert( value ).second )
+			{
+				form->index->macros.push_back( value );
+			}
+		}
+		else if ( prop->GetType() == PT_BITMAP && m_indexProject )
+		{
+			const wxString& value = prop->GetValue();
+			if ( m_bitmapSet.insert( value ).second )
+			{
+				m_bitmaps.push_back( value );
+			}
+		}
+	}
+
+	if ( form )
+	{
+		for ( unsigned int i = 0; i < obj->GetEventCount(); i++ )
+		{
+			PEvent event = obj->GetEvent( i );
+			if ( !event->GetValue().empty() )
+			{
+				form->index->events.push_back( event );
+			}
+		}
+
+		if ( !isForm )
+		{
+			// Same as CodeGenerator::FindArrayObjects()
+			PProperty propName = obj->GetProperty( wxT("name") );
+			wxString baseName;
+			CodeGenerator::ArrayItem item;
+			if ( propName && CodeGenerator::ParseArrayName( propName->GetValue(), baseName, item ) )
+			{
+				CodeGenerator::ArrayItem& baseItem = form->index->arrays[ baseName ];
+				for ( size_t i = 0; i < item.maxIndex.size(); ++i )
+				{
+					if ( i < baseItem.maxIndex.size() )
+					{
+						if ( baseItem.maxIndex[ i ] < item.maxIndex[ i ] )
+						{
+							baseItem.maxIndex[ i ] = item.maxIndex[ i ];
+						}
+					}
+					else
+					{
+						baseItem.maxIndex.push_back( item.maxIndex[ i ] );
+					}
+				}
+			}
+		}
+	}
+
+	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	{
+		PObjectBase child = obj->GetChild( i );
+		if ( m_indexProject && obj == m_project )
+		{
+			m_forms.push_back( FormIndex() );
+			FormState state;
+			state.index = &m_forms.back();
+			state.index->form = child;
+			Visit( child, &state );
+		}
+		else
+		{
+			Visit( child, form );
+		}
+	}
+
+	if ( m_indexProject )
+	{
+		m_objectsBottomUp.push_back( obj );
+
+		PProperty subclass = obj->GetProperty( wxT("subclass") );
+		if ( subclass && !subclass->GetChildFromParent( wxT("name") ).empty() )
+		{
+			m_subclassed.push_back( obj );
+		}
+	}
+}
@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECTINDEX__
+#define __PROJECTINDEX__
+
+#include "codegen.h"
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+/**
+* What the code generators need to know about a project before generating
+* it, collected in a single walk over the tree. Nothing in it depends on the
+* language, so one index serves every generator working on the same tree.
+*
+* The index refers to the objects of the tree, it must be built again if the
+* tree changes.
+*/
+class ProjectIndex
+{
+public:
+	/**
+	* What is found below a form, the form included.
+	*/
+	struct FormIndex
+	{
+		PObjectBase               form;
+		EventVector               events;       // events with a handler, in tree order
+		std::vector< wxString >   macros;       // values of the macro properties, each once, in tree order
+		CodeGenerator::ArrayItems arrays;       // arrays declared below the form
+	};
+
+	/**
+	* Indexes the project. The forms are the children of the project.
+	*/
+	explicit ProjectIndex( PObjectBase project );
+
+	/**
+	* Indexes a single form, for the code that works on one form only.
+	*/
+	static FormIndex IndexForm( PObjectBase form );
+
+	PObjectBase GetProject() const { return m_project; }
+
+	/**
+	* Every object of the project, parents before their children.
+	*/
+	const std::vector< PObjectBase >& GetObjects() const { return m_objects; }
+
+	/**
+	* Every object of the project, children before their parents.
+	*/
+	const std::vector< PObjectBase >& GetObjectsBottomUp() const { return m_objectsBottomUp; }
+
+	/**
+	* Objects with a subclass name, children before their parents.
+	*/
+	const std::vector< PObjectBase >& GetSubclassedObjects() const { return m_subclassed; }
+
+	/**
+	* Values of the macro properties of the whole project, each once, in tree order.
+	*/
+	const std::vector< wxString >& GetMacros() const { return m_macros; }
+
+	/**
+	* Values of the bitmap properties of the whole project, each once.
+	*/
+	const std::vector< wxString >& GetBitmaps() const { return m_bitmaps; }
+
+	/**
+	* The forms of the project, in the order of the project.
+	*/
+	const std::vector< FormIndex >& GetForms() const { return m_forms; }
+
+private:
+	typedef std::unordered_set< wxString, wxStringHash, wxStringEqual > StringSet;
+
+	struct FormState
+	{
+		FormIndex* index;
+		StringSet  macros;
+	};
+
+	ProjectIndex();
+
+	void Visit( PObjectBase obj, FormState* form );
+
+	bool                       m_indexProject; // false when only a form is indexed
+	PObjectBase                m_project;
+	std::vector< PObjectBase > m_objects;
+	std::vector< PObjectBase > m_objectsBottomUp;
+	std::vector< PObjectBase > m_subclassed;
+	std::vector< wxString >    m_macros;
+	StringSet                  m_macroSet;
+	std::vector< wxString >    m_bitmaps;
+	StringSet                  m_bitmapSet;
+	std::vector< FormIndex >   m_forms;
+};
+
+#endif //__PROJECTINDEX__
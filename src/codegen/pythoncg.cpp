@@ -28,24 +28,27 @@
 
 #include "pythoncg.h"
 
+#include "../model/database.h"
 #include "../model/objectbase.h"
-#include "../rad/appdata.h"
 #include "../utils/debug.h"
 #include "../utils/typeconv.h"
 #include "../utils/wxfbexception.h"
 #include "codewriter.h"
+#include "projectindex.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 #include <wx/filename.h>
 #include <wx/tokenzr.h>
 
-PythonTemplateParser::PythonTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString imagePathWrapperFunctionName )
+PythonTemplateParser::PythonTemplateParser( PObjectBase obj, wxString _template, bool useI18N, bool useRelativePath, wxString basePath, wxString projectPath, wxString imagePathWrapperFunctionName )
 :
 TemplateParser(obj,_template),
 m_i18n( useI18N ),
 m_useRelativePath( useRelativePath ),
 m_basePath( basePath ),
+m_projectPath( projectPath ),
 m_imagePathWrapperFunctionName ( imagePathWrapperFunctionName )
 {
 	if ( !wxFileName::DirExists( m_basePath ) )
@@ -62,6 +65,7 @@ TemplateParser( that, _template ),
 m_i18n( that.m_i18n ),
 m_useRelativePath( that.m_useRelativePath ),
 m_basePath( that.m_basePath ),
+m_projectPath( that.m_projectPath ),
 m_imagePathWrapperFunctionName( that.m_imagePathWrapperFunctionName )
 {
 	SetupModulePrefixes();
@@ -72,6 +76,13 @@ wxString PythonTemplateParser::RootWxParentToCode()
 	return wxT("self");
 }
 
+bool PythonTemplateParser::GetCacheSettings( wxString& settings )
+{
+	// Bitmap paths depend on the location of the project too
+	settings << ( m_i18n ? wxT("1") : wxT("0") ) << ( m_useRelativePath ? wxT("1") : wxT("0") ) << m_basePath << wxT('\x01') << m_projectPath << wxT('\x01') << m_imagePathWrapperFunctionName;
+	return true;
+}
+
 PTemplateParser PythonTemplateParser::CreateParser( const TemplateParser* oldparser, wxString _template )
 {
 	const PythonTemplateParser* pythonOldParser = dynamic_cast< const PythonTemplateParser* >( oldparser );
@@ -288,7 +299,7 @@ wxString PythonTemplateParser::ValueToCode( PropertyType type, wxString value )
 				wxString absPath;
 				try
 				{
-					absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
+					absPath = TypeConv::MakeAbsolutePath( path, m_projectPath );
 				}
 				catch( wxFBException& ex )
 				{
@@ -453,8 +464,7 @@ void PythonCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObje
 	m_source->WriteLn( code );
 
 	// Do events
-	EventVector events;
-	FindEventHandlers( form, events );
+	EventVector events = ProjectIndex::IndexForm( form ).events;
 
 	if ( events.size() > 0 )
 	{
@@ -534,19 +544,22 @@ bool PythonCodeGenerator::GenerateCode( PObjectBase project )
 		file = wxT("noname");
 	}
 
+	// What is needed from the whole project, in one go
+	PProjectIndex index = GetProjectIndex( project );
+
 	// Generate the subclass sets
 	std::set< wxString > subclasses;
-	std::vector< wxString > headerIncludes;
+	IncludeList headerIncludes;
 
-	GenSubclassSets( project, &subclasses, &headerIncludes );
+	GenSubclassSets( *index, &subclasses, &headerIncludes );
 
 	// Generating in the .h header file those include from components dependencies.
 	std::set< wxString > templates;
-	GenIncludes(project, &headerIncludes, &templates );
+	GenIncludes( project, &headerIncludes, &templates );
 
 	// Write the include lines
-	std::vector<wxString>::iterator include_it;
-	for ( include_it = headerIncludes.begin(); include_it != headerIncludes.end(); ++include_it )
+	std::vector<wxString>::const_iterator include_it;
+	for ( include_it = headerIncludes.GetLines().begin(); include_it != headerIncludes.GetLines().end(); ++include_it )
 	{
 		m_source->WriteLn( *include_it );
 	}
@@ -564,7 +577,7 @@ bool PythonCodeGenerator::GenerateCode( PObjectBase project )
 	}
 
 	// Generating "defines" for macros
-	GenDefines( project );
+	GenDefines( *index );
 
 	wxString eventHandlerPostfix;
 	PProperty eventKindProp = project->GetProperty( wxT("skip_python_events") );
@@ -578,16 +591,13 @@ bool PythonCodeGenerator::GenerateCode( PObjectBase project )
 	PProperty disconnectMode = project->GetProperty( wxT("disconnect_mode") );
 	m_disconnecMode = disconnectMode->GetValueAsString();
 
-	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
+	for ( const ProjectIndex::FormIndex& form : index->GetForms() )
 	{
-		PObjectBase child = project->GetChild( i );
-
-		// Preprocess to find arrays
-		ArrayItems arrays;
-		FindArrayObjects(child, arrays, true);
+		PObjectBase child = form.form;
 
-		EventVector events;
-		FindEventHandlers( child, events );
+		// The declaration state of the arrays is per class
+		ArrayItems arrays = form.arrays;
+		const EventVector& events = form.events;
 		//GenClassDeclaration( child, useEnum, classDecoration, events, eventHandlerPrefix, eventHandlerPostfix );
 		GenClassDeclaration(child, false, wxEmptyString, events, eventHandlerPostfix, arrays);
 	}
@@ -689,8 +699,8 @@ bool PythonCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info,
 			else
 				_template.Replace( wxT("#handler"), wxT("self.") + handlerName );
 
-			PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
-			m_source->WriteLn( parser.ParseTemplate() );
+			PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+			parser.ParseTemplate( m_source );
 			return true;
 		}
 	}
@@ -758,7 +768,8 @@ void PythonCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase
 		wxString _template = code_info->GetTemplate( wxT("generated_event_handlers") );
 		if ( !_template.empty() )
 		{
-			PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
+			PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+			parser.SetProgram( code_info->GetProgram( wxT("generated_event_handlers") ) );
 			wxString code = parser.ParseTemplate();
 
 			if ( !code.empty() )
@@ -809,12 +820,30 @@ wxString PythonCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silen
 
 	_template = code_info->GetTemplate(name);
 
-	PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
+	PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+	parser.SetProgram( code_info->GetProgram( name ) );
 	wxString code = parser.ParseTemplate();
 
 	return code;
 }
 
+void PythonCodeGenerator::WriteCode( PCodeWriter writer, PObjectBase obj, wxString name )
+{
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT("Python") );
+
+	if ( !code_info )
+	{
+		wxLogError( wxT("Missing \"%s\" template for \"%s\" class. Review your XML object description"),
+					name.c_str(), obj->GetClassName().c_str() );
+		writer->WriteLn();
+		return;
+	}
+
+	PythonTemplateParser parser( obj, code_info->GetTemplate( name ), m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+	parser.SetProgram( code_info->GetProgram( name ) );
+	parser.ParseTemplate( writer );
+}
+
 wxString PythonCodeGenerator::GetConstruction(PObjectBase obj, bool silent, ArrayItems& arrays)
 {
 	// Get the name
@@ -936,18 +965,13 @@ void PythonCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool /*use_
 	m_source->WriteLn(wxEmptyString);
 }
 
-void PythonCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes )
+void PythonCodeGenerator::GenSubclassSets( const ProjectIndex& index, std::set< wxString >* subclasses, IncludeList* headerIncludes )
 {
-	// Call GenSubclassForwardDeclarations on all children as well
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
-	{
-		GenSubclassSets( obj->GetChild( i ), subclasses, headerIncludes );
-	}
-
-	// Fill the set
-	PProperty subclass = obj->GetProperty( wxT("subclass") );
-	if ( subclass )
+	// Children come before their parents, as they always did
+	for ( const PObjectBase& obj : index.GetSubclassedObjects() )
 	{
+		// Fill the set
+		PProperty subclass = obj->GetProperty( wxT("subclass") );
 		std::map< wxString, wxString > children;
 		subclass->SplitParentProperty( &children );
 
@@ -957,14 +981,14 @@ void PythonCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >
 		if ( children.end() == name )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		wxString nameVal = name->second;
 		if ( nameVal.empty() )
 		{
 			// No name, so do nothing
-			return;
+			continue;
 		}
 
 		// Now get the header
@@ -974,50 +998,47 @@ void PythonCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >
 		if ( children.end() == header )
 		{
 			// No header, so do nothing
-			return;
+			continue;
 		}
 
 		wxString headerVal = header->second;
 		if ( headerVal.empty() )
 		{
 			// No header, so do nothing
-			return;
+			continue;
 		}
 
 		// Got a header
 		PObjectInfo info = obj->GetObjectInfo();
 		if ( !info )
 		{
-			return;
+			continue;
 		}
 
 		PObjectPackage pkg = info->GetPackage();
 		if ( !pkg )
 		{
-			return;
+			continue;
 		}
 
 		wxString include = wxT("from ") + headerVal + wxT(" import ") + nameVal;
-		std::vector< wxString >::iterator it = std::find( headerIncludes->begin(), headerIncludes->end(), include );
-		if ( headerIncludes->end() == it )
-		{
-			headerIncludes->push_back( include );
-		}
+		headerIncludes->AddUnique( include );
 	}
 }
 
-void PythonCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>* includes, std::set< wxString >* templates )
+void PythonCodeGenerator::GenIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates )
 {
 	GenObjectIncludes( project, includes, templates );
 }
 
-void PythonCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
+void PythonCodeGenerator::GenObjectIncludes( PObjectBase project, IncludeList* includes, std::set< wxString >* templates )
 {
 	// Fill the set
 	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("Python") );
 	if (code_info)
 	{
-		PythonTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
+		PythonTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+		parser.SetProgram( code_info->GetProgram( wxT("include") ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1038,7 +1059,7 @@ void PythonCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< w
 	GenBaseIncludes( project->GetObjectInfo(), project, includes, templates );
 }
 
-void PythonCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates )
+void PythonCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, IncludeList* includes, std::set< wxString >* templates )
 {
 	if ( !info )
 	{
@@ -1055,7 +1076,8 @@ void PythonCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, st
 	PCodeInfo code_info = info->GetCodeInfo( wxT("Python") );
 	if ( code_info )
 	{
-		PythonTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
+		PythonTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+		parser.SetProgram( code_info->GetProgram( wxT("include") ) );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1067,7 +1089,7 @@ void PythonCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, st
 	}
 }
 
-void PythonCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes )
+void PythonCodeGenerator::AddUniqueIncludes( const wxString& include, IncludeList* includes )
 {
 	// Split on newlines to only generate unique include lines
 	// This strips blank lines and trims
@@ -1082,31 +1104,12 @@ void PythonCodeGenerator::AddUniqueIncludes( const wxString& include, std::vecto
 		// If it is not an include line, it will be written
 		if ( !line.StartsWith( wxT("import") ) )
 		{
-			includes->push_back( line );
+			includes->Add( line );
 			continue;
 		}
 
 		// If it is an include, it must be unique to be written
-		std::vector< wxString >::iterator it = std::find( includes->begin(), includes->end(), line );
-		if ( includes->end() == it )
-		{
-			includes->push_back( line );
-		}
-	}
-}
-
-void PythonCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set )
-{
-	unsigned int ch_count = obj->GetChildCount();
-	if (ch_count > 0)
-	{
-		unsigned int i;
-		for (i = 0; i<ch_count; i++)
-		{
-			PObjectBase child = obj->GetChild(i);
-			info_set.insert(child->GetObjectInfo());
-			FindDependencies(child, info_set);
-		}
+		includes->AddUnique( line );
 	}
 }
 
@@ -1114,10 +1117,10 @@ void PythonCodeGenerator::GenConstructor(PObjectBase class_obj, const EventVecto
 {
 	m_source->WriteLn();
 	// generate function definition
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_def") ) );
+	WriteCode( m_source, class_obj, wxT("cons_def") );
 	m_source->Indent();
 
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_call") ) );
+	WriteCode( m_source, class_obj, wxT("cons_call") );
 	m_source->WriteLn();
 
 	wxString settings = GetCode( class_obj, wxT("settings") );
@@ -1221,8 +1224,8 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, Array
 					wxT("#ifnull #parent $size")
 					wxT("@{ #nl $name.Fit( #wxparent $name ) @}");
 
-				PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
-				m_source->WriteLn(parser.ParseTemplate());
+				PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+				parser.ParseTemplate( m_source );
 			}
 		}
 		else if ( type == wxT("splitter") )
@@ -1236,8 +1239,8 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, Array
 					wxString _template = wxT("self.$name.Initialize( ");
 					_template = _template + wxT("self.") + sub1->GetProperty( wxT("name") )->GetValue() + wxT(" )");
 
-					PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
-					m_source->WriteLn(parser.ParseTemplate());
+					PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				case 2:
@@ -1259,8 +1262,8 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, Array
 					_template = _template + wxT("self.") + sub1->GetProperty( wxT("name") )->GetValue() +
 						wxT(", self.") + sub2->GetProperty( wxT("name") )->GetValue() + wxT(", $sashpos )");
 
-					PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
-					m_source->WriteLn(parser.ParseTemplate());
+					PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+					parser.ParseTemplate( m_source );
 					break;
 				}
 				default:
@@ -1317,7 +1320,7 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, Array
 			return;
 		}
 
-		m_source->WriteLn( GetCode( obj, temp_name ) );
+		WriteCode( m_source, obj, temp_name );
 	}
 	else if (	type == wxT("notebookpage")		||
 				type == wxT("flatnotebookpage")	||
@@ -1328,12 +1331,12 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, Array
 			)
 	{
 		GenConstruction(obj->GetChild(0), false, arrays);
-		m_source->WriteLn( GetCode( obj, wxT("page_add") ) );
+		WriteCode( m_source, obj, wxT("page_add") );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("treelistctrlcolumn") )
 	{
-		m_source->WriteLn( GetCode( obj, wxT("column_add") ) );
+		WriteCode( m_source, obj, wxT("column_add") );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("tool") )
@@ -1382,7 +1385,8 @@ void PythonCodeGenerator::GenDestruction( PObjectBase obj )
 
 		if ( !_template.empty() )
 		{
-			PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
+			PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+			parser.SetProgram( code_info->GetProgram( wxT( "destruction" ) ) );
 			wxString code = parser.ParseTemplate();
 			if ( !code.empty() )
 			{
@@ -1399,62 +1403,33 @@ void PythonCodeGenerator::GenDestruction( PObjectBase obj )
 	}
 }
 
-void PythonCodeGenerator::FindMacros( PObjectBase obj, std::vector<wxString>* macros )
+void PythonCodeGenerator::FindMacros( const std::vector< wxString >& values, std::vector<wxString>* macros )
 {
-	// iterate through all of the properties of all objects, add the macros
-	// to the vector
-	unsigned int i;
+	std::unordered_set< wxString, wxStringHash, wxStringEqual > found;
 
-	for ( i = 0; i < obj->GetPropertyCount(); i++ )
+	for ( wxString value : values )
 	{
-		PProperty prop = obj->GetProperty( i );
-		if ( prop->GetType() == PT_MACRO )
-		{
-			wxString value = prop->GetValue();
-			if( value.IsEmpty() ) continue;
+		if( value.IsEmpty() ) continue;
 
-			//if( value.Contains( wxT("wx") ) && !value.Contains( wxT("wx.") ) ) value.Replace( wxT("wx"), wxT("wx.") );
-			value.Replace( wxT("wx"), wxT("wx.") );
+		//if( value.Contains( wxT("wx") ) && !value.Contains( wxT("wx.") ) ) value.Replace( wxT("wx"), wxT("wx.") );
+		value.Replace( wxT("wx"), wxT("wx.") );
 
-			// Skip wx IDs
-			if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
-				 ( m_predMacros.end() == m_predMacros.find( value ) ) )
+		// Skip wx IDs
+		if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
+			 ( m_predMacros.end() == m_predMacros.find( value ) ) )
+		{
+			if ( found.insert( value ).second )
 			{
-				if ( macros->end() == std::find( macros->begin(), macros->end(), value ) )
-				{
-					macros->push_back( value );
-				}
+				macros->push_back( value );
 			}
 		}
 	}
-
-	for ( i = 0; i < obj->GetChildCount(); i++ )
-	{
-		FindMacros( obj->GetChild( i ), macros );
-	}
-}
-
-void PythonCodeGenerator::FindEventHandlers(PObjectBase obj, EventVector &events)
-{
-  unsigned int i;
-  for (i=0; i < obj->GetEventCount(); i++)
-  {
-	PEvent event = obj->GetEvent(i);
-	if (!event->GetValue().IsEmpty())
-	  events.push_back(event);
-  }
-
-  for (i=0; i < obj->GetChildCount(); i++)
-  {
-	PObjectBase child = obj->GetChild(i);
-	FindEventHandlers(child,events);
-  }
 }
 
-void PythonCodeGenerator::GenDefines( PObjectBase project)
+void PythonCodeGenerator::GenDefines( const ProjectIndex& index )
 {
 	std::vector< wxString > macros;
-	FindMacros( project, &macros );
+	FindMacros( index.GetMacros(), &macros );
 
 	// Remove the default macro from the set, for backward compatiblity
 	std::vector< wxString >::iterator it;
@@ -1497,7 +1472,8 @@ void PythonCodeGenerator::GenSettings(PObjectInfo info, PObjectBase obj)
 
 	if ( !_template.empty() )
 	{
-		PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
+		PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+		parser.SetProgram( code_info->GetProgram( wxT("settings") ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
@@ -1534,7 +1510,8 @@ void PythonCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj,
 
 	if ( !_template.empty() )
 	{
-		PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_imagePathWrapperFunctionName );
+		PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_projectPath, m_imagePathWrapperFunctionName );
+		parser.SetProgram( code_info->GetProgram( wxT( "toolbar_add" ) ) );
 		wxString code = parser.ParseTemplate();
 		if ( !code.empty() )
 		{
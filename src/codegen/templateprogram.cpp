@@ -0,0 +1,655 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "templateprogram.h"
+
+#include "../model/objectbase.h"
+
+#include <cstdio>
+
+#include <wx/tokenzr.h>
+
+namespace
+{
+	/**
+	* Reads a template the way wxStringInputStream reads it for TemplateParser:
+	* byte by byte over the UTF-8 text, Peek() returns 0 and GetC() EOF past
+	* the end, and both set the end of stream flag.
+	*/
+	class TemplateReader
+	{
+	public:
+		explicit TemplateReader( const std::string& source )
+		:
+		m_source( source ),
+		m_pos( 0 ),
+		m_eof( false )
+		{
+		}
+
+		bool Eof() const { return m_eof; }
+		size_t Tell() const { return m_pos; }
+
+		char Peek()
+		{
+			if ( m_pos < m_source.size() )
+			{
+				return m_source[ m_pos ];
+			}
+			m_eof = true;
+			return 0;
+		}
+
+		int GetC()
+		{
+			if ( m_pos < m_source.size() )
+			{
+				return static_cast< unsigned char >( m_source[ m_pos++ ] );
+			}
+			m_eof = true;
+			return EOF;
+		}
+
+	private:
+		const std::string& m_source;
+		size_t m_pos;
+		bool m_eof;
+	};
+
+	/**
+	* Compiles a block following the steps of TemplateParser. Every method
+	* consumes the same characters as its TemplateParser counterpart, and
+	* returns false for the cases the program doesn't handle.
+	* The templates are compiled while the object definitions are loaded, the
+	* names of properties defined by a later package are interned here.
+	*/
+	class TemplateCompiler
+	{
+	public:
+		explicit TemplateCompiler( TemplateProgram::Block& block )
+		:
+		m_block( block ),
+		m_in( block.source )
+		{
+		}
+
+		bool Compile();
+
+	private:
+		typedef TemplateProgram::Instruction Instruction;
+
+		TemplateProgram::Block& m_block;
+		TemplateReader m_in;
+
+		enum Token
+		{
+			TOK_ERROR,
+			TOK_MACRO,
+			TOK_TEXT,
+			TOK_PROPERTY
+		};
+
+		Token GetNextToken();
+		void IgnoreWhitespaces();
+		wxString ParseIdent();
+		wxString ParsePropertyName( wxString* child = nullptr );
+		bool ExtractLiteral( wxString& literal );
+		bool ExtractInnerTemplate( std::shared_ptr< TemplateProgram::Block >& block );
+
+		bool CompileText();
+		bool CompileProperty();
+		bool CompileMacro();
+		bool CompileCondition( Instruction& instruction, bool hasLiteral );
+		bool CompileTypeCondition( Instruction& instruction );
+
+		void Emit( const Instruction& instruction ) { m_block.code.push_back( instruction ); }
+		void EmitText( const wxString& text );
+	};
+
+	bool TemplateCompiler::Compile()
+	{
+		while ( !m_in.Eof() )
+		{
+			bool ok = true;
+			switch ( GetNextToken() )
+			{
+				case TOK_MACRO:
+					ok = CompileMacro();
+					break;
+				case TOK_PROPERTY:
+					ok = CompileProperty();
+					break;
+				case TOK_TEXT:
+					ok = CompileText();
+					break;
+				default:
+					ok = false;
+					break;
+			}
+
+			if ( !ok )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	TemplateCompiler::Token TemplateCompiler::GetNextToken()
+	{
+		Token result = TOK_ERROR;
+
+		if ( !m_in.Eof() )
+		{
+			wxChar c = m_in.Peek();
+			if ( c == wxT('#') )
+				result = TOK_MACRO;
+			else if ( c == wxT('$') )
+				result = TOK_PROPERTY;
+			else
+				result = TOK_TEXT;
+		}
+
+		return result;
+	}
+
+	void TemplateCompiler::IgnoreWhitespaces()
+	{
+		wxChar peek( m_in.Peek() );
+		while ( peek != wxChar(EOF) && !m_in.Eof() && peek == wxT(' ') )
+		{
+			m_in.GetC();
+			peek = wxChar( m_in.Peek() );
+		}
+	}
+
+	wxString TemplateCompiler::ParseIdent()
+	{
+		wxString macro;
+
+		m_in.GetC();
+
+		wxChar peek( m_in.Peek() );
+		while ( peek != wxChar(EOF) && !m_in.Eof() && peek != wxT('#') && peek != wxT('$')
+			&& ( ( peek >= wxT('a') && peek <= wxT('z') ) ||
+			( peek >= wxT('A') && peek <= wxT('Z') ) ||
+			( peek >= wxT('0') && peek <= wxT('9') ) ) )
+		{
+			macro += wxChar( m_in.GetC() );
+			peek = wxChar( m_in.Peek() );
+		}
+
+		return macro;
+	}
+
+	wxString TemplateCompiler::ParsePropertyName( wxString* child )
+	{
+		wxString propname;
+
+		bool foundSlash = false;
+		bool foundLeftCurlyBracket = false;
+		bool saveChild = ( child != nullptr );
+
+		if ( !m_in.Eof() )
+		{
+			m_in.GetC();
+
+			wxChar peek( m_in.Peek() );
+			while ( peek != wxChar(EOF) && !m_in.Eof() && peek != wxT('#') && peek != wxT('$')
+				&& ( ( peek >= wxT('a') && peek <= wxT('z') ) ||
+				( peek >= wxT('A') && peek <= wxT('Z') ) ||
+				( peek >= wxT('0') && peek <= wxT('9') ) ||
+				( peek >= wxT('{') && peek <= wxT('}') ) ||
+				peek == wxT('_') || peek == wxT('/') ) )
+			{
+				if ( foundSlash )
+				{
+					if ( saveChild )
+					{
+						(*child) << wxChar( m_in.GetC() );
+					}
+					else
+					{
+						m_in.GetC();
+					}
+				}
+				else
+				{
+					wxChar next = wxChar( m_in.GetC() );
+					if ( wxT('{') == next )
+					{
+						foundLeftCurlyBracket = true;
+					}
+					else if ( ( wxT('}') == next ) && foundLeftCurlyBracket )
+					{
+						break;
+					}
+					else if ( wxT('/') == next )
+					{
+						foundSlash = true;
+					}
+					else
+					{
+						propname << next;
+					}
+				}
+				peek = wxChar( m_in.Peek() );
+			}
+		}
+
+		return propname;
+	}
+
+	bool TemplateCompiler::ExtractLiteral( wxString& literal )
+	{
+		IgnoreWhitespaces();
+
+		if ( m_in.GetC() != '"' )
+		{
+			return false;
+		}
+
+		bool end = false;
+		while ( !end && !m_in.Eof() && m_in.Peek() != EOF )
+		{
+			int c = m_in.GetC();
+			if ( c == '"' )
+			{
+				if ( m_in.Peek() == '"' )
+				{
+					m_in.GetC();
+					literal << wxT('"');
+				}
+				else
+				{
+					end = true;
+
+					// TemplateParser skips everything up to the next space
+					wxChar peek( m_in.Peek() );
+					while ( peek != wxChar(EOF) && !m_in.Eof() && peek != wxT(' ') )
+					{
+						m_in.GetC();
+						peek = wxChar( m_in.Peek() );
+					}
+				}
+			}
+			else
+			{
+				literal << wxChar( c );
+			}
+		}
+
+		return end;
+	}
+
+	bool TemplateCompiler::ExtractInnerTemplate( std::shared_ptr< TemplateProgram::Block >& block )
+	{
+		IgnoreWhitespaces();
+
+		if ( m_in.GetC() != '@' || m_in.GetC() != '{' )
+		{
+			return false;
+		}
+
+		IgnoreWhitespaces();
+
+		// Extracted as TemplateParser does, the inner parser reads it as a new template
+		wxString os;
+		int level = 1;
+		bool end = false;
+		while ( !end && !m_in.Eof() && m_in.Peek() != EOF )
+		{
+			int c1 = m_in.GetC();
+			if ( c1 == '@' )
+			{
+				int c2 = m_in.GetC();
+				if ( c2 == EOF )
+				{
+					return false;
+				}
+
+				if ( c2 == '}' )
+				{
+					level--;
+					if ( level == 0 )
+					{
+						end = true;
+					}
+					else
+					{
+						os << wxChar( c1 ) << wxChar( c2 );
+					}
+				}
+				else
+				{
+					os << wxChar( c1 ) << wxChar( c2 );
+					if ( c2 == '{' )
+					{
+						level++;
+					}
+				}
+			}
+			else
+			{
+				os << wxChar( c1 );
+			}
+		}
+
+		if ( !end )
+		{
+			return false;
+		}
+
+		block = std::make_shared< TemplateProgram::Block >();
+		block->source = std::string( os.utf8_str() );
+		return TemplateCompiler( *block ).Compile();
+	}
+
+	void TemplateCompiler::EmitText( const wxString& text )
+	{
+		if ( text.empty() )
+		{
+			return;
+		}
+
+		if ( !m_block.code.empty() && m_block.code.back().op == TemplateProgram::OP_TEXT )
+		{
+			m_block.code.back().text << text;
+			return;
+		}
+
+		Instruction instruction;
+		instruction.op = TemplateProgram::OP_TEXT;
+		instruction.text = text;
+		instruction.source = m_in.Tell();
+		Emit( instruction );
+	}
+
+	bool TemplateCompiler::CompileText()
+	{
+		wxString text;
+		int sspace = 0;
+
+		if ( !m_in.Eof() )
+		{
+			wxChar peek( m_in.Peek() );
+
+			while ( peek != wxChar(EOF) && !m_in.Eof() && peek != wxT('#') && peek != wxT('$') )
+			{
+				int c = m_in.GetC();
+				if ( c == '@' )
+				{
+					c = m_in.GetC();
+					if ( c == EOF )
+					{
+						return false;
+					}
+					if ( c == ' ' )
+					{
+						sspace++;
+					}
+				}
+
+				text << wxChar( c );
+				peek = wxChar( m_in.Peek() );
+			}
+		}
+
+		if ( text.find_first_not_of( wxT("\r\n\t ") ) != text.npos )
+		{
+			EmitText( text );
+		}
+		else
+		{
+			EmitText( wxString( wxT(' '), sspace ) );
+		}
+
+		return true;
+	}
+
+	bool TemplateCompiler::CompileProperty()
+	{
+		Instruction instruction;
+		instruction.op = TemplateProgram::OP_PROPERTY;
+		instruction.source = m_in.Tell();
+		instruction.name = ParsePropertyName( &instruction.child );
+		instruction.atom = PropertyAtoms::Intern( instruction.name );
+		Emit( instruction );
+
+		return true;
+	}
+
+	bool TemplateCompiler::CompileCondition( Instruction& instruction, bool hasLiteral )
+	{
+		IgnoreWhitespaces();
+
+		// See TemplateParser::GetProperty(), the program follows the path
+		// where the property is found
+		Token token = GetNextToken();
+		if ( token == TOK_MACRO )
+		{
+			wxString relative = ParseIdent();
+			if ( relative == wxT("wxparent") )
+				instruction.relative = TemplateProgram::REL_WXPARENT;
+			else if ( relative == wxT("parent") )
+				instruction.relative = TemplateProgram::REL_PARENT;
+			else if ( relative == wxT("child") )
+				instruction.relative = TemplateProgram::REL_CHILD;
+			else
+				return false;
+
+			IgnoreWhitespaces();
+			instruction.name = ParsePropertyName();
+		}
+		else if ( token == TOK_PROPERTY )
+		{
+			instruction.name = ParsePropertyName( &instruction.child );
+		}
+		else
+		{
+			// There is no property, TemplateParser ignores the macro
+			return true;
+		}
+		instruction.atom = PropertyAtoms::Intern( instruction.name );
+
+		if ( hasLiteral )
+		{
+			if ( !ExtractLiteral( instruction.text ) )
+			{
+				return false;
+			}
+
+			wxStringTokenizer tokens( instruction.text, wxT("||") );
+			while ( tokens.HasMoreTokens() )
+			{
+				wxString value = tokens.GetNextToken();
+				instruction.values.push_back( value.Trim().Trim( false ) );
+			}
+		}
+
+		if ( !ExtractInnerTemplate( instruction.block ) )
+		{
+			return false;
+		}
+
+		Emit( instruction );
+		return true;
+	}
+
+	bool TemplateCompiler::CompileTypeCondition( Instruction& instruction )
+	{
+		if ( !ExtractLiteral( instruction.text ) )
+		{
+			return false;
+		}
+
+		wxStringTokenizer tokens( instruction.text, wxT("||") );
+		while ( tokens.HasMoreTokens() )
+		{
+			wxString value = tokens.GetNextToken();
+			instruction.values.push_back( value.Trim().Trim( false ) );
+		}
+
+		if ( !ExtractInnerTemplate( instruction.block ) )
+		{
+			return false;
+		}
+
+		Emit( instruction );
+		return true;
+	}
+
+	bool TemplateCompiler::CompileMacro()
+	{
+		Instruction instruction;
+		instruction.source = m_in.Tell();
+
+		wxString ident = ParseIdent();
+
+		if ( ident == wxT("wxparent") || ident == wxT("parent") || ident == wxT("form") ||
+			ident == wxT("wizard") || ident == wxT("child") )
+		{
+			if ( ident == wxT("wxparent") )
+				instruction.op = TemplateProgram::OP_WXPARENT;
+			else if ( ident == wxT("parent") )
+				instruction.op = TemplateProgram::OP_PARENT;
+			else if ( ident == wxT("child") )
+				instruction.op = TemplateProgram::OP_CHILD;
+			else
+				instruction.op = TemplateProgram::OP_FORM;
+
+			IgnoreWhitespaces();
+			instruction.name = ParsePropertyName();
+			instruction.atom = PropertyAtoms::Intern( instruction.name );
+			Emit( instruction );
+			return true;
+		}
+		else if ( ident == wxT("ifnotnull") )
+		{
+			instruction.op = TemplateProgram::OP_IFNOTNULL;
+			return CompileCondition( instruction, false );
+		}
+		else if ( ident == wxT("ifnull") )
+		{
+			instruction.op = TemplateProgram::OP_IFNULL;
+			return CompileCondition( instruction, false );
+		}
+		else if ( ident == wxT("ifequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFEQUAL;
+			return CompileCondition( instruction, true );
+		}
+		else if ( ident == wxT("ifnotequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFNOTEQUAL;
+			return CompileCondition( instruction, true );
+		}
+		else if ( ident == wxT("ifparenttypeequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFPARENTTYPEEQUAL;
+			return CompileTypeCondition( instruction );
+		}
+		else if ( ident == wxT("ifparenttypenotequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFPARENTTYPENOTEQUAL;
+			return CompileTypeCondition( instruction );
+		}
+		else if ( ident == wxT("ifparentclassequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFPARENTCLASSEQUAL;
+			return CompileTypeCondition( instruction );
+		}
+		else if ( ident == wxT("ifparentclassnotequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFPARENTCLASSNOTEQUAL;
+			return CompileTypeCondition( instruction );
+		}
+		else if ( ident == wxT("iftypeequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFTYPEEQUAL;
+			return CompileTypeCondition( instruction );
+		}
+		else if ( ident == wxT("iftypenotequal") )
+		{
+			instruction.op = TemplateProgram::OP_IFTYPENOTEQUAL;
+			return CompileTypeCondition( instruction );
+		}
+		else if ( ident == wxT("foreach") )
+		{
+			IgnoreWhitespaces();
+			if ( GetNextToken() == TOK_PROPERTY )
+			{
+				instruction.op = TemplateProgram::OP_FOREACH;
+				instruction.name = ParsePropertyName();
+				instruction.atom = PropertyAtoms::Intern( instruction.name );
+				if ( !ExtractInnerTemplate( instruction.block ) )
+				{
+					return false;
+				}
+				Emit( instruction );
+			}
+			return true;
+		}
+		else if ( ident == wxT("append") )
+		{
+			IgnoreWhitespaces();
+			instruction.op = TemplateProgram::OP_APPEND;
+		}
+		else if ( ident == wxT("pred") )
+			instruction.op = TemplateProgram::OP_PRED;
+		else if ( ident == wxT("npred") )
+			instruction.op = TemplateProgram::OP_NPRED;
+		else if ( ident == wxT("nl") )
+			instruction.op = TemplateProgram::OP_NEWLINE;
+		else if ( ident == wxT("class") )
+			instruction.op = TemplateProgram::OP_CLASS;
+		else if ( ident == wxT("indent") )
+			instruction.op = TemplateProgram::OP_INDENT;
+		else if ( ident == wxT("unindent") )
+			instruction.op = TemplateProgram::OP_UNINDENT;
+		else if ( ident == wxT("utbl") )
+			instruction.op = TemplateProgram::OP_UTBL;
+		else
+			// Unknown macro, left to TemplateParser to report it
+			return false;
+
+		Emit( instruction );
+		return true;
+	}
+}
+
+PTemplateProgram TemplateProgram::Compile( const wxString& _template )
+{
+	PTemplateProgram program = std::make_shared< TemplateProgram >();
+	program->m_main.source = std::string( _template.utf8_str() );
+	if ( !TemplateCompiler( program->m_main ).Compile() )
+	{
+		program.reset();
+	}
+
+	return program;
+}
+
+wxString TemplateProgram::GetRemainder( const Block& block, size_t offset )
+{
+	return wxString::FromUTF8( block.source.data() + offset, block.source.size() - offset );
+}
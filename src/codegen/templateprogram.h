@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TEMPLATEPROGRAM__
+#define __TEMPLATEPROGRAM__
+
+#include "../utils/wxfbdefs.h"
+
+#include <component.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+* A code template compiled once into a list of instructions, so it doesn't
+* have to be lexed again for every object and every generation.
+*
+* The compiler follows the same steps as TemplateParser, so a program
+* produces the same code as the parser. Some macros consume a different part
+* of the template depending on the object (e.g. "#parent $name" when there is
+* no parent), those instructions keep the offset of their source and the
+* interpreter hands the rest of the block over to the parser when the object
+* doesn't take the compiled path. Templates that use anything unusual (unknown
+* macros, unterminated blocks...) aren't compiled at all and are parsed as
+* before.
+*/
+class TemplateProgram
+{
+public:
+	enum OpCode
+	{
+		OP_TEXT,
+		OP_PROPERTY,
+		OP_WXPARENT,
+		OP_PARENT,
+		OP_FORM,
+		OP_CHILD,
+		OP_IFNOTNULL,
+		OP_IFNULL,
+		OP_IFEQUAL,
+		OP_IFNOTEQUAL,
+		OP_IFPARENTTYPEEQUAL,
+		OP_IFPARENTTYPENOTEQUAL,
+		OP_IFPARENTCLASSEQUAL,
+		OP_IFPARENTCLASSNOTEQUAL,
+		OP_IFTYPEEQUAL,
+		OP_IFTYPENOTEQUAL,
+		OP_FOREACH,
+		OP_PRED,
+		OP_NPRED,
+		OP_NEWLINE,
+		OP_APPEND,
+		OP_CLASS,
+		OP_INDENT,
+		OP_UNINDENT,
+		OP_UTBL
+	};
+
+	/// Object whose property is tested by the conditional macros
+	enum Relative
+	{
+		REL_SELF,
+		REL_WXPARENT,
+		REL_PARENT,
+		REL_CHILD
+	};
+
+	struct Block;
+
+	struct Instruction
+	{
+		OpCode       op;
+		Relative     relative = REL_SELF;
+		PropertyAtom atom = PROPERTY_ATOM_NONE;
+		wxString     name;   // property name, for the error messages
+		wxString     child;  // child of a parent property ($name/child)
+		wxString     text;   // literal text or compared value
+		std::vector< wxString > values; // compared value split as TemplateParser::IsEqual does
+		std::shared_ptr< Block > block; // code of the conditional and loop macros
+		size_t       source; // offset of the macro in the source of the block
+	};
+
+	struct Block
+	{
+		std::vector< Instruction > code;
+		std::string                source; // UTF-8, as read by TemplateParser
+	};
+
+	/**
+	* Compiles a template. Returns an empty pointer when the template can't
+	* be compiled and must be parsed.
+	* Only the templates of the object definitions are compiled, by CodeInfo
+	* when they are loaded. The templates the generators build at run time
+	* are used once and parsed directly.
+	*/
+	static PTemplateProgram Compile( const wxString& _template );
+
+	const Block& GetMain() const { return m_main; }
+
+	/**
+	* Source of the block from the given offset on, for handing it over to
+	* the parser.
+	*/
+	static wxString GetRemainder( const Block& block, size_t offset );
+
+private:
+	Block m_main;
+};
+
+#endif //__TEMPLATEPROGRAM__
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Command line code generator, see ProjectGenerator
+
+#include "codegen/fragmentcache.h"
+#include "codegen/projectgenerator.h"
+#include "utils/wxfbipc.h"
+
+#include <iostream>
+
+#include <wx/cmdline.h>
+#include <wx/image.h>
+#include <wx/init.h>
+#include <wx/stdpaths.h>
+
+static const wxCmdLineEntryDesc s_cmdLineDesc[] = {
+	{ wxCMD_LINE_SWITCH, "c", "client",
+	  "Let the generator daemon generate the projects and print the generated files. Without "
+	  "a daemon, the projects are generated by this process.",
+	  wxCMD_LINE_VAL_STRING, 0 },
+	{ wxCMD_LINE_SWITCH, "d", "daemon",
+	  "Run as generator daemon, keeping the plugins and the projects loaded to generate the "
+	  "projects of the clients, until it is stopped.",
+	  wxCMD_LINE_VAL_STRING, 0 },
+	{ wxCMD_LINE_SWITCH, nullptr, "stop-daemon", "Stop the generator daemon.", wxCMD_LINE_VAL_STRING,
+	  0 },
+	{ wxCMD_LINE_SWITCH, "h", "help", "Show this help message.", wxCMD_LINE_VAL_STRING,
+	  wxCMD_LINE_OPTION_HELP },
+	{ wxCMD_LINE_PARAM, nullptr, nullptr, "Project files to generate.", wxCMD_LINE_VAL_STRING,
+	  wxCMD_LINE_PARAM_OPTIONAL | wxCMD_LINE_PARAM_MULTIPLE },
+	{ wxCMD_LINE_NONE, nullptr, nullptr, nullptr, wxCMD_LINE_VAL_NONE, 0 }
+};
+
+int main( int argc, char** argv )
+{
+	wxInitializer initializer( argc, argv );
+	if ( !initializer.IsOk() )
+	{
+		return 5;
+	}
+
+	// Same data directory as the designer
+	wxTheApp->SetAppName( wxT("wxformbuilder") );
+	wxString dataDir = wxStandardPaths::Get().GetDataDir();
+
+	wxCmdLineParser parser( s_cmdLineDesc, argc, argv );
+	ProjectGenerator::AddCommandLineOptions( parser );
+	if ( 0 != parser.Parse() )
+	{
+		return 1;
+	}
+
+	wxFBGeneratorIPC ipc;
+	if ( parser.Found( wxT("stop-daemon") ) )
+	{
+		return ( ipc.Stop() ? 0 : 7 );
+	}
+
+	const bool daemon = parser.Found( wxT("d") );
+	const bool client = parser.Found( wxT("c") );
+
+	std::vector< wxString > projects;
+	ProjectGenerator::Options options;
+	const int status = ProjectGenerator::ParseCommandLine( parser, !daemon, projects, options );
+	if ( status != 0 )
+	{
+		return status;
+	}
+
+	if ( client && !daemon )
+	{
+		int status = 0;
+		std::vector< wxString > generated;
+		wxString messages;
+		if ( ipc.Generate( projects, options, status, generated, messages ) )
+		{
+			std::cerr << messages;
+			for ( const wxString& file : generated )
+			{
+				std::cout << file << std::endl;
+			}
+			return status;
+		}
+
+		wxLogStatus( _("No generator daemon is running, generating the projects here.") );
+	}
+
+	// The embedded files are named after the type of their image
+	wxInitAllImageHandlers();
+
+	ProjectGenerator generator( dataDir );
+	if ( !generator.Init() )
+	{
+		return 5;
+	}
+
+	if ( daemon )
+	{
+		// The projects are generated again, the code of their unchanged objects is reused
+		generator.KeepProjects( true );
+		FragmentCache::Enable( true );
+		return ( ipc.Serve( generator ) ? 0 : 7 );
+	}
+
+	bool success = generator.Generate( projects, options );
+	wxLog::FlushActive();
+	if ( !success )
+	{
+		return 6;
+	}
+
+	if ( options.check )
+	{
+		for ( const wxString& file : generator.GetStaleFiles() )
+		{
+			std::cout << file << std::endl;
+		}
+		return ( generator.GetStaleFiles().empty() ? 0 : 8 );
+	}
+
+	if ( client )
+	{
+		for ( const wxString& file : generator.GetGeneratedFiles() )
+		{
+			std::cout << file << std::endl;
+		}
+	}
+
+	return 0;
+}
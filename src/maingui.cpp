@@ -24,7 +24,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "maingui.h"
 
-#include "model/objectbase.h"
+#include "codegen/projectgenerator.h"
 #include "rad/appdata.h"
 #include "rad/mainframe.h"
 #include "utils/typeconv.h"
@@ -66,17 +66,13 @@
 void LogStack();
 
 static const wxCmdLineEntryDesc s_cmdLineDesc[] = {
-	{ wxCMD_LINE_SWITCH, "g", "generate", "Generate code from passed file.", wxCMD_LINE_VAL_STRING,
+	{ wxCMD_LINE_SWITCH, "g", "generate", "Generate code from the passed files.", wxCMD_LINE_VAL_STRING,
 	  0 },
-	{ wxCMD_LINE_OPTION, "l", "language",
-	  "Override the code_generation property from the passed file and generate the passed "
-	  "languages. Separate multiple languages with commas.",
-	  wxCMD_LINE_VAL_STRING, 0 },
 	{ wxCMD_LINE_SWITCH, "h", "help", "Show this help message.", wxCMD_LINE_VAL_STRING,
 	  wxCMD_LINE_OPTION_HELP },
 	{ wxCMD_LINE_SWITCH, "v", "version", "Print version information.", wxCMD_LINE_VAL_STRING, 0 },
-	{ wxCMD_LINE_PARAM, nullptr, nullptr, "File to open.", wxCMD_LINE_VAL_STRING,
-	  wxCMD_LINE_PARAM_OPTIONAL },
+	{ wxCMD_LINE_PARAM, nullptr, nullptr, "File to open, or files to generate.", wxCMD_LINE_VAL_STRING,
+	  wxCMD_LINE_PARAM_OPTIONAL | wxCMD_LINE_PARAM_MULTIPLE },
 	{ wxCMD_LINE_NONE, nullptr, nullptr, nullptr, wxCMD_LINE_VAL_NONE, 0 }
 };
 
@@ -123,6 +119,7 @@ int MyApp::OnRun()
 
 	// Parse command line
 	wxCmdLineParser parser( s_cmdLineDesc, argc, argv );
+	ProjectGenerator::AddCommandLineOptions( parser );
 	if ( 0 != parser.Parse() )
 	{
 		return 1;
@@ -141,24 +138,14 @@ int MyApp::OnRun()
 	}
 
 	bool justGenerate = false;
-	wxString language;
-	bool hasLanguage = parser.Found( wxT("l"), &language );
+	std::vector< wxString > projectsToGenerate;
+	ProjectGenerator::Options options;
 	if ( parser.Found( wxT("g") ) )
 	{
-		if ( projectToLoad.empty() )
+		const int status = ProjectGenerator::ParseCommandLine( parser, true, projectsToGenerate, options );
+		if ( status != 0 )
 		{
-			wxLogError( _("You must pass a path to a project file. Nothing to generate.") );
-			return 2;
-		}
-
-		if ( hasLanguage )
-		{
-			if ( language.empty() )
-			{
-				wxLogError( _("Empty language option. Nothing generated.") );
-				return 3;
-			}
-			language.Replace( wxT(","), wxT("|"), true );
+			return status;
 		}
 
 		// generate code
@@ -169,6 +156,32 @@ int MyApp::OnRun()
 		delete wxLog::SetActiveTarget( new wxLogGui );
 	}
 
+	if ( justGenerate )
+	{
+		// Generate without the designer, no window is created
+		wxInitAllImageHandlers();
+
+		ProjectGenerator generator( dataDir );
+		if ( !generator.Init() )
+		{
+			wxLog::FlushActive();
+			return 5;
+		}
+
+		bool success = generator.Generate( projectsToGenerate, options );
+		wxLog::FlushActive();
+		if ( !success )
+		{
+			return 6;
+		}
+
+		for ( const wxString& file : generator.GetStaleFiles() )
+		{
+			std::cout << file << std::endl;
+		}
+		return ( generator.GetStaleFiles().empty() ? 0 : 8 );
+	}
+
 	// Create singleton AppData - wait to initialize until sure that this is not the second
 	// instance of a project file.
 	AppDataCreate( dataDir );
@@ -200,7 +213,7 @@ int MyApp::OnRun()
 	}
 
 	// If the project is already loaded in another instance, switch to that instance and quit
-	if ( !projectToLoad.empty() && !justGenerate )
+	if ( !projectToLoad.empty() )
 	{
 		if ( ::wxFileExists( projectToLoad ) )
 		{
@@ -258,19 +271,16 @@ int MyApp::OnRun()
 	config->SetPath( wxT("/") );
 
 	m_frame = new MainFrame( NULL ,wxID_ANY, (int)style, wxPoint( x, y ), wxSize( w, h ) );
-	if ( !justGenerate )
-	{
-		m_frame->Show( TRUE );
-		SetTopWindow( m_frame );
+	m_frame->Show( TRUE );
+	SetTopWindow( m_frame );
 
-		#ifdef __WXFB_DEBUG__
-			wxLogWindow* log = dynamic_cast< wxLogWindow* >( AppData()->GetDebugLogTarget() );
-			if ( log )
-			{
-				m_frame->AddChild( log->GetFrame() );
-			}
-		#endif //__WXFB_DEBUG__
-	}
+	#ifdef __WXFB_DEBUG__
+		wxLogWindow* log = dynamic_cast< wxLogWindow* >( AppData()->GetDebugLogTarget() );
+		if ( log )
+		{
+			m_frame->AddChild( log->GetFrame() );
+		}
+	#endif //__WXFB_DEBUG__
 
 	// This is not necessary for wxFB to work. However, Windows sets the Current Working Directory
 	// to the directory from which a .fbp file was opened, if opened from Windows Explorer.
@@ -282,27 +292,10 @@ int MyApp::OnRun()
 
 	if ( !projectToLoad.empty() )
 	{
-		if ( AppData()->LoadProject( projectToLoad, justGenerate ) )
+		if ( AppData()->LoadProject( projectToLoad ) )
 		{
-			if ( justGenerate )
-			{
-				if ( hasLanguage )
-				{
-					PObjectBase project = AppData()->GetProjectData();
-					PProperty codeGen = project->GetProperty( _("code_generation") );
-					if ( codeGen )
-					{
-						codeGen->SetValue( language );
-					}
-				}
-				AppData()->GenerateCode( false, true );
-				return 0;
-			}
-			else
-			{
-				m_frame->InsertRecentProject( projectToLoad );
-				return wxApp::OnRun();
-			}
+			m_frame->InsertRecentProject( projectToLoad );
+			return wxApp::OnRun();
 		}
 		else
 		{
@@ -310,11 +303,6 @@ int MyApp::OnRun()
 		}
 	}
 
-	if ( justGenerate )
-	{
-		return 6;
-	}
-
 	AppData()->NewProject();
 
 #ifdef __WXMAC__
@@ -33,6 +33,9 @@
 #include "objectbase.h"
 
 #include <ticpp.h>
+
+#include <algorithm>
+
 #include <wx/dir.h>
 #include <wx/filename.h>
 #include <wx/stdpaths.h>
@@ -86,6 +89,8 @@ void ObjectPackage::AppendPackage( PObjectPackage package )
 ///////////////////////////////////////////////////////////////////////////////
 
 ObjectDatabase::ObjectDatabase()
+:
+m_codeGenerationOnly( false )
 {
 	//InitObjectTypes();
 	//  InitWidgetTypes();
@@ -146,60 +151,14 @@ PObjectBase ObjectDatabase::NewObject(PObjectInfo obj_info)
 	PObjectBase object;
 
 	// Llagados aquí el objeto se crea seguro...
-	object = PObjectBase(new ObjectBase(obj_info->GetClassName()));
+	object = std::make_shared< ObjectBase >(obj_info->GetClassName());
 	object->SetObjectTypeName(obj_info->GetObjectTypeName()); // *FIXME*
 
 	object->SetObjectInfo(obj_info);
 
-	PPropertyInfo prop_info;
-	PEventInfo    event_info;
-	PObjectInfo   class_info = obj_info;
-
-	unsigned int base = 0;
-
-	while (class_info)
-	{
-		unsigned int i;
-		for (i = 0; i < class_info->GetPropertyCount(); i++)
-		{
-			prop_info = class_info->GetPropertyInfo(i);
-
-			PProperty property(new Property(prop_info, object));
-
-			// Set the default value, either from the property info, or an override from this class
-			wxString defaultValue = prop_info->GetDefaultValue();
-			if ( base > 0 )
-			{
-				wxString defaultValueTemp = obj_info->GetBaseClassDefaultPropertyValue( base - 1, prop_info->GetName() );
-				if ( !defaultValueTemp.empty() )
-				{
-					defaultValue = defaultValueTemp;
-				}
-			}
-			property->SetValue( defaultValue );
-
-			// Las propiedades están implementadas con una estructura "map",
-			// ello implica que no habrá propiedades duplicadas.
-			// En otro caso habrá que asegurarse de que dicha propiedad
-			// no existe.
-			// Otra cosa importante, es que el orden en que se insertan
-			// las propiedades, de abajo-arriba, esto permite que se pueda redefir
-			// alguna propiedad.
-			object->AddProperty (property);
-		}
-
-		for (i=0; i < class_info->GetEventCount(); i++)
-		{
-		  event_info = class_info->GetEventInfo(i);
-		  PEvent event(new Event(event_info,object));
-		  // notice that for event there isn't a default value on its creation
-		  // because there is not handler at the moment
-		  object->AddEvent(event);
-		}
-
-		class_info = ( base < obj_info->GetBaseClassCount() ?
-			obj_info->GetBaseClass(base++) : PObjectInfo());
-	}
+	// The schema already holds the properties and events inherited from the
+	// base classes, one slot each, and the default values to use
+	object->CreateMembers( obj_info->GetSchema() );
 
 	// si el objeto tiene la propiedad name (reservada para el nombre del
 	// objeto) le añadimos el contador para no repetir nombres.
@@ -217,25 +176,16 @@ PObjectBase ObjectDatabase::NewObject(PObjectInfo obj_info)
 
 int ObjectDatabase::CountChildrenWithSameType(PObjectBase parent,PObjectType type)
 {
-	unsigned int count = 0;
-	unsigned int numChildren = parent->GetChildCount();
-	for (unsigned int i=0; i < numChildren ; i++)
-	{
-		if (type == parent->GetChild(i)->GetObjectInfo()->GetObjectType())
-			count++;
-	}
-
-	return count;
+	return (int)parent->GetChildCountOfType(type);
 }
 
 int ObjectDatabase::CountChildrenWithSameType(PObjectBase parent, const std::set<PObjectType>& types)
 {
 	unsigned int count = 0;
-	unsigned int numChildren = parent->GetChildCount();
-	for (unsigned int i = 0; i < numChildren; ++i)
+	for (const PObjectType& type : types)
 	{
-		if (types.find(parent->GetChild(i)->GetObjectInfo()->GetObjectType()) != types.end())
-			++count;
+		if (type)
+			count += parent->GetChildCountOfType(type);
 	}
 
 	return count;
@@ -278,7 +228,7 @@ PObjectBase ObjectDatabase::CreateObject( std::string classname, PObjectBase par
 
 		//AUI
 		bool aui = false;
-		if( parentType->GetName() == wxT("form") )
+		if( parentType->IsForm() )
 		{
 			aui = parent->GetPropertyAsInteger(wxT("aui_managed")) != 0;
 		}
@@ -291,20 +241,16 @@ PObjectBase ObjectDatabase::CreateObject( std::string classname, PObjectBase par
 		// de forms (como childType de project), pero hay mucho código no válido
 		// para forms que no sean de tipo "form". Dicho de otra manera, hay
 		// código que dependen del nombre del tipo, cosa que hay que evitar.
-		if (parentType->GetName() == wxT("form") && parent->GetClassName() != wxT("Frame") &&
-			(objType->GetName() == wxT("statusbar") ||
-			objType->GetName() == wxT("menubar") ||
-			objType->GetName() == wxT("ribbonbar") ||
-			objType->GetName() == wxT("toolbar") ))
+		if (parentType->IsForm() && objType->IsFrameOnly() && parent->GetClassName() != wxT("Frame"))
 			return PObjectBase(); // tipo no válido
 
 		// No menu dropdown for wxToolBar until wx 2.9 :(
-		if ( parentType->GetName() == wxT("tool") )
+		if ( parentType == m_toolType )
 		{
 			PObjectBase gParent = parent->GetParent();
 			if (
 				( gParent->GetClassName() == wxT("wxToolBar") ) &&
-				( objType->GetName() == wxT("menu") )
+				( objType == m_menuType )
 			)
 				return PObjectBase(); // not a valid type
 		}
@@ -315,9 +261,9 @@ PObjectBase ObjectDatabase::CreateObject( std::string classname, PObjectBase par
 
 			// we check the number of instances
 			int count;
-			if (objType == GetObjectType(wxT("sizer")) || objType == GetObjectType(wxT("gbsizer")))
+			if (objType->IsSizer())
 			{
-				count = CountChildrenWithSameType(parent, { GetObjectType(wxT("sizer")), GetObjectType(wxT("gbsizer")) });
+				count = CountChildrenWithSameType(parent, m_sizerTypes);
 			}
 			else 
 			{
@@ -405,7 +351,7 @@ PObjectBase ObjectDatabase::CopyObject(PObjectBase obj)
 	PObjectBase copyObj = NewObject(objInfo); // creamos la copia
 	assert(copyObj);
 
-	// copiamos las propiedades
+	// copiamos las propiedades, both objects share the same slot layout
 	unsigned int i;
 	unsigned int count = obj->GetPropertyCount();
 	for (i = 0; i < count; i++)
@@ -413,11 +359,14 @@ PObjectBase ObjectDatabase::CopyObject(PObjectBase obj)
 		PProperty objProp = obj->GetProperty(i);
 		assert(objProp);
 
-		PProperty copyProp = copyObj->GetProperty(objProp->GetName());
+		PProperty copyProp = copyObj->GetProperty(i);
 		assert(copyProp);
 
 		wxString propValue = objProp->GetValue();
-		copyProp->SetValue(propValue);
+		if ( propValue != copyProp->GetValue() )
+		{
+			copyProp->SetValue(propValue);
+		}
 	}
 
 	// ...and the event handlers
@@ -425,7 +374,7 @@ PObjectBase ObjectDatabase::CopyObject(PObjectBase obj)
 	for (i = 0; i < count; i++)
 	{
 	  PEvent event = obj->GetEvent(i);
-	  PEvent copyEvent = copyObj->GetEvent(event->GetName());
+	  PEvent copyEvent = copyObj->GetEvent(i);
 	  copyEvent->SetValue(event->GetValue());
 	}
 
@@ -602,6 +551,91 @@ PObjectBase ObjectDatabase::CreateObject( ticpp::Element* xml_obj, PObjectBase p
 	}
 }
 
+PObjectBase ObjectDatabase::LoadProject( const wxString& file, const ProjectConverter& convert, bool* converted )
+{
+	if ( converted )
+	{
+		*converted = false;
+	}
+
+	if ( !wxFileName::FileExists( file ) )
+	{
+		wxLogError( wxT( "This file does not exist: %s" ), file.c_str() );
+		return PObjectBase();
+	}
+
+	try
+	{
+		ticpp::Document doc;
+		XMLUtils::LoadXMLFile( doc, false, file );
+
+		ticpp::Element* root = doc.FirstChildElement();
+
+		int fbpVerMajor = 0;
+		int fbpVerMinor = 0;
+
+		if ( root->Value() != std::string( "object" ) )
+		{
+			try
+			{
+				ticpp::Element* fileVersion = root->FirstChildElement( "FileVersion" );
+				fileVersion->GetAttributeOrDefault( "major", &fbpVerMajor, 0 );
+				fileVersion->GetAttributeOrDefault( "minor", &fbpVerMinor, 0 );
+			}
+			catch( ticpp::Exception& )
+			{
+			}
+		}
+
+		if ( fbpVerMajor > FBP_VERSION_MAJOR || ( fbpVerMajor == FBP_VERSION_MAJOR && fbpVerMinor > FBP_VERSION_MINOR ) )
+		{
+			wxLogError( wxT( "This project file is newer than this version of wxFormBuilder.\n" )
+			            wxT( "It cannot be opened.\n\n" )
+			            wxT( "Please download an updated version from http://www.wxFormBuilder.org" ) );
+			return PObjectBase();
+		}
+
+		if ( fbpVerMajor != FBP_VERSION_MAJOR || fbpVerMinor != FBP_VERSION_MINOR )
+		{
+			if ( !convert )
+			{
+				wxLogError( wxT( "This project file is using an older file format. Open and save it with wxFormBuilder to update it." ) );
+				return PObjectBase();
+			}
+
+			if ( !convert( doc, fbpVerMajor, fbpVerMinor ) )
+			{
+				wxLogError( wxT( "Unable to convert project" ) );
+				return PObjectBase();
+			}
+
+			// Document has changed -- reacquire the root node
+			root = doc.FirstChildElement();
+			if ( converted )
+			{
+				*converted = true;
+			}
+		}
+
+		PObjectBase project = CreateObject( root->FirstChildElement( "object" ) );
+		if ( project && project->GetObjectTypeName() == wxT( "project" ) )
+		{
+			return project;
+		}
+	}
+	catch ( ticpp::Exception& ex )
+	{
+		wxLogError( _WXSTR( ex.m_details ) );
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( ex.what() );
+	}
+
+	wxLogError( wxT( "Unable to load project: %s" ), file.c_str() );
+	return PObjectBase();
+}
+
 //////////////////////////////
 
 bool IncludeInPalette(wxString /*type*/) {
@@ -778,26 +812,19 @@ void ObjectDatabase::SetupPackage(const wxString& file,
 		root->GetAttributeOrDefault( "lib", &lib, "" );
 		if ( !lib.empty() )
 		{
-			// Allows plugin dependency dlls to be next to plugin dll in windows
-			wxString workingDir = ::wxGetCwd();
-			wxFileName::SetCwd( libPath );
-			try
+			wxString fullLibPath = libPath + wxFILE_SEP_PATH + _WXSTR(lib) + wxver;
+			if ( m_importedLibraries.insert( fullLibPath ).second )
 			{
-				wxString fullLibPath = libPath + wxFILE_SEP_PATH + _WXSTR(lib) + wxver;
-				if ( m_importedLibraries.insert( fullLibPath ).second )
+				if ( m_codeGenerationOnly )
 				{
-					ImportComponentLibrary( fullLibPath, manager );
+					// Imported only if needed, see ImportComponentLibraries()
+					m_pendingLibraries.push_back( std::make_pair( libPath, fullLibPath ) );
+				}
+				else
+				{
+					ImportComponentLibrary( libPath, fullLibPath, manager );
 				}
 			}
-			catch ( ... )
-			{
-				// Put Cwd back
-				wxFileName::SetCwd( workingDir );
-				throw;
-			}
-
-			// Put Cwd back
-			wxFileName::SetCwd( workingDir );
 		}
 
 		ticpp::Element* elem_obj = root->FirstChildElement( OBJINFO_TAG, false );
@@ -865,6 +892,12 @@ void ObjectDatabase::SetupPackage(const wxString& file,
 
 			elem_obj = elem_obj->NextSiblingElement( OBJINFO_TAG, false );
 		}
+
+		// The base classes may belong to any package set up so far, refresh all of them
+		for ( ObjectInfoMap::iterator it = m_objs.begin(); it != m_objs.end(); ++it )
+		{
+			it->second->BuildHierarchy();
+		}
 	}
 	catch ( ticpp::Exception& ex )
 	{
@@ -972,6 +1005,11 @@ void ObjectDatabase::LoadCodeGen( const wxString& file )
 				{
 					wxLogError( _("Found second template definition for property \"%s\" for language \"%s\""), _WXSTR(prop_name).c_str(), lang.c_str() );
 				}
+
+				if ( std::find( m_commonFiles.begin(), m_commonFiles.end(), file ) == m_commonFiles.end() )
+				{
+					m_commonFiles.push_back( file );
+				}
 			}
 			else
 			{
@@ -980,6 +1018,7 @@ void ObjectDatabase::LoadCodeGen( const wxString& file )
 				if ( obj_info )
 				{
 					obj_info->AddCodeInfo( lang, code_info );
+					obj_info->AddDefinitionFile( file );
 				}
 			}
 
@@ -1021,7 +1060,11 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 		wxString pkgIconPath = iconPath + wxFILE_SEP_PATH +  _WXSTR(pkgIconName);
 
 		wxBitmap pkg_icon;
-		if ( !pkgIconName.empty() && wxFileName::FileExists( pkgIconPath ) )
+		if ( m_codeGenerationOnly )
+		{
+			// The icons are only shown by the designer
+		}
+		else if ( !pkgIconName.empty() && wxFileName::FileExists( pkgIconPath ) )
 		{
 			wxImage image( pkgIconPath, wxBITMAP_TYPE_ANY );
 			pkg_icon = wxBitmap( image.Scale( 16, 16 ) );
@@ -1069,26 +1112,31 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 			elem_obj->GetAttributeOrDefault( "startgroup", &startGroup, false );
 
 			PObjectInfo obj_info( new ObjectInfo( _WXSTR(class_name), GetObjectType( _WXSTR(type) ), package, startGroup ) );
+			obj_info->AddDefinitionFile( file );
 
-			if ( !icon.empty() && wxFileName::FileExists( iconFullPath ) )
+			// The icons are only shown by the designer
+			if ( !m_codeGenerationOnly )
 			{
-				wxImage img( iconFullPath, wxBITMAP_TYPE_ANY );
-				obj_info->SetIconFile( wxBitmap( img.Scale( ICON_SIZE, ICON_SIZE ) ) );
-			}
-			else
-			{
-				obj_info->SetIconFile( AppBitmaps::GetBitmap( wxT("unknown"), ICON_SIZE ) );
-			}
+				if ( !icon.empty() && wxFileName::FileExists( iconFullPath ) )
+				{
+					wxImage img( iconFullPath, wxBITMAP_TYPE_ANY );
+					obj_info->SetIconFile( wxBitmap( img.Scale( ICON_SIZE, ICON_SIZE ) ) );
+				}
+				else
+				{
+					obj_info->SetIconFile( AppBitmaps::GetBitmap( wxT("unknown"), ICON_SIZE ) );
+				}
 
-			if ( !smallIcon.empty() && wxFileName::FileExists( smallIconFullPath ) )
-			{
-				wxImage img( smallIconFullPath, wxBITMAP_TYPE_ANY );
-				obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
-			}
-			else
-			{
-				wxImage img = obj_info->GetIconFile().ConvertToImage();
-				obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
+				if ( !smallIcon.empty() && wxFileName::FileExists( smallIconFullPath ) )
+				{
+					wxImage img( smallIconFullPath, wxBITMAP_TYPE_ANY );
+					obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
+				}
+				else
+				{
+					wxImage img = obj_info->GetIconFile().ConvertToImage();
+					obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
+				}
 			}
 
 			// Parse the Properties
@@ -1100,7 +1148,7 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 			m_objs.insert(ObjectInfoMap::value_type( _WXSTR(class_name), obj_info ) );
 
 			// Add the object to the palette
-			if ( ShowInPalette( obj_info->GetObjectTypeName() ) )
+			if ( obj_info->GetObjectType() && obj_info->GetObjectType()->IsInPalette() )
 			{
 				package->Add( obj_info );
 			}
@@ -1343,63 +1391,43 @@ void ObjectDatabase::ParseEvents( ticpp::Element* elem_obj, PObjectInfo obj_info
 	}
 }
 
-bool ObjectDatabase::ShowInPalette(wxString type)
+void ObjectDatabase::ImportComponentLibraries( PwxFBManager manager )
 {
-	return (type == wxT("form")					||
-            type == wxT("wizard")               ||
-            type == wxT("wizardpagesimple")     ||
-			type == wxT("menubar_form")			||
-			type == wxT("toolbar_form")			||
-			type == wxT("sizer")				||
-			type == wxT("gbsizer")				||
-			type == wxT("menu")					||
-			type == wxT("menuitem")				||
-			type == wxT("submenu")				||
-			type == wxT("tool")					||
-			type == wxT("ribbonbar")			||
-			type == wxT("ribbonpage")			||
-			type == wxT("ribbonpanel")      		||
-			type == wxT("ribbonbuttonbar")  		||
-			type == wxT("ribbonbutton")  			||
-			type == wxT("ribbondropdownbutton" )	||
-			type == wxT("ribbonhybridbutton" )  	||
-			type == wxT("ribbontogglebutton" )  	||
-			type == wxT("ribbontoolbar")	   		||
-			type == wxT("ribbontool")		   	||
-			type == wxT("ribbondropdowntool" )  	||
-			type == wxT("ribbonhybridtool" ) 		||
-			type == wxT("ribbontoggletool" )  		||
-			type == wxT("ribbongallery")  			||
-			type == wxT("ribbongalleryitem")		||
-			type == wxT("dataviewctrl")			||
-			type == wxT("dataviewtreectrl")		||
-			type == wxT("dataviewlistctrl")		||
-			type == wxT("dataviewlistcolumn")		||
-			type == wxT("dataviewcolumn")		||
-			type == wxT("notebook")				||
-			type == wxT("flatnotebook")			||
-			type == wxT("listbook")				||
-			type == wxT("simplebook")			||
-			type == wxT("choicebook")			||
-			type == wxT("auinotebook")			||
-			type == wxT("widget")				||
-			type == wxT("expanded_widget")		||
-			type == wxT("propgrid")		||
-			type == wxT("propgridman")		||
-			type == wxT("propgridpage")		||
-			type == wxT("propgriditem")		||
-			type == wxT("statusbar")			||
-			type == wxT("component")			||
-			type == wxT("container")			||
-			type == wxT("menubar")				||
-			type == wxT("treelistctrl")			||
-			type == wxT("treelistctrlcolumn")	||
-			type == wxT("toolbar")				||
-			type == wxT("nonvisual")			||
-			type == wxT("splitter")
-			);
+	std::vector< std::pair< wxString, wxString > > libraries;
+	libraries.swap( m_pendingLibraries );
+
+	for ( const auto& library : libraries )
+	{
+		try
+		{
+			ImportComponentLibrary( library.first, library.second, manager );
+		}
+		catch ( wxFBException& ex )
+		{
+			wxLogError( ex.what() );
+		}
+	}
 }
 
+void ObjectDatabase::ImportComponentLibrary( const wxString& libPath, const wxString& libfile, PwxFBManager manager )
+{
+	// Allows plugin dependency dlls to be next to plugin dll in windows
+	wxString workingDir = ::wxGetCwd();
+	wxFileName::SetCwd( libPath );
+	try
+	{
+		ImportComponentLibrary( libfile, manager );
+	}
+	catch ( ... )
+	{
+		// Put Cwd back
+		wxFileName::SetCwd( workingDir );
+		throw;
+	}
+
+	// Put Cwd back
+	wxFileName::SetCwd( workingDir );
+}
 
 void ObjectDatabase::ImportComponentLibrary( wxString libfile, PwxFBManager manager )
 {
@@ -1548,6 +1576,7 @@ bool ObjectDatabase::LoadObjectTypes()
 	ticpp::Document doc;
 	wxString xmlPath = m_xmlPath + wxT("objtypes.xml");
 	XMLUtils::LoadXMLFile( doc, true, xmlPath );
+	m_commonFiles.push_back( xmlPath );
 
 	// First load the object types, then the children
 	try
@@ -1559,12 +1588,34 @@ bool ObjectDatabase::LoadObjectTypes()
 			bool hidden;
 			elem->GetAttributeOrDefault( "hidden", &hidden, false );
 
-			bool item;
-			elem->GetAttributeOrDefault( "item", &item, false );
+			// Capabilities the code relies on, instead of the names of the types
+			static const std::pair< const char*, int > s_flags[] =
+			{
+				{ "item",       ObjectType::FLAG_ITEM },
+				{ "form",       ObjectType::FLAG_FORM },
+				{ "sizer",      ObjectType::FLAG_SIZER },
+				{ "container",  ObjectType::FLAG_CONTAINER },
+				{ "aui_pane",   ObjectType::FLAG_AUI_PANE },
+				{ "wxparent",   ObjectType::FLAG_WXPARENT },
+				{ "frame_only", ObjectType::FLAG_FRAME_ONLY },
+				{ "toolbar",    ObjectType::FLAG_TOOLBAR },
+				{ "palette",    ObjectType::FLAG_PALETTE },
+			};
+
+			int flags = 0;
+			for ( const auto& flag : s_flags )
+			{
+				bool set;
+				elem->GetAttributeOrDefault( flag.first, &set, false );
+				if ( set )
+				{
+					flags |= flag.second;
+				}
+			}
 
 			wxString name = _WXSTR( elem->GetAttribute("name") );
 
-			PObjectType objType( new ObjectType( name, (int)m_types.size(), hidden, item ) );
+			PObjectType objType( new ObjectType( name, (int)m_types.size(), hidden, flags ) );
 			m_types.insert( ObjectTypeMap::value_type( name, objType ) );
 
 			elem = elem->NextSiblingElement( "objtype", false );
@@ -1601,6 +1652,18 @@ bool ObjectDatabase::LoadObjectTypes()
 			}
 			elem = elem->NextSiblingElement( "objtype", false );
 		}
+
+		// The types the placement checks refer to, resolved once
+		m_toolType = GetObjectType( wxT("tool") );
+		m_menuType = GetObjectType( wxT("menu") );
+		m_sizerTypes.clear();
+		for ( ObjectTypeMap::iterator it = m_types.begin(); it != m_types.end(); ++it )
+		{
+			if ( it->second->IsSizer() )
+			{
+				m_sizerTypes.insert( it->second );
+			}
+		}
 	}
 	catch( ticpp::Exception& ex )
 	{
@@ -29,6 +29,7 @@
 #include "../utils/wxfbdefs.h"
 #include "types.h"
 
+#include <functional>
 #include <set>
 #include <wx/dynlib.h>
 
@@ -40,9 +41,16 @@ typedef std::shared_ptr<ObjectDatabase> PObjectDatabase;
 
 namespace ticpp
 {
+	class Document;
 	class Element;
 }
 
+/**
+ * Converts a project file of an older format version, in place.
+ * Returns false if it could not be converted, see ObjectDatabase::LoadProject().
+ */
+typedef std::function< bool ( ticpp::Document& doc, int fileMajor, int fileMinor ) > ProjectConverter;
+
 /**
  * Paquete de clases de objetos.
  * Determinará la agrupación en la paleta de componentes.
@@ -138,6 +146,9 @@ class ObjectDatabase
   LibraryVector m_libs;
   ComponentLibraryMap m_componentLibs;
   ObjectTypeMap m_types; // register object types
+  PObjectType m_toolType; // types the placement checks refer to
+  PObjectType m_menuType;
+  std::set< PObjectType > m_sizerTypes;
 
   // para comprobar que no se nos han quedado macros sin añadir en las
   // liberias de componentes, vamos a crear un conjunto con las macros
@@ -149,8 +160,15 @@ class ObjectDatabase
   // used so libraries are only imported once, even if multiple libraries use them
   std::set< wxString > m_importedLibraries;
 
+  bool m_codeGenerationOnly;
+  // directory and path of the libraries not imported yet
+  std::vector< std::pair< wxString, wxString > > m_pendingLibraries;
+
   PTLangTemplateMap m_propertyTypeTemplates;
 
+  // files that define the object types and the templates of the property types
+  std::vector< wxString > m_commonFiles;
+
   /**
    * Initialize the property type map.
    */
@@ -176,6 +194,7 @@ class ObjectDatabase
    * @throw wxFBException If the library could not be imported.
    */
   void ImportComponentLibrary( wxString libfile, PwxFBManager manager );
+  void ImportComponentLibrary( const wxString& libPath, const wxString& libfile, PwxFBManager manager );
 
   /**
    * Incluye la información heredada de los objetos de un paquete.
@@ -183,19 +202,11 @@ class ObjectDatabase
    */
   void SetupPackage( const wxString& file, const wxString& path, PwxFBManager manager );
 
-  /**
-   * Determina si el tipo de objeto hay que incluirlo en la paleta de
-   * componentes.
-   */
-  bool ShowInPalette(wxString type);
-
   // rutinas de conversión
   PropertyType ParsePropertyType (wxString str);
   wxString       ParseObjectType   (wxString str);
 
 
-  PObjectType GetObjectType(wxString name);
-
   int CountChildrenWithSameType(PObjectBase parent,PObjectType type);
   int CountChildrenWithSameType(PObjectBase parent, const std::set<PObjectType>& types);
 
@@ -212,6 +223,11 @@ class ObjectDatabase
    */
   PObjectInfo GetObjectInfo(wxString class_name);
 
+  /**
+   * The object type with that name, loaded from objtypes.xml.
+   */
+  PObjectType GetObjectType(wxString name);
+
   /**
    * Configura la ruta donde se encuentran los ficheros con la descripción.
    */
@@ -223,6 +239,13 @@ class ObjectDatabase
   void SetIconPath( const wxString& path)  { m_iconPath = path; }
   void SetPluginPath( const wxString& path ) { m_pluginPath = path; }
 
+  /**
+   * Loads only what the code generators need, to work without a display:
+   * no icons are loaded and the component libraries of the plugins are only
+   * imported by ImportComponentLibraries(). Must be set before LoadPlugins().
+   */
+  void SetCodeGenerationOnly( bool only ) { m_codeGenerationOnly = only; }
+
   /**
    * Obtiene la ruta donde se encuentran los ficheros con la descripción de
    * objetos.
@@ -241,6 +264,19 @@ class ObjectDatabase
    */
   void LoadPlugins( PwxFBManager manager );
 
+  /**
+   * Files that define the object types and the templates of the property
+   * types, the code of every project depends on them. The files of the
+   * classes are given by ObjectInfo::GetDefinitionFiles().
+   */
+  const std::vector< wxString >& GetCommonFiles() const { return m_commonFiles; }
+
+  /**
+   * Imports the component libraries left out by SetCodeGenerationOnly().
+   * Only the XRC generator needs them.
+   */
+  void ImportComponentLibraries( PwxFBManager manager );
+
   /**
    * Fabrica de objetos.
    * A partir del nombre de la clase se crea una nueva instancia de un objeto.
@@ -253,6 +289,15 @@ class ObjectDatabase
    */
   PObjectBase CreateObject( ticpp::Element* obj, PObjectBase parent = PObjectBase());
 
+  /**
+   * Loads a project file, for the designer and the code generators alike.
+   * A file of a newer format version is rejected. A file of an older one is
+   * rejected too, unless a converter is given.
+   * @param converted Set to true if the file was converted.
+   * @return The project, NULL if it could not be loaded, the error is logged.
+   */
+  PObjectBase LoadProject( const wxString& file, const ProjectConverter& convert = ProjectConverter(), bool* converted = NULL );
+
   /**
    * Crea un objeto como copia de otro.
    */
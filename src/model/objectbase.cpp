@@ -25,18 +25,41 @@
 
 #include "objectbase.h"
 
-#include "../rad/appdata.h"
+#include "../codegen/templateprogram.h"
 #include "../utils/debug.h"
 #include "../utils/stringutils.h"
 #include "../utils/typeconv.h"
 
 #include <ticpp.h>
+
+#include <algorithm>
+
 #include <wx/tokenzr.h>
 
+PropertyAtoms::AtomMap& PropertyAtoms::GetMap()
+{
+	static AtomMap atoms;
+	return atoms;
+}
+
+PropertyAtom PropertyAtoms::Intern( const wxString& name )
+{
+	AtomMap& atoms = GetMap();
+	return atoms.insert( AtomMap::value_type( name, static_cast< PropertyAtom >( atoms.size() ) ) ).first->second;
+}
+
+PropertyAtom PropertyAtoms::Find( const wxString& name )
+{
+	AtomMap& atoms = GetMap();
+	AtomMap::iterator it = atoms.find( name );
+	return ( it != atoms.end() ? it->second : PROPERTY_ATOM_NONE );
+}
+
 PropertyInfo::PropertyInfo(wxString name, PropertyType type, wxString def_value, wxString description, wxString customEditor,
 						   POptionList opt_list, const std::list< PropertyChild >& children )
 {
 	m_name = name;
+	m_atom = PropertyAtoms::Intern( name );
 	m_type = type;
 	m_def_value = def_value;
 	m_opt_list = opt_list;
@@ -58,102 +81,174 @@ EventInfo::EventInfo(const wxString &name, const wxString &eventClass,
 
 bool Property::IsDefaultValue()
 {
-	return (m_info->GetDefaultValue() == m_value);
+	return (m_info->GetDefaultValue() == Value());
 }
 
 bool Property::IsNull()
 {
+	const wxString& value = Value();
+
 	switch ( m_info->GetType() )
 	{
 		case PT_BITMAP:
 		{
 			wxString path;
-			size_t semicolonIndex = m_value.find_first_of( wxT(";") );
-			if ( semicolonIndex != m_value.npos )
+			size_t semicolonIndex = value.find_first_of( wxT(";") );
+			if ( semicolonIndex != value.npos )
 			{
-				path = m_value.substr( 0, semicolonIndex );
+				path = value.substr( 0, semicolonIndex );
 			}
 			else
 			{
-				path = m_value;
+				path = value;
 			}
 
 			return path.empty();
 		}
 		case PT_WXSIZE:
 		{
-			return ( wxDefaultSize == TypeConv::StringToSize( m_value ) );
+			return ( wxDefaultSize == TypeConv::StringToSize( value ) );
 		}
 		default:
 		{
-			return m_value.empty();
+			return value.empty();
 		}
 	}
 }
 
 void Property::SetDefaultValue()
 {
-	m_value = m_info->GetDefaultValue();
+	AssignValue( m_info->GetDefaultValue() );
+}
+
+namespace
+{
+	PropertyAtom GetNameAtom()
+	{
+		static const PropertyAtom nameAtom = PropertyAtoms::Intern( wxT("name") );
+		return nameAtom;
+	}
+}
+
+void Property::AssignValue( const wxString& value )
+{
+	PObjectBase obj = m_object.lock();
+	if ( obj && m_info->GetAtom() == GetNameAtom() && value != Value() )
+	{
+		obj->OnNameChanged( Value(), value );
+	}
+
+	m_value = value;
+	m_sharedValue = nullptr;
+	InvalidateCache();
+
+	if ( obj )
+		obj->Touch();
+}
+
+Property::ValueCache& Property::GetCache()
+{
+	if ( !m_cache )
+	{
+		m_cache.reset( new ValueCache );
+	}
+	return *m_cache;
 }
 
 void Property::SetValue(const wxFontContainer &font)
 {
-	m_value = TypeConv::FontToString( font );
+	AssignValue( TypeConv::FontToString( font ) );
 }
 void Property::SetValue(const wxColour &colour)
 {
-	m_value = TypeConv::ColourToString( colour );
+	AssignValue( TypeConv::ColourToString( colour ) );
 }
 void Property::SetValue(const wxString &str, bool format)
 {
-	m_value = (format ? TypeConv::TextToString(str) : str );
+	AssignValue( format ? TypeConv::TextToString(str) : str );
 }
 
 void Property::SetValue(const wxPoint &point)
 {
-	m_value = TypeConv::PointToString(point);
+	AssignValue( TypeConv::PointToString(point) );
 }
 
 void Property::SetValue(const wxSize &size)
 {
-	m_value = TypeConv::SizeToString(size);
+	AssignValue( TypeConv::SizeToString(size) );
 }
 
 void Property::SetValue(const int integer)
 {
-	m_value = StringUtils::IntToStr(integer);
+	AssignValue( StringUtils::IntToStr(integer) );
 }
 
 void Property::SetValue(const double val )
 {
-	m_value = TypeConv::FloatToString( val );
+	AssignValue( TypeConv::FloatToString( val ) );
 }
 
 wxFontContainer Property::GetValueAsFont()
 {
-	return TypeConv::StringToFont( m_value );
+	ValueCache& cache = GetCache();
+	if ( !( cache.valid & ValueCache::FONT ) )
+	{
+		cache.font = TypeConv::StringToFont( Value() );
+		cache.valid |= ValueCache::FONT;
+	}
+	return cache.font;
 }
 
 wxColour Property::GetValueAsColour()
 {
-	return TypeConv::StringToColour(m_value);
+	// System colours follow the current theme, so they are never cached
+	if ( Value().find_first_of( wxT("wx") ) == 0 )
+	{
+		return TypeConv::StringToColour( Value() );
+	}
+
+	ValueCache& cache = GetCache();
+	if ( !( cache.valid & ValueCache::COLOUR ) )
+	{
+		cache.colour = TypeConv::StringToColour( Value() );
+		cache.valid |= ValueCache::COLOUR;
+	}
+	return cache.colour;
 }
 wxPoint Property::GetValueAsPoint()
 {
-	return TypeConv::StringToPoint(m_value);
+	ValueCache& cache = GetCache();
+	if ( !( cache.valid & ValueCache::POINT ) )
+	{
+		cache.point = TypeConv::StringToPoint( Value() );
+		cache.valid |= ValueCache::POINT;
+	}
+	return cache.point;
 }
 wxSize Property::GetValueAsSize()
 {
-	return TypeConv::StringToSize(m_value);
+	ValueCache& cache = GetCache();
+	if ( !( cache.valid & ValueCache::SIZE ) )
+	{
+		cache.size = TypeConv::StringToSize( Value() );
+		cache.valid |= ValueCache::SIZE;
+	}
+	return cache.size;
 }
 
 wxBitmap Property::GetValueAsBitmap()
 {
-	return TypeConv::StringToBitmap( m_value );
+	return TypeConv::StringToBitmap( Value() );
 }
 
 int Property::GetValueAsInteger()
 {
+	ValueCache& cache = GetCache();
+	if ( cache.valid & ValueCache::INTEGER )
+	{
+		return cache.integer;
+	}
+
 	int result = 0;
 
 	switch (GetType())
@@ -161,36 +256,51 @@ int Property::GetValueAsInteger()
 	case PT_EDIT_OPTION:
 	case PT_OPTION:
 	case PT_MACRO:
-		result = TypeConv::GetMacroValue(m_value);
+		result = TypeConv::GetMacroValue(Value());
 		break;
 	case PT_BITLIST:
-		result = TypeConv::BitlistToInt(m_value);
+		result = TypeConv::BitlistToInt(Value());
 		break;
 	default:
-		result = TypeConv::StringToInt(m_value);
+		result = TypeConv::StringToInt(Value());
 		break;
 	}
+
+	cache.integer = result;
+	cache.valid |= ValueCache::INTEGER;
 	return result;
 }
 
 wxString Property::GetValueAsString()
 {
-	return m_value;
+	return Value();
 }
 
 wxString Property::GetValueAsText()
 {
-	return TypeConv::StringToText(m_value);
+	return TypeConv::StringToText(Value());
 }
 
 wxArrayString Property::GetValueAsArrayString()
 {
-	return TypeConv::StringToArrayString(m_value);
+	ValueCache& cache = GetCache();
+	if ( !( cache.valid & ValueCache::ARRAY_STRING ) )
+	{
+		cache.arrayString = TypeConv::StringToArrayString( Value() );
+		cache.valid |= ValueCache::ARRAY_STRING;
+	}
+	return cache.arrayString;
 }
 
 double Property::GetValueAsFloat()
 {
-	return TypeConv::StringToFloat(m_value);
+	ValueCache& cache = GetCache();
+	if ( !( cache.valid & ValueCache::FLOAT ) )
+	{
+		cache.floating = TypeConv::StringToFloat( Value() );
+		cache.valid |= ValueCache::FLOAT;
+	}
+	return cache.floating;
 }
 
 void Property::SplitParentProperty( std::map< wxString, wxString >* children )
@@ -204,7 +314,7 @@ void Property::SplitParentProperty( std::map< wxString, wxString >* children )
 	std::list< PropertyChild >* myChildren = m_info->GetChildren();
 	std::list< PropertyChild >::iterator it = myChildren->begin();
 
-	wxStringTokenizer tkz( m_value, wxT(";"), wxTOKEN_RET_EMPTY_ALL );
+	wxStringTokenizer tkz( Value(), wxT(";"), wxTOKEN_RET_EMPTY_ALL );
 	while ( tkz.HasMoreTokens() )
 	{
 		if ( myChildren->end() == it )
@@ -237,12 +347,107 @@ wxString Property::GetChildFromParent( const wxString& childName )
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+void Event::SetValue( const wxString& value )
+{
+	m_value = value;
+
+	PObjectBase obj = m_object.lock();
+	if ( obj )
+		obj->Touch();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+ObjectSchema::ObjectSchema( ObjectInfo& info )
+{
+	// The class goes first and then its base classes, a property or event that
+	// is already in the layout hides the ones of the same name further down
+	std::vector< PObjectInfo > classes;
+	info.GetBaseClasses( classes );
+
+	std::map< wxString, PropertySlot > properties;
+	std::map< wxString, PEventInfo > events;
+
+	for ( unsigned int base = 0; base <= classes.size(); base++ )
+	{
+		ObjectInfo& classInfo = ( 0 == base ? info : *classes[ base - 1 ] );
+
+		for ( unsigned int i = 0; i < classInfo.GetPropertyCount(); i++ )
+		{
+			PPropertyInfo propInfo = classInfo.GetPropertyInfo( i );
+			const wxString name = propInfo->GetName();
+			if ( properties.find( name ) != properties.end() )
+			{
+				continue;
+			}
+
+			// Default value, either from the property info, or an override from this class
+			PropertySlot& slot = properties[ name ];
+			slot.info = propInfo;
+			slot.defaultValue = propInfo->GetDefaultValue();
+			if ( base > 0 )
+			{
+				wxString defaultValueTemp = info.GetBaseClassDefaultPropertyValue( base - 1, name );
+				if ( !defaultValueTemp.empty() )
+				{
+					slot.defaultValue = defaultValueTemp;
+				}
+			}
+		}
+
+		for ( unsigned int i = 0; i < classInfo.GetEventCount(); i++ )
+		{
+			PEventInfo eventInfo = classInfo.GetEventInfo( i );
+			events.insert( std::map< wxString, PEventInfo >::value_type( eventInfo->GetName(), eventInfo ) );
+		}
+	}
+
+	m_properties.reserve( properties.size() );
+	for ( std::map< wxString, PropertySlot >::iterator it = properties.begin(); it != properties.end(); ++it )
+	{
+		const PropertyAtom atom = it->second.info->GetAtom();
+		if ( (size_t)atom >= m_atomSlots.size() )
+		{
+			m_atomSlots.resize( atom + 1, -1 );
+		}
+		m_atomSlots[ atom ] = (int)m_properties.size();
+
+		m_propertySlots[ it->first ] = (unsigned int)m_properties.size();
+		m_properties.push_back( it->second );
+	}
+
+	m_events.reserve( events.size() );
+	for ( std::map< wxString, PEventInfo >::iterator it = events.begin(); it != events.end(); ++it )
+	{
+		m_eventSlots[ it->first ] = (unsigned int)m_events.size();
+		m_events.push_back( it->second );
+	}
+}
+
+int ObjectSchema::FindProperty( const wxString& name )
+{
+	SlotMap::iterator it = m_propertySlots.find( name );
+	return ( it != m_propertySlots.end() ? (int)it->second : -1 );
+}
+
+int ObjectSchema::FindEvent( const wxString& name )
+{
+	SlotMap::iterator it = m_eventSlots.find( name );
+	return ( it != m_eventSlots.end() ? (int)it->second : -1 );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 const int ObjectBase::INDENT = 2;
+std::atomic< unsigned long > ObjectBase::s_lastIdentity( 0 );
+std::atomic< unsigned long > ObjectBase::s_lastRevision( 0 );
 
 ObjectBase::ObjectBase (wxString class_name)
 :
-m_expanded( true )
+m_expanded( true ),
+m_identity( ++s_lastIdentity ),
+m_revision( ++s_lastRevision )
 {
 	m_class = class_name;
 
@@ -251,6 +456,12 @@ m_expanded( true )
 
 ObjectBase::~ObjectBase()
 {
+	// The children that outlive this object lose their ancestors
+	for ( PObjectBase& child : m_children )
+	{
+		child->InvalidateAncestorCache();
+	}
+
 	// remove the reference in the parent
 	PObjectBase parent = m_parent.lock();
 
@@ -286,11 +497,151 @@ PObjectBase ObjectBase::GetNonSizerParent ()
 	return current;
 }
 
+void ObjectBase::SetSchema( PObjectSchema schema )
+{
+	m_schema = schema;
+	m_properties.assign( schema->GetPropertyCount(), PProperty() );
+	m_events.assign( schema->GetEventCount(), PEvent() );
+}
+
+namespace
+{
+	// Every property and event of an object, kept alive by the pointers into it
+	struct ObjectMembers
+	{
+		PObjectSchema           schema; // owns the default values the properties share
+		std::vector< Property > properties;
+		std::vector< Event >    events;
+	};
+}
+
+void ObjectBase::CreateMembers( PObjectSchema schema )
+{
+	SetSchema( schema );
+
+	std::shared_ptr< ObjectMembers > members = std::make_shared< ObjectMembers >();
+	members->schema = schema;
+	members->properties.reserve( schema->GetPropertyCount() );
+	members->events.reserve( schema->GetEventCount() );
+
+	PObjectBase thisObj = GetThis();
+	for ( unsigned int slot = 0; slot < schema->GetPropertyCount(); slot++ )
+	{
+		// the default value is shared with the schema until it is modified
+		const ObjectSchema::PropertySlot& propSlot = schema->GetPropertySlot( slot );
+		members->properties.emplace_back( propSlot.info, thisObj, &propSlot.defaultValue );
+	}
+
+	for ( unsigned int slot = 0; slot < schema->GetEventCount(); slot++ )
+	{
+		// notice that for event there isn't a default value on its creation
+		// because there is not handler at the moment
+		members->events.emplace_back( schema->GetEventInfo( slot ), thisObj );
+	}
+
+	// The vectors are not resized anymore, the pointers stay valid
+	for ( unsigned int slot = 0; slot < m_properties.size(); slot++ )
+	{
+		m_properties[ slot ] = PProperty( members, &members->properties[ slot ] );
+	}
+	for ( unsigned int slot = 0; slot < m_events.size(); slot++ )
+	{
+		m_events[ slot ] = PEvent( members, &members->events[ slot ] );
+	}
+}
+
+PObjectBase ObjectBase::CreateSnapshot( bool withChildren )
+{
+	PObjectBase copy = std::make_shared< ObjectBase >( m_class );
+	copy->m_type = m_type;
+	copy->m_info = m_info;
+	copy->m_expanded = m_expanded;
+
+	if ( m_schema )
+	{
+		copy->CreateMembers( m_schema );
+
+		for ( unsigned int slot = 0; slot < m_properties.size(); slot++ )
+		{
+			if ( m_properties[ slot ] )
+				copy->m_properties[ slot ]->CopyValue( *m_properties[ slot ] );
+		}
+
+		for ( unsigned int slot = 0; slot < m_events.size(); slot++ )
+		{
+			if ( m_events[ slot ] )
+				copy->m_events[ slot ]->SetValue( m_events[ slot ]->GetValue() );
+		}
+	}
+
+	if ( withChildren )
+	{
+		copy->m_children.reserve( m_children.size() );
+		for ( ObjectBaseVector::iterator it = m_children.begin(); it != m_children.end(); ++it )
+		{
+			// No placement checks, the children were already accepted here
+			PObjectBase child = (*it)->CreateSnapshot();
+			copy->m_children.push_back( child );
+			copy->ChildAttached( child );
+			child->SetParent( copy );
+		}
+	}
+
+	copy->m_identity = m_identity;
+	copy->m_revision = m_revision;
+
+	return copy;
+}
+
+void ObjectBase::MatchIdentities( PObjectBase previous )
+{
+	if ( previous->m_class != m_class )
+	{
+		return;
+	}
+
+	m_identity = previous->m_identity;
+
+	bool same = ( previous->m_schema == m_schema );
+	for ( unsigned int slot = 0; same && slot < m_properties.size(); slot++ )
+	{
+		if ( m_properties[ slot ] )
+			same = ( m_properties[ slot ]->GetValue() == previous->m_properties[ slot ]->GetValue() );
+	}
+	for ( unsigned int slot = 0; same && slot < m_events.size(); slot++ )
+	{
+		if ( m_events[ slot ] )
+			same = ( m_events[ slot ]->GetValue() == previous->m_events[ slot ]->GetValue() );
+	}
+	if ( same )
+	{
+		m_revision = previous->m_revision;
+	}
+
+	// Objects without name, e.g. sizer items, are matched by their position
+	// among the siblings of the same class
+	std::vector< bool > taken( previous->m_children.size(), false );
+	for ( ObjectBaseVector::iterator it = m_children.begin(); it != m_children.end(); ++it )
+	{
+		const wxString name = (*it)->GetPropertyAsString( wxT("name") );
+		for ( size_t i = 0; i < previous->m_children.size(); i++ )
+		{
+			PObjectBase candidate = previous->m_children[ i ];
+			if ( !taken[ i ] && candidate->m_class == (*it)->m_class && candidate->GetPropertyAsString( wxT("name") ) == name )
+			{
+				taken[ i ] = true;
+				(*it)->MatchIdentities( candidate );
+				break;
+			}
+		}
+	}
+}
+
 PProperty ObjectBase::GetProperty (wxString name)
 {
-	PropertyMap::iterator it = m_properties.find( name );
-	if ( it != m_properties.end() )
-		return it->second;
+	int slot = ( m_schema ? m_schema->FindProperty( name ) : -1 );
+	if ( slot >= 0 )
+		return m_properties[ slot ];
 
   //LogDebug(wxT("[ObjectBase::GetProperty] Property %s not found!"),name.c_str());
 	// este aserto falla siempre que se crea un sizeritem
@@ -298,29 +649,30 @@ PProperty ObjectBase::GetProperty (wxString name)
 	return PProperty();
 }
 
+PProperty ObjectBase::GetProperty (PropertyAtom atom)
+{
+	int slot = ( m_schema ? m_schema->FindProperty( atom ) : -1 );
+	if ( slot >= 0 )
+		return m_properties[ slot ];
+
+	return PProperty();
+}
+
 PProperty ObjectBase::GetProperty (unsigned int idx)
 {
 	assert (idx < m_properties.size());
 
-	PropertyMap::iterator it = m_properties.begin();
-	unsigned int i = 0;
-	while (i < idx && it != m_properties.end())
-	{
-		i++;
-		it++;
-	}
-
-	if (it != m_properties.end())
-		return it->second;
+	if (idx < m_properties.size())
+		return m_properties[idx];
 
 	return PProperty();
 }
 
 PEvent ObjectBase::GetEvent (wxString name)
 {
-	EventMap::iterator it = m_events.find( name );
-	if ( it != m_events.end() )
-		return it->second;
+	int slot = ( m_schema ? m_schema->FindEvent( name ) : -1 );
+	if ( slot >= 0 )
+		return m_events[ slot ];
 
     LogDebug("[ObjectBase::GetEvent] Event " + name + " not found!");
 	return PEvent();
@@ -330,43 +682,48 @@ PEvent ObjectBase::GetEvent (unsigned int idx)
 {
 	assert (idx < m_events.size());
 
-	EventMap::iterator it = m_events.begin();
-	unsigned int i = 0;
-	while (i < idx && it != m_events.end())
-	{
-		i++;
-		it++;
-	}
-
-	if (it != m_events.end())
-		return it->second;
+	if (idx < m_events.size())
+		return m_events[idx];
 
   return PEvent();
 }
 
 void ObjectBase::AddProperty (PProperty prop)
 {
-	m_properties.insert( PropertyMap::value_type( prop->GetName(), prop ) );
+	int slot = ( m_schema ? m_schema->FindProperty( prop->GetName() ) : -1 );
+	if ( slot < 0 )
+	{
+		LogDebug( "[ObjectBase::AddProperty] Property " + prop->GetName() + " is not part of " + m_class );
+		return;
+	}
+
+	// the first definition wins, as derived classes add theirs before the base classes
+	if ( !m_properties[ slot ] )
+		m_properties[ slot ] = prop;
 }
 
 void ObjectBase::AddEvent(PEvent event)
 {
-	m_events.insert( EventMap::value_type( event->GetName(), event ) );
+	int slot = ( m_schema ? m_schema->FindEvent( event->GetName() ) : -1 );
+	if ( slot < 0 )
+	{
+		LogDebug( "[ObjectBase::AddEvent] Event " + event->GetName() + " is not part of " + m_class );
+		return;
+	}
+
+	if ( !m_events[ slot ] )
+		m_events[ slot ] = event;
 }
 
-PObjectBase ObjectBase::FindNearAncestor(wxString type)
+PObjectBase ObjectBase::FindNearAncestor(PObjectType type)
 {
-	PObjectBase result;
-	PObjectBase parent = GetParent();
-	if (parent)
+	for (PObjectBase parent = GetParent(); parent && type; parent = parent->GetParent())
 	{
-		if (parent->GetObjectTypeName() == type)
-			result = parent;
-		else
-			result = parent->FindNearAncestor(type);
+		if (parent->GetObjectInfo()->GetObjectType() == type)
+			return parent;
 	}
 
-	return result;
+	return PObjectBase();
 }
 
 PObjectBase ObjectBase::FindNearAncestorByBaseClass(wxString type)
@@ -384,14 +741,74 @@ PObjectBase ObjectBase::FindNearAncestorByBaseClass(wxString type)
 	return result;
 }
 
+bool ObjectBase::IsContainer()
+{
+	return ( m_info && m_info->GetObjectType()->IsContainer() );
+}
+
 PObjectBase ObjectBase::FindParentForm()
 {
-	PObjectBase retObj = this->FindNearAncestor( wxT( "form" ) );
-	if( retObj == NULL ) retObj = this->FindNearAncestor( wxT( "menubar_form" ) );
-	if( retObj == NULL ) retObj = this->FindNearAncestor( wxT( "toolbar_form" ) );
-    if( retObj == NULL ) retObj = this->FindNearAncestor( wxT("wizard") );
+	return GetShared( GetAncestorCache().form );
+}
+
+PObjectBase ObjectBase::FindWxParentAncestor()
+{
+	return GetShared( GetAncestorCache().wxParent );
+}
+
+PObjectBase ObjectBase::FindStaticBoxSizerAncestor()
+{
+	return GetShared( GetAncestorCache().staticBoxSizer );
+}
 
-	return retObj;
+void ObjectBase::SetParent( PObjectBase parent )
+{
+	m_parent = parent;
+	InvalidateAncestorCache();
+}
+
+void ObjectBase::InvalidateAncestorCache()
+{
+	// A valid cache is computed from the valid cache of the parent, so the
+	// descendants of an invalid cache are invalid already
+	if ( !m_ancestorCache.valid )
+	{
+		return;
+	}
+
+	m_ancestorCache.valid = false;
+	for ( PObjectBase& child : m_children )
+	{
+		child->InvalidateAncestorCache();
+	}
+}
+
+const ObjectBase::AncestorCache& ObjectBase::GetAncestorCache()
+{
+	if ( m_ancestorCache.valid )
+	{
+		return m_ancestorCache;
+	}
+
+	AncestorCache cache;
+	PObjectBase parent = GetParent();
+	if ( parent )
+	{
+		cache = parent->GetAncestorCache();
+		cache.depth++;
+
+		PObjectType type = parent->GetObjectInfo()->GetObjectType();
+		if ( type->IsForm() )
+			cache.form = parent.get();
+		if ( type->IsWxParent() )
+			cache.wxParent = parent.get();
+		if ( parent->GetObjectInfo()->IsSubclassOf( wxT("wxStaticBoxSizer") ) )
+			cache.staticBoxSizer = parent.get();
+	}
+	cache.valid = true;
+
+	m_ancestorCache = cache;
+	return m_ancestorCache;
 }
 
 bool ObjectBase::AddChild (PObjectBase obj)
@@ -401,6 +818,7 @@ bool ObjectBase::AddChild (PObjectBase obj)
 		//if (ChildTypeOk(obj->GetObjectTypeName()))
 	{
 		m_children.push_back(obj);
+		ChildAttached( obj );
 		result = true;
 	}
 
@@ -414,6 +832,7 @@ bool ObjectBase::AddChild (unsigned int idx, PObjectBase obj)
 		//if (ChildTypeOk(obj->GetObjectTypeName()) && idx <= m_children.size())
 	{
 		m_children.insert(m_children.begin() + idx,obj);
+		ChildAttached( obj );
 		result = true;
 	}
 
@@ -428,7 +847,7 @@ bool ObjectBase::ChildTypeOk (PObjectType type)
 	int nmax = 0;
 
 	// check allowed child count
-	if( GetObjectInfo()->GetObjectType()->GetName() == wxT("form") )
+	if( GetObjectInfo()->GetObjectType()->IsForm() )
 	{
 		nmax = GetObjectInfo()->GetObjectType()->FindChildType(
 		    type, this->GetPropertyAsInteger(wxT("aui_managed")) != 0);
@@ -443,14 +862,7 @@ bool ObjectBase::ChildTypeOk (PObjectType type)
 		return true;
 
 	// llegados aquí hay que comprobar el número de hijos del tipo pasado
-	int count = 0;
-	for (unsigned int i=0; i < GetChildCount() && count <= nmax; i++)
-	{
-		if (GetChild(i)->GetObjectInfo()->GetObjectType() == type)
-			count++;
-	}
-
-	if (count > nmax)
+	if ((int)GetChildCountOfType(type) > nmax)
 		return false;
 
 	return true;
@@ -474,7 +886,10 @@ void ObjectBase::RemoveChild (PObjectBase obj)
 		it++;
 
 	if (it != m_children.end())
+	{
 		m_children.erase(it);
+		ChildDetached( obj );
+	}
 }
 
 void ObjectBase::RemoveChild (unsigned int idx)
@@ -482,7 +897,144 @@ void ObjectBase::RemoveChild (unsigned int idx)
 	assert (idx < m_children.size());
 
 	std::vector< PObjectBase >::iterator it =  m_children.begin() + idx;
+	PObjectBase obj = *it;
 	m_children.erase(it);
+	ChildDetached( obj );
+}
+
+void ObjectBase::RemoveAllChildren()
+{
+	ObjectBaseVector children;
+	children.swap( m_children );
+	for ( ObjectBaseVector::iterator it = children.begin(); it != children.end(); ++it )
+	{
+		ChildDetached( *it );
+	}
+}
+
+void ObjectBase::ChildAttached( PObjectBase child )
+{
+	const size_t typeId = child->GetObjectInfo()->GetObjectType()->GetId();
+	if ( typeId >= m_childTypeCounts.size() )
+	{
+		m_childTypeCounts.resize( typeId + 1, 0 );
+	}
+	++m_childTypeCounts[ typeId ];
+
+	UpdateNameIndexes( child, true );
+}
+
+void ObjectBase::ChildDetached( PObjectBase child )
+{
+	const size_t typeId = child->GetObjectInfo()->GetObjectType()->GetId();
+	assert( typeId < m_childTypeCounts.size() && m_childTypeCounts[ typeId ] > 0 );
+	--m_childTypeCounts[ typeId ];
+
+	UpdateNameIndexes( child, false );
+	child->InvalidateAncestorCache();
+}
+
+unsigned int ObjectBase::GetChildCountOfType( PObjectType type )
+{
+	const size_t typeId = type->GetId();
+	return ( typeId < m_childTypeCounts.size() ? m_childTypeCounts[ typeId ] : 0 );
+}
+
+void ObjectBase::NameIndex::Build( const std::vector< wxString >& names )
+{
+	m_counts.clear();
+	for ( std::vector< wxString >::const_iterator name = names.begin(); name != names.end(); ++name )
+	{
+		Add( *name );
+	}
+	m_valid = true;
+}
+
+void ObjectBase::NameIndex::Remove( const wxString& name )
+{
+	auto it = m_counts.find( name );
+	if ( it != m_counts.end() && 0 == --it->second )
+	{
+		m_counts.erase( it );
+	}
+}
+
+unsigned int ObjectBase::NameIndex::GetCount( const wxString& name ) const
+{
+	auto it = m_counts.find( name );
+	return ( it != m_counts.end() ? it->second : 0 );
+}
+
+void ObjectBase::CollectNames( std::vector< wxString >& names )
+{
+	PProperty nameProp = GetProperty( GetNameAtom() );
+	if ( nameProp )
+		names.push_back( nameProp->GetValue() );
+
+	for ( ObjectBaseVector::iterator it = m_children.begin(); it != m_children.end(); ++it )
+	{
+		(*it)->CollectNames( names );
+	}
+}
+
+void ObjectBase::GetNameIndexes( std::vector< NameIndex* >& indexes )
+{
+	ObjectBase* obj = this;
+	PObjectBase parent;
+	while ( obj )
+	{
+		if ( obj->m_nameIndex.IsValid() )
+			indexes.push_back( &obj->m_nameIndex );
+
+		parent = obj->GetParent();
+		obj = parent.get();
+	}
+}
+
+void ObjectBase::UpdateNameIndexes( PObjectBase subtree, bool add )
+{
+	std::vector< NameIndex* > indexes;
+	GetNameIndexes( indexes );
+	if ( indexes.empty() )
+		return;
+
+	std::vector< wxString > names;
+	subtree->CollectNames( names );
+
+	for ( NameIndex* index : indexes )
+	{
+		for ( const wxString& name : names )
+		{
+			if ( add )
+				index->Add( name );
+			else
+				index->Remove( name );
+		}
+	}
+}
+
+unsigned int ObjectBase::GetNameCount( const wxString& name )
+{
+	if ( !m_nameIndex.IsValid() )
+	{
+		std::vector< wxString > names;
+		CollectNames( names );
+		m_nameIndex.Build( names );
+	}
+
+	return m_nameIndex.GetCount( name );
+}
+
+void ObjectBase::OnNameChanged( const wxString& oldName, const wxString& newName )
+{
+	std::vector< NameIndex* > indexes;
+	GetNameIndexes( indexes );
+
+	for ( NameIndex* index : indexes )
+	{
+		index->Remove( oldName );
+		index->Add( newName );
+	}
 }
 
 PObjectBase ObjectBase::GetChild (unsigned int idx)
@@ -496,11 +1048,15 @@ PObjectBase ObjectBase::GetChild (unsigned int idx, const wxString& type)
 {
 	//assert (idx < m_children.size());
 
+	// Only the possible child types can be found, the name is compared once
+	PObjectType childType = GetObjectInfo()->GetObjectType()->GetChildType( type );
+	if( !childType ) return PObjectBase();
+
 	unsigned int cnt = 0;
 
 	for( std::vector< PObjectBase >::iterator it =  m_children.begin(); it != m_children.end(); ++it )
 	{
-		if( (*it)->GetObjectInfo()->GetObjectTypeName() == type && ++cnt == idx ) return *it;
+		if( (*it)->GetObjectInfo()->GetObjectType() == childType && ++cnt == idx ) return *it;
 	}
 
 	return PObjectBase();
@@ -508,17 +1064,7 @@ PObjectBase ObjectBase::GetChild (unsigned int idx, const wxString& type)
 
 int ObjectBase::Deep()
 {
-	int deep = 0;
-	PObjectBase obj(GetParent());
-	while (obj)
-	{
-		obj = obj->GetParent();
-		deep++;
-
-		if (deep > 1000)
-			assert(false);
-	}
-	return deep;
+	return GetAncestorCache().depth;
 }
 
 //void ObjectBase::PrintOut(ostream &s, int indent)
@@ -599,8 +1145,8 @@ void ObjectBase::Serialize( ticpp::Document* serializedDocument )
 	ticpp::Element root( "wxFormBuilder_Project" );
 
 	ticpp::Element fileVersion( "FileVersion" );
-	fileVersion.SetAttribute( "major", AppData()->m_fbpVerMajor );
-	fileVersion.SetAttribute( "minor", AppData()->m_fbpVerMinor );
+	fileVersion.SetAttribute( "major", FBP_VERSION_MAJOR );
+	fileVersion.SetAttribute( "minor", FBP_VERSION_MINOR );
 
 	root.LinkEndChild( &fileVersion );
 
@@ -632,132 +1178,246 @@ bool ObjectBase::ChangeChildPosition( PObjectBase obj, unsigned int pos)
 	if (pos == obj_pos)
 		return true;
 
-	// Procesamos el cambio de posición
-	RemoveChild(obj);
-	AddChild(pos,obj);
+	// Procesamos el cambio de posición, el subárbol no cambia de padre
+	m_children.erase( m_children.begin() + obj_pos );
+	m_children.insert( m_children.begin() + pos, obj );
 	return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-bool ObjectBase::IsNull (const wxString& pname)
+namespace
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->IsNull();
-	else
-		return true;
+	// Shared by the IObject lookups by name and by atom
+	bool PropertyIsNull( PProperty property )
+	{
+		if (property)
+			return property->IsNull();
+		else
+			return true;
+	}
+
+	int PropertyAsInteger( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsInteger();
+		else
+			return 0;
+	}
+
+	wxFontContainer PropertyAsFont( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsFont();
+		else
+			return wxFontContainer();
+	}
+
+	wxColour PropertyAsColour( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsColour();
+		else
+			return wxColour();
+	}
+
+	wxString PropertyAsString( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsString();
+		else
+			return wxString();
+	}
+
+	wxPoint PropertyAsPoint( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsPoint();
+		else
+			return wxPoint();
+	}
+
+	wxSize PropertyAsSize( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsSize();
+		else
+			return wxDefaultSize;
+	}
+
+	wxBitmap PropertyAsBitmap( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsBitmap();
+		else
+			return wxBitmap();
+	}
+
+	double PropertyAsFloat( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsFloat();
+		else
+			return 0;
+	}
+
+	wxArrayInt PropertyAsArrayInt( PProperty property )
+	{
+		wxArrayInt array;
+		if (property)
+		{
+			IntList il(property->GetValue(), property->GetType() == PT_UINTLIST, (property->GetType() == PT_INTPAIRLIST || property->GetType() == PT_UINTPAIRLIST));
+			for (unsigned int i=0; i < il.GetSize() ; i++)
+				array.Add(il.GetValue(i));
+		}
+
+		return array;
+	}
+
+	wxArrayString PropertyAsArrayString( PProperty property )
+	{
+		if (property)
+			return property->GetValueAsArrayString();
+		else
+			return wxArrayString();
+	}
+
+	std::vector<std::pair<int, int>> PropertyAsVectorIntPair( PProperty property )
+	{
+		std::vector<std::pair<int, int>> result;
+
+		if (property)
+		{
+			IntList il(property->GetValue(), property->GetType() == PT_UINTLIST, (property->GetType() == PT_INTPAIRLIST || property->GetType() == PT_UINTPAIRLIST));
+			result.reserve(il.GetSize());
+			for (unsigned int i = 0; i < il.GetSize(); ++i)
+			{
+				result.emplace_back(il.GetPair(i));
+			}
+		}
+
+		return result;
+	}
 }
 
-int ObjectBase::GetPropertyAsInteger (const wxString& pname)
+bool ObjectBase::IsNull(const wxString& pname)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsInteger();
-	else
-		return 0;
+	return PropertyIsNull( GetProperty( pname ) );
+}
+
+bool ObjectBase::IsNullByAtom(PropertyAtom patom)
+{
+	return PropertyIsNull( GetProperty( patom ) );
+}
+
+int ObjectBase::GetPropertyAsInteger(const wxString& pname)
+{
+	return PropertyAsInteger( GetProperty( pname ) );
+}
+
+int ObjectBase::GetPropertyAsIntegerByAtom(PropertyAtom patom)
+{
+	return PropertyAsInteger( GetProperty( patom ) );
 }
 
 wxFontContainer ObjectBase::GetPropertyAsFont(const wxString& pname)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsFont();
-	else
-		return wxFontContainer();
+	return PropertyAsFont( GetProperty( pname ) );
 }
 
-wxColour ObjectBase::GetPropertyAsColour  (const wxString& pname)
+wxFontContainer ObjectBase::GetPropertyAsFontByAtom(PropertyAtom patom)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsColour();
-	else
-		return wxColour();
+	return PropertyAsFont( GetProperty( patom ) );
 }
 
-wxString ObjectBase::GetPropertyAsString  (const wxString& pname)
+wxColour ObjectBase::GetPropertyAsColour(const wxString& pname)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsString();
-	else
-		return wxString();
+	return PropertyAsColour( GetProperty( pname ) );
 }
 
-wxPoint  ObjectBase::GetPropertyAsPoint   (const wxString& pname)
+wxColour ObjectBase::GetPropertyAsColourByAtom(PropertyAtom patom)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsPoint();
-	else
-		return wxPoint();
+	return PropertyAsColour( GetProperty( patom ) );
 }
 
-wxSize   ObjectBase::GetPropertyAsSize    (const wxString& pname)
+wxString ObjectBase::GetPropertyAsString(const wxString& pname)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsSize();
-	else
-		return wxDefaultSize;
+	return PropertyAsString( GetProperty( pname ) );
 }
 
-wxBitmap ObjectBase::GetPropertyAsBitmap  (const wxString& pname)
+wxString ObjectBase::GetPropertyAsStringByAtom(PropertyAtom patom)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsBitmap();
-	else
-		return wxBitmap();
+	return PropertyAsString( GetProperty( patom ) );
 }
-double ObjectBase::GetPropertyAsFloat( const wxString& pname )
+
+wxPoint ObjectBase::GetPropertyAsPoint(const wxString& pname)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsFloat();
-	else
-		return 0;
+	return PropertyAsPoint( GetProperty( pname ) );
+}
+
+wxPoint ObjectBase::GetPropertyAsPointByAtom(PropertyAtom patom)
+{
+	return PropertyAsPoint( GetProperty( patom ) );
 }
+
+wxSize ObjectBase::GetPropertyAsSize(const wxString& pname)
+{
+	return PropertyAsSize( GetProperty( pname ) );
+}
+
+wxSize ObjectBase::GetPropertyAsSizeByAtom(PropertyAtom patom)
+{
+	return PropertyAsSize( GetProperty( patom ) );
+}
+
+wxBitmap ObjectBase::GetPropertyAsBitmap(const wxString& pname)
+{
+	return PropertyAsBitmap( GetProperty( pname ) );
+}
+
+wxBitmap ObjectBase::GetPropertyAsBitmapByAtom(PropertyAtom patom)
+{
+	return PropertyAsBitmap( GetProperty( patom ) );
+}
+
+double ObjectBase::GetPropertyAsFloat(const wxString& pname)
+{
+	return PropertyAsFloat( GetProperty( pname ) );
+}
+
+double ObjectBase::GetPropertyAsFloatByAtom(PropertyAtom patom)
+{
+	return PropertyAsFloat( GetProperty( patom ) );
+}
+
 wxArrayInt ObjectBase::GetPropertyAsArrayInt(const wxString& pname)
 {
-	wxArrayInt array;
-	PProperty property = GetProperty( pname );
-	if (property)
-	{
-		IntList il(property->GetValue(), property->GetType() == PT_UINTLIST, (property->GetType() == PT_INTPAIRLIST || property->GetType() == PT_UINTPAIRLIST));
-		for (unsigned int i=0; i < il.GetSize() ; i++)
-			array.Add(il.GetValue(i));
-	}
+	return PropertyAsArrayInt( GetProperty( pname ) );
+}
 
-	return array;
+wxArrayInt ObjectBase::GetPropertyAsArrayIntByAtom(PropertyAtom patom)
+{
+	return PropertyAsArrayInt( GetProperty( patom ) );
 }
 
 wxArrayString ObjectBase::GetPropertyAsArrayString(const wxString& pname)
 {
-	PProperty property = GetProperty( pname );
-	if (property)
-		return property->GetValueAsArrayString();
-	else
-		return wxArrayString();
+	return PropertyAsArrayString( GetProperty( pname ) );
+}
+
+wxArrayString ObjectBase::GetPropertyAsArrayStringByAtom(PropertyAtom patom)
+{
+	return PropertyAsArrayString( GetProperty( patom ) );
 }
 
 std::vector<std::pair<int, int>> ObjectBase::GetPropertyAsVectorIntPair(const wxString& pname)
 {
-	std::vector<std::pair<int, int>> result;
-	
-	auto property = GetProperty(pname);
-	if (property)
-	{
-		IntList il(property->GetValue(), property->GetType() == PT_UINTLIST, (property->GetType() == PT_INTPAIRLIST || property->GetType() == PT_UINTPAIRLIST));
-		result.reserve(il.GetSize());
-		for (unsigned int i = 0; i < il.GetSize(); ++i)
-		{
-			result.emplace_back(il.GetPair(i));
-		}
-	}
+	return PropertyAsVectorIntPair( GetProperty( pname ) );
+}
 
-	return result;
+std::vector<std::pair<int, int>> ObjectBase::GetPropertyAsVectorIntPairByAtom(PropertyAtom patom)
+{
+	return PropertyAsVectorIntPair( GetProperty( patom ) );
 }
 
 wxString ObjectBase::GetChildFromParentProperty( const wxString& parentName, const wxString& childName )
@@ -780,6 +1440,7 @@ ObjectInfo::ObjectInfo(wxString class_name, PObjectType type, WPObjectPackage pa
 	m_package = package;
 	m_category = PPropertyCategory( new PropertyCategory( m_class ) );
 	m_startGroup = startGroup;
+	m_hierarchyBuilt = false;
 }
 
 PObjectPackage ObjectInfo::GetPackage()
@@ -802,18 +1463,10 @@ PPropertyInfo ObjectInfo::GetPropertyInfo(unsigned int idx)
 {
 	PPropertyInfo result;
 
-	assert (idx < m_properties.size());
-
-	std::map< wxString, PPropertyInfo >::iterator it = m_properties.begin();
-	unsigned int i = 0;
-	while (i < idx && it != m_properties.end())
-	{
-		i++;
-		it++;
-	}
+	assert (idx < m_propertyOrder.size());
 
-	if (it != m_properties.end())
-		result = it->second;
+	if (idx < m_propertyOrder.size())
+		result = m_propertyOrder[idx];
 
 	return result;
 }
@@ -833,30 +1486,41 @@ PEventInfo ObjectInfo::GetEventInfo(unsigned int idx)
 {
 	PEventInfo result;
 
-	assert (idx < m_events.size());
+	assert (idx < m_eventOrder.size());
 
-	EventInfoMap::iterator it = m_events.begin();
-	unsigned int i = 0;
-	while (i < idx && it != m_events.end())
-	{
-		i++;
-		it++;
-	}
-
-	if (it != m_events.end())
-		result = it->second;
+	if (idx < m_eventOrder.size())
+		result = m_eventOrder[idx];
 
 	return result;
 }
 
+namespace
+{
+	template< typename T >
+	bool NameLess( const T& info, const wxString& name )
+	{
+		return info->GetName() < name;
+	}
+}
+
 void ObjectInfo::AddPropertyInfo( PPropertyInfo prop )
 {
-	m_properties.insert( PropertyInfoMap::value_type(prop->GetName(), prop) );
+	if ( m_properties.insert( PropertyInfoMap::value_type(prop->GetName(), prop) ).second )
+	{
+		m_propertyOrder.insert( std::lower_bound( m_propertyOrder.begin(), m_propertyOrder.end(), prop->GetName(),
+			NameLess< PPropertyInfo > ), prop );
+		m_schema.reset();
+	}
 }
 
 void ObjectInfo::AddEventInfo(PEventInfo evtInfo)
 {
-  m_events.insert( EventInfoMap::value_type(evtInfo->GetName(), evtInfo) );
+  if ( m_events.insert( EventInfoMap::value_type(evtInfo->GetName(), evtInfo) ).second )
+  {
+    m_eventOrder.insert( std::lower_bound( m_eventOrder.begin(), m_eventOrder.end(), evtInfo->GetName(),
+      NameLess< PEventInfo > ), evtInfo );
+    m_schema.reset();
+  }
 }
 
 void ObjectInfo::AddBaseClassDefaultPropertyValue( size_t baseIndex, const wxString& propertyName, const wxString& defaultValue )
@@ -872,6 +1536,7 @@ void ObjectInfo::AddBaseClassDefaultPropertyValue( size_t baseIndex, const wxStr
 		propertyDefaultValues[ propertyName ] = defaultValue;
 		m_baseClassDefaultPropertyValues[ baseIndex ] = propertyDefaultValues;
 	}
+	m_schema.reset();
 }
 
 wxString ObjectInfo::GetBaseClassDefaultPropertyValue( size_t baseIndex, const wxString& propertyName )
@@ -888,15 +1553,44 @@ wxString ObjectInfo::GetBaseClassDefaultPropertyValue( size_t baseIndex, const w
 	return wxString();
 }
 
+namespace
+{
+	// Walks the direct bases, the cached hierarchy of a base may be outdated while loading
+	void CollectBaseClasses( ObjectInfo& info, std::vector< PObjectInfo >& classes )
+	{
+		std::vector< PObjectInfo > bases;
+		info.GetBaseClasses( bases, false );
+		for ( const PObjectInfo& base : bases )
+		{
+			classes.push_back( base );
+			CollectBaseClasses( *base, classes );
+		}
+	}
+}
+
+void ObjectInfo::BuildHierarchy()
+{
+	m_inherited.clear();
+	CollectBaseClasses( *this, m_inherited );
+
+	m_ancestors.clear();
+	m_ancestors.insert( m_class );
+	for ( const PObjectInfo& base : m_inherited )
+	{
+		m_ancestors.insert( base->GetClassName() );
+	}
+
+	m_hierarchyBuilt = true;
+}
+
 PObjectInfo ObjectInfo::GetBaseClass(unsigned int idx, bool inherited)
 {
 	if( inherited )
 	{
-		std::vector<PObjectInfo> classes;
-		GetBaseClasses( classes );
+		if ( !m_hierarchyBuilt ) BuildHierarchy();
 
-		assert (idx < classes.size());
-		return classes[idx];
+		assert (idx < m_inherited.size());
+		return m_inherited[idx];
 	}
 	else
 	{
@@ -909,10 +1603,9 @@ unsigned int ObjectInfo::GetBaseClassCount(bool inherited)
 {
 	if( inherited )
 	{
-		std::vector<PObjectInfo> classes;
-		GetBaseClasses( classes );
+		if ( !m_hierarchyBuilt ) BuildHierarchy();
 
-		return (unsigned int)classes.size();
+		return (unsigned int)m_inherited.size();
 	}
 	else
 		return (unsigned int)m_base.size();
@@ -920,32 +1613,21 @@ unsigned int ObjectInfo::GetBaseClassCount(bool inherited)
 
 void ObjectInfo::GetBaseClasses(std::vector<PObjectInfo> &classes, bool inherited)
 {
-	for ( std::vector<PObjectInfo>::iterator it = m_base.begin(); it != m_base.end(); ++it )
+	if( inherited )
 	{
-		PObjectInfo base_info = *it;;
-		classes.push_back( base_info );
+		if ( !m_hierarchyBuilt ) BuildHierarchy();
 
-		if( inherited ) base_info->GetBaseClasses( classes );
+		classes.insert( classes.end(), m_inherited.begin(), m_inherited.end() );
 	}
+	else
+		classes.insert( classes.end(), m_base.begin(), m_base.end() );
 }
 
 bool ObjectInfo::IsSubclassOf(wxString classname)
 {
-	bool found = false;
+	if ( !m_hierarchyBuilt ) BuildHierarchy();
 
-	if (GetClassName() == classname)
-	{
-		found = true;
-	}
-	else
-	{
-		for (unsigned int i=0; !found && i < GetBaseClassCount() ; i++)
-		{
-			PObjectInfo base = GetBaseClass(i);
-			found = base->IsSubclassOf(classname);
-		}
-	}
-	return found;
+	return m_ancestors.find( classname ) != m_ancestors.end();
 }
 
 //
@@ -980,6 +1662,23 @@ void ObjectInfo::AddCodeInfo(wxString lang, PCodeInfo codeinfo)
 	}
 }
 
+void ObjectInfo::AddDefinitionFile( const wxString& file )
+{
+	if ( std::find( m_definitionFiles.begin(), m_definitionFiles.end(), file ) == m_definitionFiles.end() )
+	{
+		m_definitionFiles.push_back( file );
+	}
+}
+
+PObjectSchema ObjectInfo::GetSchema()
+{
+	if ( !m_schema )
+	{
+		m_schema = PObjectSchema( new ObjectSchema( *this ) );
+	}
+	return m_schema;
+}
+
 PCodeInfo ObjectInfo::GetCodeInfo(wxString lang)
 {
 	PCodeInfo result;
@@ -1008,9 +1707,18 @@ wxString CodeInfo::GetTemplate(wxString name)
 	return result;
 }
 
+PTemplateProgram CodeInfo::GetProgram( const wxString& name )
+{
+	ProgramMap::iterator it = m_programs.find( name );
+	return ( it != m_programs.end() ? it->second : PTemplateProgram() );
+}
+
 void CodeInfo::AddTemplate(wxString name, wxString _template)
 {
-	m_templates.insert(TemplateMap::value_type(name,_template));
+	if ( m_templates.insert(TemplateMap::value_type(name,_template)).second )
+	{
+		m_programs[ name ] = TemplateProgram::Compile( _template );
+	}
 }
 
 void CodeInfo::Merge( PCodeInfo merger )
@@ -1019,9 +1727,14 @@ void CodeInfo::Merge( PCodeInfo merger )
 	for ( mergerTemplate = merger->m_templates.begin(); mergerTemplate != merger->m_templates.end(); ++mergerTemplate )
 	{
 		std::pair< TemplateMap::iterator, bool > mine = m_templates.insert( TemplateMap::value_type( mergerTemplate->first, mergerTemplate->second ) );
-		if ( !mine.second )
+		if ( mine.second )
+		{
+			m_programs[ mergerTemplate->first ] = merger->GetProgram( mergerTemplate->first );
+		}
+		else
 		{
 			mine.first->second += mergerTemplate->second;
+			m_programs[ mergerTemplate->first ] = TemplateProgram::Compile( mine.first->second );
 		}
 	}
 }
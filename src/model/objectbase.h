@@ -37,7 +37,15 @@
 #include "types.h"
 
 #include <component.h>
+#include <atomic>
 #include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <wx/hashmap.h>
+
+// Version of the project file format written by this version of wxFormBuilder
+const int FBP_VERSION_MAJOR = 1;
+const int FBP_VERSION_MINOR = 15;
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -80,12 +88,32 @@ public:
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+Table of the interned property names (see PropertyAtom in component.h).
+It is filled while the object definitions are loaded, afterwards it is only read.
+*/
+class PropertyAtoms
+{
+public:
+	static PropertyAtom Intern( const wxString& name );
+
+	/**
+	Returns PROPERTY_ATOM_NONE if no property with that name was ever declared.
+	*/
+	static PropertyAtom Find( const wxString& name );
+
+private:
+	typedef std::unordered_map< wxString, PropertyAtom, wxStringHash, wxStringEqual > AtomMap;
+	static AtomMap& GetMap();
+};
+
 class PropertyInfo
 {
 	friend class Property;
 
 private:
 	wxString       m_name;
+	PropertyAtom   m_atom;
 	PropertyType m_type;
 	wxString       m_def_value;
 	POptionList  m_opt_list;
@@ -103,6 +131,7 @@ public:
 	wxString       GetDefaultValue()        { return m_def_value;  }
 	PropertyType GetType()                { return m_type;       }
 	wxString       GetName()                { return m_name;       }
+	PropertyAtom   GetAtom()                { return m_atom;       }
 	POptionList  GetOptionList ()         { return m_opt_list;   }
 	std::list< PropertyChild >* GetChildren(){ return &m_children; }
 	wxString		 GetDescription	()		  { return m_description;}
@@ -138,9 +167,50 @@ private:
 	WPObjectBase  m_object; // pointer to the owner object
 
 	wxString m_value;
+	const wxString* m_sharedValue; // class default from the schema, used until the value is first set
+
+	/**
+	Typed values already parsed from m_value by the GetValueAs* methods.
+	Allocated on the first typed read, so string-only properties don't pay for it.
+	*/
+	struct ValueCache
+	{
+		enum
+		{
+			INTEGER      = 1 << 0,
+			FLOAT        = 1 << 1,
+			POINT        = 1 << 2,
+			SIZE         = 1 << 3,
+			COLOUR       = 1 << 4,
+			FONT         = 1 << 5,
+			ARRAY_STRING = 1 << 6
+		};
+
+		unsigned int    valid = 0;
+		int             integer = 0;
+		double          floating = 0.0;
+		wxPoint         point;
+		wxSize          size;
+		wxColour        colour;
+		wxFontContainer font;
+		wxArrayString   arrayString;
+	};
+	std::unique_ptr< ValueCache > m_cache;
+
+	ValueCache& GetCache();
+	void InvalidateCache() { if ( m_cache ) m_cache->valid = 0; }
+
+	const wxString& Value() const { return ( m_sharedValue ? *m_sharedValue : m_value ); }
+	void AssignValue( const wxString& value );
 
 public:
-	Property(PPropertyInfo info, PObjectBase obj = PObjectBase())
+	/**
+	@param sharedValue Initial value owned by the class schema, it is shared instead
+	                   of copied until the property is modified. Must outlive the property.
+	*/
+	Property(PPropertyInfo info, PObjectBase obj = PObjectBase(), const wxString* sharedValue = nullptr)
+	:
+	m_sharedValue( sharedValue )
 	{
 		m_object = obj;
 		m_info = info;
@@ -148,9 +218,9 @@ public:
 
 	PObjectBase GetObject() { return m_object.lock(); }
 	wxString GetName()                 { return m_info->GetName(); }
-	wxString GetValue()                { return m_value; }
-	void SetValue( wxString& val )     { m_value = val; }
-	void SetValue( const wxChar* val )       { m_value = val;	}
+	wxString GetValue()                { return Value(); }
+	void SetValue( wxString& val )     { AssignValue( val ); }
+	void SetValue( const wxChar* val ) { AssignValue( val ); }
 
 	PPropertyInfo GetPropertyInfo() { return m_info; }
 	PropertyType  GetType()         { return m_info->GetType();  }
@@ -185,6 +255,17 @@ public:
 	double GetValueAsFloat();
 	void SplitParentProperty( std::map< wxString, wxString >* children );
 	wxString GetChildFromParent( const wxString& childName );
+
+	/**
+	Copies the value of a property with the same descriptor, a shared default
+	value stays shared. Used for snapshots, it doesn't notify the owner.
+	*/
+	void CopyValue( const Property& source )
+	{
+		m_value = source.m_value;
+		m_sharedValue = source.m_sharedValue;
+		InvalidateCache();
+	}
 };
 
 class Event
@@ -199,13 +280,59 @@ public:
     : m_info(info), m_object(obj)
   {}
 
-  void SetValue(const wxString &value) { m_value = value; }
+  void SetValue(const wxString &value);
   wxString GetValue()                  { return m_value; }
   wxString GetName()                   { return m_info->GetName(); }
   PObjectBase GetObject()              { return m_object.lock(); }
   PEventInfo GetEventInfo()            { return m_info; }
 };
 
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+Layout of the properties and events of a class, shared by all its instances.
+
+Every property and event of the class, inherited ones included, gets a slot.
+Slots are sorted by name, so walking them by index gives the same order the
+name-keyed maps used to give, which keeps the project files unchanged.
+*/
+class ObjectSchema
+{
+public:
+	struct PropertySlot
+	{
+		PPropertyInfo info;
+		wxString      defaultValue; // overrides of the derived classes already applied
+	};
+
+	ObjectSchema( ObjectInfo& info );
+
+	unsigned int GetPropertyCount() { return (unsigned int)m_properties.size(); }
+	unsigned int GetEventCount()    { return (unsigned int)m_events.size(); }
+
+	const PropertySlot& GetPropertySlot( unsigned int slot ) { return m_properties[ slot ]; }
+	PEventInfo GetEventInfo( unsigned int slot ) { return m_events[ slot ]; }
+
+	/**
+	Returns the slot of the property/event, or -1 if the class doesn't have it.
+	*/
+	int FindProperty( const wxString& name );
+	int FindProperty( PropertyAtom atom )
+	{
+		return ( atom >= 0 && (size_t)atom < m_atomSlots.size() ? m_atomSlots[ atom ] : -1 );
+	}
+	int FindEvent( const wxString& name );
+
+private:
+	typedef std::unordered_map< wxString, unsigned int, wxStringHash, wxStringEqual > SlotMap;
+
+	std::vector< PropertySlot > m_properties;
+	std::vector< PEventInfo >   m_events;
+	SlotMap m_propertySlots;
+	SlotMap m_eventSlots;
+	std::vector< int > m_atomSlots; // property slot by atom, -1 if the class doesn't have it
+};
+
 class PropertyCategory
 {
 private:
@@ -278,18 +405,88 @@ private:
 	WPObjectBase m_parent; // weak pointer, no reference loops please!
 
 	ObjectBaseVector m_children;
-	PropertyMap      m_properties;
-	EventMap         m_events;
+	PObjectSchema    m_schema;     // slot layout of m_properties and m_events
+	PropertyVector   m_properties; // indexed by property slot
+	EventVector      m_events;     // indexed by event slot
 	PObjectInfo      m_info;
 	bool m_expanded; // is expanded in the object tree, allows for saving to file
 
+	/**
+	* Names used in the subtree, the object included, and how many objects use
+	* each one. Built by the first GetNameCount() call, usually on forms and on
+	* the project, and then kept up to date by every insertion, removal and
+	* rename below the object.
+	*/
+	class NameIndex
+	{
+	public:
+		NameIndex() : m_valid( false ) {}
+		// A copy of the object starts without index, its subtree changes independently
+		NameIndex( const NameIndex& ) : m_valid( false ) {}
+		NameIndex& operator=( const NameIndex& ) { Reset(); return *this; }
+
+		bool IsValid() const { return m_valid; }
+		void Reset() { m_counts.clear(); m_valid = false; }
+		void Build( const std::vector< wxString >& names );
+		void Add( const wxString& name ) { ++m_counts[ name ]; }
+		void Remove( const wxString& name );
+		unsigned int GetCount( const wxString& name ) const;
+
+	private:
+		std::unordered_map< wxString, unsigned int, wxStringHash, wxStringEqual > m_counts;
+		bool m_valid;
+	};
+	NameIndex m_nameIndex;
+
+	std::vector< unsigned int > m_childTypeCounts; // number of children by ObjectType id
+
+	void ChildAttached( PObjectBase child );
+	void ChildDetached( PObjectBase child );
+
+	void CollectNames( std::vector< wxString >& names );
+	void GetNameIndexes( std::vector< NameIndex* >& indexes );
+	void UpdateNameIndexes( PObjectBase subtree, bool add );
+
+	/**
+	* Depth and nearest ancestors of interest, computed from the cache of the
+	* parent. Reparenting, detaching or destroying an object invalidates the
+	* caches of the subtree below it, the only ones that change, so the raw
+	* pointers are never used once an ancestor is gone. Other trees, e.g.
+	* snapshots used on other threads, are not touched.
+	*/
+	struct AncestorCache
+	{
+		bool          valid = false;
+		int           depth = 0;
+		ObjectBase*   form = nullptr;
+		ObjectBase*   wxParent = nullptr;       // nearest type with ObjectType::IsWxParent()
+		ObjectBase*   staticBoxSizer = nullptr; // nearest wxStaticBoxSizer subclass
+	};
+	AncestorCache m_ancestorCache;
+
+	void InvalidateAncestorCache();
+
+	/**
+	* The identity tells the objects apart, snapshots keep the identity of
+	* the object they copy. The revision changes with every property or event
+	* change, and is taken from a global counter, so a revision is never
+	* reused, not even by another object.
+	*/
+	unsigned long m_identity;
+	unsigned long m_revision;
+	static std::atomic< unsigned long > s_lastIdentity;
+	static std::atomic< unsigned long > s_lastRevision;
+
+	const AncestorCache& GetAncestorCache();
+	PObjectBase GetShared( ObjectBase* obj ) { return ( obj ? obj->GetThis() : PObjectBase() ); }
+
 protected:
 	// utilites for implementing the tree
 	static const int INDENT;  // size of indent
 	wxString GetIndentString(int indent); // obtiene la cadena con el indentado
 
 	ObjectBaseVector& GetChildren()     { return m_children; }
-	PropertyMap&      GetProperties()   { return m_properties; }
+	PropertyVector&   GetProperties()   { return m_properties; }
 
 	// Crea un elemento del objeto
 	void SerializeObject( ticpp::Element* serializedElement );
@@ -331,7 +528,7 @@ public:
 	PObjectBase GetNonSizerParent ();
 
 	/// Links the object to a parent
-	void SetParent(PObjectBase parent)  { m_parent = parent; }
+	void SetParent(PObjectBase parent);
 
 	/**
 	* Obtiene la propiedad identificada por el nombre.
@@ -340,9 +537,60 @@ public:
 	*       se hace a través de la referencia.
 	*/
 	PProperty GetProperty (wxString name);
+	PProperty GetProperty (PropertyAtom atom);
 
 	PEvent GetEvent(wxString name);
 
+	/**
+	* Sets the slot layout of the object and reserves its property and event slots.
+	* Must be called before adding the properties.
+	*/
+	void SetSchema( PObjectSchema schema );
+	PObjectSchema GetSchema() { return m_schema; }
+
+	/**
+	* Sets the schema and creates one property per slot, with the default
+	* values of the schema, and one event per slot. They are allocated as a
+	* single block that the PProperty and PEvent of the object share.
+	*/
+	void CreateMembers( PObjectSchema schema );
+
+	/**
+	* Creates a deep copy of the subtree that shares nothing but the class
+	* descriptors with it. Later changes to the project don't reach it, so it
+	* can be given to code generators or another thread while editing goes
+	* on. A snapshot is meant for a single consumer, they may modify it
+	* temporarily, as the C++ generator does with array names.
+	*
+	* @param withChildren False to copy just this object.
+	*/
+	PObjectBase CreateSnapshot( bool withChildren = true );
+
+	/**
+	* Identity of the object, shared with its snapshots.
+	*/
+	unsigned long GetIdentity() const { return m_identity; }
+
+	/**
+	* Revision of the properties and events of the object, see Touch().
+	*/
+	unsigned long GetRevision() const { return m_revision; }
+
+	/**
+	* Gives the object a new revision, called when a property or an event
+	* changes.
+	*/
+	void Touch() { m_revision = ++s_lastRevision; }
+
+	/**
+	* Takes the identities of the matching objects of another version of the
+	* subtree, e.g. the project as it was before being loaded again. Children
+	* are matched by class and name, in order. The objects whose properties
+	* and events did not change also take the revision, so the fragments of
+	* code generated for them are still found.
+	*/
+	void MatchIdentities( PObjectBase previous );
+
 	/**
 	* Añade una propiedad al objeto.
 	*
@@ -359,7 +607,7 @@ public:
 	*/
 	unsigned int GetPropertyCount() { return (unsigned int)m_properties.size(); }
 
-	unsigned int GetEventCount()    { return m_events.size(); }
+	unsigned int GetEventCount()    { return (unsigned int)m_events.size(); }
 
 	/**
 	* Obtiene una propiedad del objeto.
@@ -420,10 +668,18 @@ public:
 	*
 	* Será útil para encontrar el widget padre.
 	*/
-	PObjectBase FindNearAncestor(wxString type);
+	PObjectBase FindNearAncestor(PObjectType type);
 	PObjectBase FindNearAncestorByBaseClass(wxString type);
 	PObjectBase FindParentForm();
 
+	/**
+	* Nearest ancestors whose type creates the wx parent window of the objects
+	* below them, and nearest wxStaticBoxSizer. Like FindParentForm() and
+	* Deep(), they are cached until the tree structure changes.
+	*/
+	PObjectBase FindWxParentAncestor();
+	PObjectBase FindStaticBoxSizerAncestor();
+
 	/**
 	* Obtiene el documento xml del arbol tomando como raíz el nodo actual.
 	*/
@@ -457,7 +713,19 @@ public:
 	*/
 	void RemoveChild (PObjectBase obj);
 	void RemoveChild (unsigned int idx);
-	void RemoveAllChildren(){ m_children.clear(); }
+	void RemoveAllChildren();
+
+	/**
+	* Returns how many objects of the subtree, this one included, are named
+	* @a name. The first call indexes the subtree, later ones are hash lookups.
+	*/
+	unsigned int GetNameCount( const wxString& name );
+
+	/**
+	* Keeps the name indexes up to date, called by the "name" property before
+	* it changes.
+	*/
+	void OnNameChanged( const wxString& oldName, const wxString& newName );
 
 	/**
 	* Obtiene un hijo del objeto.
@@ -466,6 +734,11 @@ public:
 
 	PObjectBase GetChild (unsigned int idx, const wxString& type);
 
+	/**
+	* Number of children of the given type, kept up to date by AddChild/RemoveChild.
+	*/
+	unsigned int GetChildCountOfType( PObjectType type );
+
 	/**
 	* Obtiene el número de hijos del objeto.
 	*/
@@ -480,7 +753,7 @@ public:
 	//bool ChildTypeOk (wxString type);
 	bool ChildTypeOk (PObjectType type);
 
-	bool IsContainer() { return (GetObjectTypeName() == wxT("container") ); }
+	bool IsContainer();
 
 	PObjectBase GetLayout();
 
@@ -498,7 +771,7 @@ public:
 	* Devuelve el descriptor del objeto.
 	*/
 	PObjectInfo GetObjectInfo() { return m_info; }
-	void SetObjectInfo(PObjectInfo info) { m_info = info; }
+	void SetObjectInfo(PObjectInfo info) { m_info = info; InvalidateAncestorCache(); }
 
 	/**
 	* Devuelve la profundidad  del objeto en el arbol.
@@ -537,6 +810,23 @@ public:
 	IObject* GetChildPtr(unsigned int idx) override {
 		return GetChild(idx).get();
 	}
+
+	PropertyAtom GetPropertyAtom(const wxString& pname) override {
+		return PropertyAtoms::Find(pname);
+	}
+	bool IsNullByAtom(PropertyAtom patom) override;
+	int GetPropertyAsIntegerByAtom(PropertyAtom patom) override;
+	wxFontContainer GetPropertyAsFontByAtom(PropertyAtom patom) override;
+	wxColour GetPropertyAsColourByAtom(PropertyAtom patom) override;
+	wxString GetPropertyAsStringByAtom(PropertyAtom patom) override;
+	wxPoint GetPropertyAsPointByAtom(PropertyAtom patom) override;
+	wxSize GetPropertyAsSizeByAtom(PropertyAtom patom) override;
+	wxBitmap GetPropertyAsBitmapByAtom(PropertyAtom patom) override;
+	double GetPropertyAsFloatByAtom(PropertyAtom patom) override;
+
+	wxArrayInt GetPropertyAsArrayIntByAtom(PropertyAtom patom) override;
+	wxArrayString GetPropertyAsArrayStringByAtom(PropertyAtom patom) override;
+	std::vector<std::pair<int, int>> GetPropertyAsVectorIntPairByAtom(PropertyAtom patom) override;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -548,9 +838,18 @@ class CodeInfo
 {
 private:
 	typedef std::map<wxString,wxString> TemplateMap;
+	typedef std::map<wxString,PTemplateProgram> ProgramMap;
 	TemplateMap m_templates;
+	ProgramMap m_programs;
 public:
 	wxString GetTemplate(wxString name);
+
+	/**
+	* The template compiled when it was added, empty if it must be parsed.
+	* See TemplateParser::SetProgram().
+	*/
+	PTemplateProgram GetProgram( const wxString& name );
+
 	void AddTemplate(wxString name, wxString _template);
 	void Merge( PCodeInfo merger );
 };
@@ -572,8 +871,8 @@ public:
 
 	PPropertyCategory GetCategory(){ return m_category; }
 
-	unsigned int GetPropertyCount() { return (unsigned int)m_properties.size(); }
-	unsigned int GetEventCount()    { return (unsigned int)m_events.size();     }
+	unsigned int GetPropertyCount() { return (unsigned int)m_propertyOrder.size(); }
+	unsigned int GetEventCount()    { return (unsigned int)m_eventOrder.size();     }
 
 	/**
 	* Obtiene el descriptor de la propiedad.
@@ -643,9 +942,17 @@ public:
 	size_t AddBaseClass(PObjectInfo base)
 	{
 		m_base.push_back(base);
+		m_schema.reset();
+		m_hierarchyBuilt = false;
 		return m_base.size() - 1;
 	}
 
+	/**
+	* Recomputes the inherited base classes from the direct ones. It is done
+	* lazily too, the database calls it once the packages are set up.
+	*/
+	void BuildHierarchy();
+
 	/**
 	* Comprueba si el tipo es derivado del que se pasa como parámetro.
 	*/
@@ -664,8 +971,20 @@ public:
 	void AddCodeInfo(wxString lang, PCodeInfo codeinfo);
 	PCodeInfo GetCodeInfo(wxString lang);
 
+	/**
+	* Files of the plugins that define the class and its code templates.
+	*/
+	void AddDefinitionFile( const wxString& file );
+	const std::vector< wxString >& GetDefinitionFiles() const { return m_definitionFiles; }
+
 	PObjectPackage GetPackage();
 
+	/**
+	* Slot layout shared by the instances of this class. It is built on first use,
+	* so the class and its base classes must be completely defined by then.
+	*/
+	PObjectSchema GetSchema();
+
 	bool IsStartOfGroup() { return m_startGroup; }
 
 	/**
@@ -687,13 +1006,20 @@ private:
 	bool m_startGroup; // Place a separator in the palette toolbar just before this widget
 
 	std::map< wxString, PCodeInfo > m_codeTemp;  // plantillas de codigo K=language_name T=PCodeInfo
+	std::vector< wxString > m_definitionFiles;
 
 	unsigned int m_numIns;  // número de instancias del objeto
 
 	std::map< wxString, PPropertyInfo > m_properties;
 	std::map< wxString, PEventInfo >    m_events;
+	std::vector< PPropertyInfo > m_propertyOrder; // m_properties sorted by name, for indexed access
+	std::vector< PEventInfo >    m_eventOrder;
+	PObjectSchema m_schema;
 
 	std::vector< PObjectInfo > m_base; // base classes
+	std::vector< PObjectInfo > m_inherited; // all the base classes, in GetBaseClasses() order
+	std::unordered_set< wxString, wxStringHash, wxStringEqual > m_ancestors; // names of the class and of all its bases
+	bool m_hierarchyBuilt;
 	std::map< size_t, std::map< wxString, wxString > > m_baseClassDefaultPropertyValues;
 	IComponent* m_component;  // componente asociado a la clase los objetos del
 	// designer
@@ -29,36 +29,36 @@
 
 #include <wx/tokenzr.h>
 
-ObjectType::ObjectType(wxString name, int id, bool hidden, bool item)
+ObjectType::ObjectType(wxString name, int id, bool hidden, int flags)
 {
 	m_id = id;
 	m_name = name;
 	m_hidden = hidden;
-	m_item = item;
+	m_flags = flags;
 }
 
 void ObjectType::AddChildType(PObjectType type, int max, int aui_max)
 {
 	/*assert(max != 0);
 	assert(aui_max != 0);*/
-	m_childTypes.insert(ChildTypeMap::value_type(type,ChildCount(max, aui_max)));
+	if (m_childTypes.insert(ChildTypeMap::value_type(type,ChildCount(max, aui_max))).second)
+	{
+		// lookup table by type id, the types without entry can't be children (0)
+		size_t type_id = (size_t)type->GetId();
+		if (type_id >= m_childMax.size())
+			m_childMax.resize(type_id + 1, ChildCount(0, 0));
+
+		m_childMax[type_id] = ChildCount(max, aui_max);
+	}
 }
 
 int ObjectType::FindChildType(int type_id, bool aui)
 {
-	int max = 0;
-	ChildTypeMap::iterator it;
-	for (it = m_childTypes.begin(); it != m_childTypes.end() && max == 0; it++)
-	{
-		PObjectType type(it->first);
-		if (type && type_id == type->GetId())
-		{
-			if( aui ) max = it->second.aui_max;
-			else
-				max = it->second.max;
-		}
-	}
-	return max;
+	if (type_id < 0 || (size_t)type_id >= m_childMax.size())
+		return 0;
+
+	const ChildCount& count = m_childMax[type_id];
+	return ( aui ? count.aui_max : count.max );
 }
 
 int ObjectType::FindChildType(PObjectType type, bool aui)
@@ -94,6 +94,18 @@ PObjectType ObjectType::GetChildType(unsigned int idx)
 	return result;
 }
 
+PObjectType ObjectType::GetChildType(const wxString& name)
+{
+	for (ChildTypeMap::iterator it = m_childTypes.begin(); it != m_childTypes.end(); ++it)
+	{
+		PObjectType type = it->first.lock();
+		if (type && type->GetName() == name)
+			return type;
+	}
+
+	return PObjectType();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 IntList::IntList(bool absolute_value, bool pair_value)
@@ -64,20 +64,69 @@ class ObjectType
 {
 public:
 
-	ObjectType(wxString name, int id, bool hidden = false, bool item = false);
+	/**
+	 * Capabilities of the type, read from the attributes of objtypes.xml
+	 * so the code doesn't need to compare type names.
+	 */
+	enum
+	{
+		FLAG_FORM       = 1 << 0, /**< top level object: form, wizard, menubar_form... */
+		FLAG_SIZER      = 1 << 1, /**< sizer or gbsizer */
+		FLAG_CONTAINER  = 1 << 2, /**< "container", lays out its own children */
+		FLAG_AUI_PANE   = 1 << 3, /**< can be managed as a pane by wxAuiManager */
+		FLAG_WXPARENT   = 1 << 4, /**< window created as the wx parent of the objects below it */
+		FLAG_ITEM       = 1 << 5, /**< adds its properties to the object it contains: sizeritem... */
+		FLAG_FRAME_ONLY = 1 << 6, /**< only a wxFrame among the forms can hold it: menubar, statusbar... */
+		FLAG_TOOLBAR    = 1 << 7, /**< toolbar or toolbar_form, selected instead of its tools */
+		FLAG_PALETTE    = 1 << 8  /**< its classes are shown in the component palette */
+	};
+
+	ObjectType(wxString name, int id, bool hidden = false, int flags = 0);
 
 	int    GetId()
 	{
 		return m_id;
 	}
-	wxString GetName()
+	const wxString& GetName()
 	{
 		return m_name;
 	}
 	//bool   IsHidden()  { return m_hidden; }
 	bool   IsItem()
 	{
-		return m_item;
+		return ( m_flags & FLAG_ITEM ) != 0;
+	}
+	bool   IsForm()
+	{
+		return ( m_flags & FLAG_FORM ) != 0;
+	}
+	bool   IsSizer()
+	{
+		return ( m_flags & FLAG_SIZER ) != 0;
+	}
+	bool   IsContainer()
+	{
+		return ( m_flags & FLAG_CONTAINER ) != 0;
+	}
+	bool   IsAuiPane()
+	{
+		return ( m_flags & FLAG_AUI_PANE ) != 0;
+	}
+	bool   IsWxParent()
+	{
+		return ( m_flags & FLAG_WXPARENT ) != 0;
+	}
+	bool   IsFrameOnly()
+	{
+		return ( m_flags & FLAG_FRAME_ONLY ) != 0;
+	}
+	bool   IsToolbar()
+	{
+		return ( m_flags & FLAG_TOOLBAR ) != 0;
+	}
+	bool   IsInPalette()
+	{
+		return ( m_flags & FLAG_PALETTE ) != 0;
 	}
 
 
@@ -98,6 +147,11 @@ public:
 	unsigned int GetChildTypeCount();
 	PObjectType GetChildType(unsigned int idx);
 
+	/**
+	 * The possible child type with that name, if any.
+	 */
+	PObjectType GetChildType(const wxString& name);
+
 private:
 	class ChildCount
 	{
@@ -118,12 +172,10 @@ private:
 	int m_id;        /**< identificador numérico del tipo de objeto */
 	wxString m_name;   /**< cadena de texto asociado al tipo */
 	bool m_hidden;   /**< indica si está oculto en el ObjectTree */
-	bool m_item;     /**< indica si es un "item". Los objetos contenidos en
-                     *  en un item, muestran las propiedades de éste junto
-                     *  con las propias del objeto.
-                     */
+	int  m_flags;    /**< capabilities, see FLAG_FORM */
 
 	ChildTypeMap m_childTypes; /**< registro de posibles hijos */
+	std::vector<ChildCount> m_childMax; /**< m_childTypes indexed by type id */
 };
 
 /**
@@ -31,6 +31,8 @@
 
 #include "../codegen/codewriter.h"
 #include "../codegen/cppcg.h"
+#include "../codegen/fragmentcache.h"
+#include "../codegen/generationscheduler.h"
 #include "../codegen/luacg.h"
 #include "../codegen/phpcg.h"
 #include "../codegen/pythoncg.h"
@@ -55,10 +57,6 @@
 using namespace TypeConv;
 
 
-const char* const VERSION = "3.9.0";
-const char* const REVISION = "";
-
-
 ///////////////////////////////////////////////////////////////////////////////
 // Comandos
 ///////////////////////////////////////////////////////////////////////////////
@@ -481,8 +479,8 @@ ApplicationData::ApplicationData( const wxString &rootdir )
 		m_objDb( new ObjectDatabase() ),
 		m_manager( new wxFBManager ),
 		m_ipc( new wxFBIPC ),
-		m_fbpVerMajor( 1 ),
-		m_fbpVerMinor(15)
+		m_fbpVerMajor( FBP_VERSION_MAJOR ),
+		m_fbpVerMinor( FBP_VERSION_MINOR )
 {
 	#ifdef __WXFB_DEBUG__
 	//wxLog* log = wxLog::SetActiveTarget( NULL );
@@ -500,6 +498,9 @@ ApplicationData::ApplicationData( const wxString &rootdir )
 	// Support for loading files from archives
 	wxFileSystem::AddHandler( new wxArchiveFSHandler );
 	wxFileSystem::AddHandler( new wxFilterFSHandler );
+
+	// The code panels generate the same project again after every edit
+	FragmentCache::Enable( true );
 }
 
 ApplicationData::~ApplicationData()
@@ -531,10 +532,7 @@ PObjectBase ApplicationData::GetSelectedObject()
 
 PObjectBase ApplicationData::GetSelectedForm()
 {
-	if( ( m_selObj->GetObjectTypeName() == wxT( "form" ) ) ||
-        ( m_selObj->GetObjectTypeName() == wxT("wizard") ) ||
-		( m_selObj->GetObjectTypeName() == wxT( "menubar_form" ) ) ||
-		( m_selObj->GetObjectTypeName() == wxT( "toolbar_form" ) ) )
+	if( m_selObj->GetObjectInfo()->GetObjectType()->IsForm() )
 		return m_selObj;
 	else
 		return m_selObj->FindParentForm();
@@ -546,18 +544,17 @@ PObjectBase ApplicationData::GetProjectData()
 	return m_project;
 }
 
-void ApplicationData::BuildNameSet( PObjectBase obj, PObjectBase top, std::set< wxString >& name_set )
+PObjectBase ApplicationData::GetProjectSnapshot( PObjectBase form )
 {
-	if ( obj != top )
-	{
-		PProperty nameProp = top->GetProperty( wxT( "name" ) );
+	if ( !form )
+		return m_project->CreateSnapshot();
 
-		if ( nameProp )
-			name_set.insert( nameProp->GetValue() );
-	}
+	PObjectBase project = m_project->CreateSnapshot( false );
+	PObjectBase formSnapshot = form->CreateSnapshot();
+	project->AddChild( formSnapshot );
+	formSnapshot->SetParent( project );
 
-	for ( unsigned int i = 0; i < top->GetChildCount(); i++ )
-		BuildNameSet( obj, top->GetChild( i ), name_set );
+	return project;
 }
 
 void ApplicationData::ResolveNameConflict( PObjectBase obj )
@@ -585,23 +582,20 @@ void ApplicationData::ResolveNameConflict( PObjectBase obj )
 	if ( !top )
 		top = m_project; // el objeto es un form.
 
-	// construimos el conjunto de nombres
-	std::set<wxString> name_set;
-
-	BuildNameSet( obj, top, name_set );
-
-	// comprobamos si hay conflicto
-	std::set<wxString>::iterator it = name_set.find( originalName );
+	// the object doesn't conflict with itself, if it is already in the form
+	bool inTop = false;
+	for ( PObjectBase ancestor = obj; ancestor && !inTop; ancestor = ancestor->GetParent() )
+		inTop = ( ancestor == top );
 
+	// comprobamos si hay conflicto, el form mantiene el índice de sus nombres
 	int i = 0;
 
 	wxString name = originalName; // The name that gets incremented.
 
-	while ( it != name_set.end() )
+	while ( top->GetNameCount( name ) > ( inTop && name == originalName ? 1u : 0u ) )
 	{
 		i++;
 		name = wxString::Format( wxT( "%s%i" ), originalName.c_str(), i );
-		it = name_set.find( name );
 	}
 
 	nameProp->SetValue( name );
@@ -1260,133 +1254,46 @@ void ApplicationData::SaveProject( const wxString& filename )
 	}
 }
 
-bool ApplicationData::LoadProject( const wxString &file, bool justGenerate )
+bool ApplicationData::LoadProject( const wxString &file )
 
 {
 	LogDebug( wxT( "LOADING" ) );
 
-	if ( !wxFileName::FileExists( file ) )
+	// A missing file is reported by the loader
+	if ( wxFileName::FileExists( file ) && !m_ipc->VerifySingleInstance( file ) )
 	{
-		wxLogError( wxT( "This file does not exist: %s" ), file.c_str() );
 		return false;
 	}
 
-	if ( !justGenerate)
-	{
-		if ( !m_ipc->VerifySingleInstance( file ) )
-		{
-			return false;
-		}
-	}
+	m_objDb->ResetObjectCounters();
 
-	try
+	bool older = false;
+	PObjectBase proj = m_objDb->LoadProject( file, [this, &file]( ticpp::Document& doc, int fileMajor, int fileMinor )
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, false, file );
-
-		ticpp::Element* root = doc.FirstChildElement();
-
-		m_objDb->ResetObjectCounters();
-
-		int fbpVerMajor = 0;
-		int fbpVerMinor = 0;
-
-		if ( root->Value() != std::string( "object" ) )
-		{
-			try
-			{
-				ticpp::Element* fileVersion = root->FirstChildElement( "FileVersion" );
-				fileVersion->GetAttributeOrDefault( "major", &fbpVerMajor, 0 );
-				fileVersion->GetAttributeOrDefault( "minor", &fbpVerMinor, 0 );
-			}
-			catch( ticpp::Exception& )
-			{
-			}
-		}
-
-		bool older = false;
-		bool newer = false;
-
-		if ( m_fbpVerMajor == fbpVerMajor )
-		{
-			older = ( fbpVerMinor < m_fbpVerMinor );
-			newer = ( fbpVerMinor > m_fbpVerMinor );
-		}
-		else
-		{
-			older = ( fbpVerMajor < m_fbpVerMajor );
-			newer = ( fbpVerMajor > m_fbpVerMajor );
-		}
-
-		if ( newer )
-		{
-			if( justGenerate ){
-				wxLogError( wxT( "This project file is newer than this version of wxFormBuilder.\n" ) );
-			}else{
-				wxMessageBox( wxT( "This project file is newer than this version of wxFormBuilder.\n" )
-			              wxT( "It cannot be opened.\n\n" )
-			              wxT( "Please download an updated version from http://www.wxFormBuilder.org" ), _( "New Version" ), wxICON_ERROR );
-			}
-			return false;
-		}
-
-		if ( older )
-		{
-			if( justGenerate ){
-				wxLogError( wxT( "This project file is out of date.  Update your .fbp before using --generate" ) );
-				return false;
-			}
-
-			wxMessageBox(
-			    _("This project file is using an older file format, it will be updated during loading.\n\n"
-			      "WARNING: Saving the project will update the format of the project file on disk!"),
-			    _("Older file format"));
-
-			if (ConvertProject(doc, file, fbpVerMajor, fbpVerMinor))
-			{
-				// Document has changed -- reacquire the root node
-				root = doc.FirstChildElement();
-			}
-			else
-			{
-				wxLogError(wxT("Unable to convert project"));
-				return false;
-			}
-		}
+		wxMessageBox(
+		    _("This project file is using an older file format, it will be updated during loading.\n\n"
+		      "WARNING: Saving the project will update the format of the project file on disk!"),
+		    _("Older file format"));
 
-		ticpp::Element* object = root->FirstChildElement( "object" );
-		PObjectBase proj;
+		return ConvertProject( doc, file, fileMajor, fileMinor );
+	}, &older );
 
-		try
-		{
-			proj = m_objDb->CreateObject( object );
-		}
-		catch ( wxFBException& ex )
-		{
-			wxLogError( ex.what() );
-			return false;
-		}
-
-		if ( proj && proj->GetObjectTypeName() == wxT( "project" ) )
-		{
-			PObjectBase old_proj = m_project;
-			m_project = proj;
-			m_selObj = m_project;
-			// Set the modification to true if the project was older and has been converted
-			m_modFlag = older;
-			m_cmdProc.Reset();
-			m_projectFile = file;
-			SetProjectPath( ::wxPathOnly( file ) );
-			NotifyProjectLoaded();
-			NotifyProjectRefresh();
-		}
-	}
-	catch( ticpp::Exception& ex )
+	if ( !proj )
 	{
-		wxLogError( _WXSTR( ex.m_details ) );
 		return false;
 	}
 
+	PObjectBase old_proj = m_project;
+	m_project = proj;
+	m_selObj = m_project;
+	// Set the modification to true if the project was older and has been converted
+	m_modFlag = older;
+	m_cmdProc.Reset();
+	m_projectFile = file;
+	SetProjectPath( ::wxPathOnly( file ) );
+	NotifyProjectLoaded();
+	NotifyProjectRefresh();
+
 	return true;
 }
 
@@ -2383,6 +2290,27 @@ void ApplicationData::NewProject()
 
 void ApplicationData::GenerateCode( bool panelOnly, bool noDelayed )
 {
+	// The files of all the languages are generated together, the panels only show the code
+	if ( !panelOnly && m_project )
+	{
+		GenerationScheduler scheduler( GetProjectSnapshot(), GetProjectPath() );
+		if ( !scheduler.GetLanguages().empty() )
+		{
+			try
+			{
+				wxString path = GetOutputPath();
+				if ( scheduler.Generate( path ) )
+				{
+					wxLogStatus( wxT( "Code generated on \'%s\'." ), path.c_str() );
+				}
+			}
+			catch ( wxFBException& ex )
+			{
+				wxLogWarning( ex.what() );
+			}
+		}
+	}
+
 	NotifyCodeGeneration( panelOnly, !noDelayed );
 }
 
@@ -3102,52 +3030,17 @@ bool ApplicationData::VerifySingleInstance( const wxString& file, bool switchTo
 	return m_ipc->VerifySingleInstance( file, switchTo );
 }
 
-wxString ApplicationData::GetPathProperty( const wxString& pathName )
+void ApplicationData::SetProjectPath( const wxString &path )
 {
-	PObjectBase project = GetProjectData();
-	wxFileName path;
-	// Get the output path
-	PProperty ppath = project->GetProperty( pathName );
-
-	if ( ppath )
-	{
-		wxString pathEntry = ppath->GetValue();
-
-		if ( pathEntry.empty() )
-		{
-			THROW_WXFBEX( wxT( "You must set the \"") + pathName + wxT("\" property of the project to a valid path for output files" ) );
-		}
-
-		path = wxFileName::DirName( pathEntry );
-
-		if ( !path.IsAbsolute() )
-		{
-			wxString projectPath = AppData()->GetProjectPath();
-
-			if ( projectPath.empty() )
-			{
-				THROW_WXFBEX( wxT( "You must save the project when using a relative path for output files" ) );
-			}
-
-			path = wxFileName(  projectPath +
-								wxFileName::GetPathSeparator() +
-								pathEntry +
-								wxFileName::GetPathSeparator() );
-
-			path.Normalize();
-
-			// this approach is probably incorrect if the fb project is located under a symlink
-			/*path.SetCwd( projectPath );
-			path.MakeAbsolute();*/
-		}
-	}
+	m_projectPath = path;
 
-	if ( !path.DirExists() )
-	{
-		THROW_WXFBEX( wxT( "Invalid Path: " ) << path.GetPath() << wxT( "\nYou must set the \"") + pathName + wxT("\" property of the project to a valid path for output files" ) );
-	}
+	// The bitmaps of the designer are loaded relative to the project
+	TypeConv::SetBitmapBasePath( path );
+}
 
-	return path.GetPath( wxPATH_GET_VOLUME | wxPATH_GET_SEPARATOR );
+wxString ApplicationData::GetPathProperty( const wxString& pathName )
+{
+	return CodeGenerator::GetOutputPath( GetProjectData(), GetProjectPath(), pathName );
 }
 
 wxString ApplicationData::GetOutputPath()
@@ -51,9 +51,6 @@ class wxFBIPC;
 #define AppDataInit()	      (ApplicationData::Initialize())
 #define AppDataDestroy()  	(ApplicationData::Destroy())
 
-extern const char* const VERSION;
-extern const char* const REVISION;
-
 // This class is a singleton class.
 
 class ApplicationData
@@ -138,11 +135,6 @@ class ApplicationData
 		 */
 		void ResolveSubtreeNameConflicts( PObjectBase obj, PObjectBase topObj = PObjectBase() );
 
-		/**
-		 * Rutina auxiliar de ResolveNameConflict
-		 */
-		void BuildNameSet( PObjectBase obj, PObjectBase top, std::set<wxString> &name_set );
-
 		/**
 		 * Calcula la posición donde deberá ser insertado el objeto.
 		 *
@@ -264,7 +256,7 @@ class ApplicationData
 		void RemoveHandler( wxEvtHandler* handler );
 
 		// Operaciones sobre los datos
-		bool LoadProject( const wxString &file, bool justGenerate = false );
+		bool LoadProject( const wxString &file );
 
 		void SaveProject( const wxString &filename );
 
@@ -347,6 +339,12 @@ class ApplicationData
 
 		PObjectBase GetProjectData();
 
+		/**
+		 * Frozen copy of the project, see ObjectBase::CreateSnapshot().
+		 * @param form If set, the copy holds just this form of the project.
+		 */
+		PObjectBase GetProjectSnapshot( PObjectBase form = PObjectBase() );
+
 		PObjectBase GetSelectedForm();
 
 		bool CanUndo() { return m_cmdProc.CanUndo(); }
@@ -397,7 +395,7 @@ class ApplicationData
 		*/
 		wxString GetEmbeddedFilesOutputPath();
 
-		void SetProjectPath( const wxString &path ) { m_projectPath = path; }
+		void SetProjectPath( const wxString &path );
 
 		const wxString &GetApplicationPath() { return m_rootDir; }
 
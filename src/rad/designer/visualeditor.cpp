@@ -235,19 +235,9 @@ void VisualEditor::ScanPanes( wxWindow* parent)
 		{
 			updateNeeded = false;
 
-			PObjectInfo obj_info = obj->GetObjectInfo();
-			wxString cname = obj_info->GetObjectType()->GetName();
-
-			if( cname == wxT("widget") ||
-				cname == wxT("expanded_widget") ||
-				cname == wxT("ribbonbar") ||
-				cname == wxT("propgrid") ||
-				cname == wxT("propgridman") ||
-				cname == wxT("dataviewctrl") ||
-				cname == wxT("dataviewtreectrl") ||
-				cname == wxT("dataviewlistctrl") ||
-				cname == wxT("toolbar") ||
-				cname == wxT("container") )
+			PObjectType objType = obj->GetObjectInfo()->GetObjectType();
+
+			if( objType->IsAuiPane() || objType->IsToolbar() )
 			{
 				wxAuiPaneInfo inf = m_auimgr->GetPane(*child);
 				if(inf.IsOk())
@@ -536,7 +526,7 @@ void VisualEditor::Create()
 			  m_back->ShowTitleBar(false);
 
 			// --- AUI
-			if(  m_form->GetObjectTypeName() == wxT("form") )
+			if(  m_form->GetObjectInfo()->GetObjectType()->IsForm() )
 			{
 				if(  m_form->GetPropertyAsInteger( wxT("aui_managed") ) == 1)
 				{
@@ -590,7 +580,7 @@ void VisualEditor::Create()
 					// Create the menubar later
 					menubar = child;
 				} else if (toolbar == nullptr &&
-				           m_form->GetObjectTypeName() == wxT("toolbar_form")) {
+				           m_form->GetObjectInfo()->GetObjectType()->IsToolbar()) {
 					Generate( m_form, m_back->GetFrameContentPanel(), m_back->GetFrameContentPanel() );
 
 					ObjectBaseMap::iterator it = m_baseobjects.find( m_form.get() );
@@ -919,26 +909,9 @@ void VisualEditor::SetupWindow( PObjectBase obj, wxWindow* window )
 	}
 
 	//AUI
-	wxString tname = obj->GetObjectInfo()->GetObjectType()->GetName();
-	if( m_auimgr && ( tname == wxT("widget") ||
-					tname == wxT("expanded_widget") ||
-					tname == wxT("container") ||
-					tname == wxT("notebook") ||
-					tname == wxT("auinotebook") ||
-					tname == wxT("flatnotebook") ||
-					tname == wxT("listbook") ||
-					tname == wxT("simplebook") ||
-					tname == wxT("choicebook") ||
-					tname == wxT("treelistctrl") ||
-					tname == wxT("ribbonbar") ||
-					tname == wxT("dataviewctrl") ||
-					tname == wxT("dataviewtreectrl") ||
-					tname == wxT("dataviewlistctrl") ||
-					tname == wxT("propgrid") ||
-					tname == wxT("propgridman") ||
-					tname == wxT("splitter") ) )
+	if( m_auimgr && obj->GetObjectInfo()->GetObjectType()->IsAuiPane() )
 	{
-		if( obj->GetParent()->GetObjectTypeName() == wxT("form") )
+		if( obj->GetParent()->GetObjectInfo()->GetObjectType()->IsForm() )
 		{
 			SetupAui(obj, window);
 		}
@@ -1101,9 +1074,14 @@ void VisualEditor::OnObjectSelected( wxFBObjectEvent &event )
 	}
 
 	// highlight parent toolbar instead of its children
-	PObjectBase toolbar = obj->FindNearAncestor( wxT("toolbar") );
-	if( !toolbar ) toolbar = obj->FindNearAncestor( wxT("toolbar_form") );
-	if( toolbar ) obj = toolbar;
+	for( PObjectBase parent = obj->GetParent(); parent; parent = parent->GetParent() )
+	{
+		if( parent->GetObjectInfo()->GetObjectType()->IsToolbar() )
+		{
+			obj = parent;
+			break;
+		}
+	}
 
 	// Make sure this is a visible object
 	ObjectBaseMap::iterator it = m_baseobjects.find( obj.get() );
@@ -182,8 +182,9 @@ void PythonPanel::OnCodeGeneration( wxFBEvent& event )
 	// Using the previously unused Id field in the event to carry a boolean
 	bool panelOnly = ( event.GetId() != 0 );
 
-	// Only generate to panel + panel is not shown = do nothing
-	if ( panelOnly && !doPanel )
+	// The files are generated by ApplicationData::GenerateCode(), the panel only
+	// shows the code, so there is nothing to do if it is not shown
+	if ( !doPanel )
 	{
 		return;
 	}
@@ -191,56 +192,19 @@ void PythonPanel::OnCodeGeneration( wxFBEvent& event )
 	// For code preview generate only code relevant to selected form,
 	// otherwise generate full project code.
 
-	// Create copy of the original project due to possible temporary modifications
-	PObjectBase project = PObjectBase(new ObjectBase(*AppData()->GetProjectData()));
-
 	if(panelOnly)
 	{
 	    objectToGenerate = AppData()->GetSelectedForm();
 	}
 
-	if(!panelOnly || !objectToGenerate)
-	{
-	    objectToGenerate = project;
-	}
+	// Generate from a snapshot of the project, the generators may modify it
+	// temporarily. For the preview it only holds the selected form.
+	PObjectBase project = AppData()->GetProjectSnapshot( panelOnly ? objectToGenerate : PObjectBase() );
 
-	// If only one project item should be generated then remove the rest items
-	// from the temporary project
-	if(doPanel && panelOnly && (objectToGenerate != project))
-	{
-	    if( project->GetChildCount() > 0)
-	    {
-	        unsigned int i = 0;
-            while( project->GetChildCount() > 1 )
-            {
-                if(project->GetChild( i ) != objectToGenerate)
-                {
-                    project->RemoveChild( i );
-                }
-                else
-                    i++;
-            }
-	    }
-	}
-
-    if(!project || !objectToGenerate)return;
+    if(!project)return;
 
     // Get Python properties from the project
 
-	// If Python generation is not enabled, do not generate the file
-	bool doFile = false;
-	PProperty pCodeGen = project->GetProperty( wxT( "code_generation" ) );
-	if ( pCodeGen )
-	{
-		//doFile = TypeConv::FlagSet( wxT("C++"), pCodeGen->GetValue() ) && !panelOnly;
-		doFile = TypeConv::FlagSet( wxT("Python"), pCodeGen->GetValue() ) && !panelOnly;
-	}
-
-	if ( !(doPanel || doFile ) )
-	{
-		return;
-	}
-
 	// Get First ID from Project File
 	unsigned int firstID = 1000;
 	PProperty pFirstID = project->GetProperty( wxT("first_id") );
@@ -249,18 +213,6 @@ void PythonPanel::OnCodeGeneration( wxFBEvent& event )
 		firstID = pFirstID->GetValueAsInteger();
 	}
 
-	// Get the file name
-	wxString file;
-	PProperty pfile = project->GetProperty( wxT( "file" ) );
-	if ( pfile )
-	{
-		file = pfile->GetValue();
-	}
-	if ( file.empty() )
-	{
-		file = wxT("noname");
-	}
-
 	// Determine if the path is absolute or relative
 	bool useRelativePath = false;
 	PProperty pRelPath = project->GetProperty( wxT( "relative_path" ) );
@@ -275,14 +227,10 @@ void PythonPanel::OnCodeGeneration( wxFBEvent& event )
 	{
 		path = AppData()->GetOutputPath();
 	}
-	catch ( wxFBException& ex )
+	catch ( wxFBException& )
 	{
-		if ( doFile )
-		{
-			path = wxEmptyString;
-			wxLogWarning( ex.what() );
-			return;
-		}
+		// The code can be shown without it
+		path = wxEmptyString;
 	}
 
 	bool useSpaces = false;
@@ -305,6 +253,7 @@ void PythonPanel::OnCodeGeneration( wxFBEvent& event )
 	{
 		PythonCodeGenerator codegen;
 		codegen.UseRelativePath( useRelativePath, path );
+		codegen.SetProjectPath( AppData()->GetProjectPath() );
 		codegen.SetImagePathWrapperFunctionName( imagePathWrapperFunctionName );
 
 		if ( pFirstID )
@@ -331,50 +280,4 @@ void PythonPanel::OnCodeGeneration( wxFBEvent& event )
 
 		Thaw();
 	}
-
-	// Generate code in the file
-	if ( doFile )
-	{
-		try
-		{
-			PythonCodeGenerator codegen;
-			codegen.UseRelativePath( useRelativePath, path );
-			codegen.SetImagePathWrapperFunctionName( imagePathWrapperFunctionName );
-
-			if ( pFirstID )
-			{
-				codegen.SetFirstID( firstID );
-			}
-
-			// Determin if Microsoft BOM should be used
-			bool useMicrosoftBOM = false;
-
-			PProperty pUseMicrosoftBOM = project->GetProperty( wxT( "use_microsoft_bom" ) );
-
-			if ( pUseMicrosoftBOM )
-			{
-				useMicrosoftBOM = ( pUseMicrosoftBOM->GetValueAsInteger() != 0 );
-			}
-
-			// Determine if Utf8 or Ansi is to be created
-			bool useUtf8 = false;
-			PProperty pUseUtf8 = project->GetProperty( _("encoding") );
-
-			if ( pUseUtf8 )
-			{
-				useUtf8 = ( pUseUtf8->GetValueAsString() != wxT("ANSI") );
-			}
-
-			PCodeWriter python_cw( new FileCodeWriter( path + file + wxT( ".py" ), useMicrosoftBOM, useUtf8 ) );
-			python_cw->SetIndentWithSpaces( useSpaces );
-
-			codegen.SetSourceWriter( python_cw );
-			codegen.GenerateCode( project );
-			wxLogStatus( wxT( "Code generated on \'%s\'." ), path.c_str() );
-		}
-		catch ( wxFBException& ex )
-		{
-			wxLogError( ex.what() );
-		}
-	}
 }
@@ -169,8 +169,9 @@ void XrcPanel::OnCodeGeneration( wxFBEvent& event )
 	// Generate code in the panel if the panel is active
 	bool doPanel = IsShown();
 
-	// Only generate to panel + panel is not shown = do nothing
-	if ( panelOnly && !doPanel )
+	// The files are generated by ApplicationData::GenerateCode(), the panel only
+	// shows the code, so there is nothing to do if it is not shown
+	if ( !doPanel )
 	{
 		return;
 	}
@@ -182,11 +183,18 @@ void XrcPanel::OnCodeGeneration( wxFBEvent& event )
 	    project = AppData()->GetSelectedForm();
 	}
 
-	if(!panelOnly || !project)
+	// Generate from a snapshot of the project, or of just the selected form.
+	// The snapshot root must outlive the form, the form only has a weak link to it.
+	PObjectBase snapshot;
+	if(panelOnly && project)
 	{
-	    project = AppData()->GetProjectData();
+	    snapshot = AppData()->GetProjectSnapshot( project );
+	    project = snapshot->GetChild( 0 );
+	}
+	else
+	{
+	    project = snapshot = AppData()->GetProjectSnapshot();
 	}
-	//PObjectBase project = AppData()->GetProjectData();
 
 	if(!project)return;
 
@@ -209,56 +217,4 @@ void XrcPanel::OnCodeGeneration( wxFBEvent& event )
 		editor->SetCurrentPos( 0 );
 		Thaw();
 	}
-
-	if ( panelOnly )
-	{
-		return;
-	}
-
-	PProperty pCodeGen = project->GetProperty( wxT("code_generation") );
-	if ( pCodeGen )
-	{
-		if ( !TypeConv::FlagSet ( wxT("XRC"), pCodeGen->GetValue() ) )
-		{
-			return;
-		}
-	}
-
-	// And now in the file.
-	{
-		XrcCodeGenerator codegen;
-
-		wxString file, pathEntry;
-
-		wxString path;
-
-		try
-		{
-			// Get the output path
-			path = AppData()->GetOutputPath();
-
-			PProperty pfile = project->GetProperty( wxT( "file" ) );
-
-			if ( pfile )
-				file = pfile->GetValue();
-
-			if ( file.empty() )
-			{
-				file = wxT( "noname" );
-			}
-
-			wxString filePath;
-
-			filePath << path << file << wxT( ".xrc" );
-			PCodeWriter cw( new FileCodeWriter( filePath ) );
-
-			codegen.SetWriter( cw );
-			codegen.GenerateCode( project );
-			wxLogStatus( wxT( "Code generated on \'%s\'." ), path.c_str() );
-		}
-		catch ( wxFBException& ex )
-		{
-			wxLogError( ex.what() );
-		}
-	}
 }
@@ -1,6 +1,5 @@
 #include "filetocarray.h"
 
-#include "../rad/appdata.h"
 #include "../model/objectbase.h"
 #include "../codegen/codewriter.h"
 #include "../codegen/cppcg.h"
@@ -8,6 +7,7 @@
 #include "wxfbexception.h"
 
 #include <wx/filename.h>
+#include <wx/image.h>
 
 #include <fstream>
 
@@ -56,7 +56,7 @@ wxString GetBitmapType( const wxFileName& sourceFileName )
 	}
 }
 
-wxString FileToCArray::Generate( const wxString& sourcePath )
+wxString FileToCArray::Generate( const wxString& sourcePath, PObjectBase project, const wxString& projectPath, const CodeWriterFactory& createWriter )
 {
 	wxFileName sourceFileName( sourcePath );
 
@@ -70,15 +70,13 @@ wxString FileToCArray::Generate( const wxString& sourcePath )
 		return targetFullName;
 	}
 
-	PObjectBase project = AppData()->GetProjectData();
-
 	// Get the output path
 	wxString outputPath;
 	wxString embeddedFilesOutputPath;
 	try
 	{
-		outputPath = AppData()->GetOutputPath();
-		embeddedFilesOutputPath = AppData()->GetEmbeddedFilesOutputPath();
+		outputPath = CodeGenerator::GetOutputPath( project, projectPath );
+		embeddedFilesOutputPath = CodeGenerator::GetOutputPath( project, projectPath, wxT("embedded_files_path") );
 	}
 	catch ( wxFBException& ex )
 	{
@@ -104,7 +102,16 @@ wxString FileToCArray::Generate( const wxString& sourcePath )
 	}
 
 	// setup output file
-	PCodeWriter arrayCodeWriter( new FileCodeWriter( embeddedFilesOutputPath + targetFullName, useMicrosoftBOM, useUtf8 ) );
+	const wxString targetPath = embeddedFilesOutputPath + targetFullName;
+	PCodeWriter arrayCodeWriter;
+	if ( createWriter )
+	{
+		arrayCodeWriter = createWriter( targetPath, useMicrosoftBOM, useUtf8 );
+	}
+	else
+	{
+		arrayCodeWriter.reset( new FileCodeWriter( targetPath, useMicrosoftBOM, useUtf8 ) );
+	}
 
 	const wxString headerGuardName = arrayName.Upper() + wxT("_H");
 	arrayCodeWriter->WriteLn( wxT("#ifndef ") + headerGuardName );
@@ -154,6 +161,6 @@ wxString FileToCArray::Generate( const wxString& sourcePath )
 	arrayCodeWriter->WriteLn();
 	arrayCodeWriter->WriteLn( wxT("#endif //") + headerGuardName );
 
-	return TypeConv::MakeRelativePath( embeddedFilesOutputPath + targetFullName, outputPath );
+	return TypeConv::MakeRelativePath( targetPath, outputPath );
 }
 
@@ -1,12 +1,21 @@
 #ifndef FILE_TO_C_ARRAY_H
 #define FILE_TO_C_ARRAY_H
 
+#include "wxfbdefs.h"
+#include "../codegen/codewriter.h"
+
 #include <wx/string.h>
 
 class FileToCArray
 {
 public:
-	static wxString Generate( const wxString& sourcepath );
+	/**
+	* Writes the file as a C array into the embedded_files_path of the project.
+	* Returns the path of the header, relative to the output path.
+	* @param createWriter Creates the writer of the header, which is written
+	*                     directly by default.
+	*/
+	static wxString Generate( const wxString& sourcepath, PObjectBase project, const wxString& projectPath, const CodeWriterFactory& createWriter = CodeWriterFactory() );
 };
 
 #endif // FILE_TO_C_ARRAY_H
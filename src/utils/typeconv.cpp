@@ -25,12 +25,11 @@
 
 #include "typeconv.h"
 
-#include "../rad/appdata.h"
 #include "../rad/bitmaps.h"
-#include "../rad/inspector/objinspect.h"
 
 #include <wx/artprov.h>
 #include <wx/filesys.h>
+#include <wx/propgrid/props.h>
 
 ////////////////////////////////////
 
@@ -408,6 +407,16 @@ wxString TypeConv::FontWeightToString(wxFontWeight weight) {
 	return result;
 }
 
+namespace
+{
+	wxString s_bitmapBasePath;
+}
+
+void TypeConv::SetBitmapBasePath( const wxString& path )
+{
+	s_bitmapBasePath = path;
+}
+
 wxBitmap TypeConv::StringToBitmap( const wxString& filename )
 {
 	#ifndef __WXFB_DEBUG__
@@ -465,7 +474,7 @@ wxBitmap TypeConv::StringToBitmap( const wxString& filename )
 	// Setup the working directory to the project path - paths should be saved in the .fbp file relative to the location
 	// of the .fbp file
 	wxFileSystem system;
-	system.ChangePathTo( AppData()->GetProjectPath(), true );
+	system.ChangePathTo( s_bitmapBasePath, true );
 
 	// The loader can get goofy on linux if it starts with file:, not sure why (wxGTK 2.8.7)
 	wxFSFile *fsfile = NULL;
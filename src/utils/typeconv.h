@@ -58,6 +58,12 @@ namespace TypeConv
 
 	wxBitmap StringToBitmap( const wxString& filename );
 
+	/**
+	* Sets the directory StringToBitmap() loads relative paths from, the one of
+	* the open project.
+	*/
+	void SetBitmapBasePath( const wxString& path );
+
 	wxFontContainer StringToFont( const wxString &str );
 	wxString FontToString( const wxFontContainer &font );
 	wxString FontFamilyToString(wxFontFamily family);
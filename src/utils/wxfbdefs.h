@@ -31,6 +31,7 @@
 
 class ObjectBase;
 class ObjectInfo;
+class ObjectSchema;
 class ObjectPackage;
 class Property;
 class PropertyInfo;
@@ -44,6 +45,13 @@ class CodeWriter;
 class TemplateParser;
 class TCCodeWriter;
 class StringCodeWriter;
+class ProjectIndex;
+class GenerationManifest;
+class TemplateProgram;
+
+// Version of wxFormBuilder, defined in codegen.cpp
+extern const char* const VERSION;
+extern const char* const REVISION;
 
 // Let's go with a few typedefs for frequently used types,
 // please use it, code will be cleaner and easier to read.
@@ -56,6 +64,7 @@ typedef std::weak_ptr<ObjectPackage>   WPObjectPackage;
 
 typedef std::shared_ptr<CodeInfo>     PCodeInfo;
 typedef std::shared_ptr<ObjectInfo>   PObjectInfo;
+typedef std::shared_ptr<ObjectSchema> PObjectSchema;
 typedef std::shared_ptr<Property>     PProperty;
 typedef std::shared_ptr<PropertyInfo> PPropertyInfo;
 typedef std::shared_ptr<EventInfo>    PEventInfo;
@@ -70,6 +79,7 @@ typedef std::map<wxString, PEvent>        EventMap;
 
 
 typedef std::vector<PObjectBase> ObjectBaseVector;
+typedef std::vector<PProperty>   PropertyVector;
 typedef std::vector<PEvent>      EventVector;
 
 typedef std::shared_ptr<wxFBManager> PwxFBManager;
@@ -77,6 +87,9 @@ typedef std::shared_ptr<CodeWriter> PCodeWriter;
 typedef std::shared_ptr<TemplateParser> PTemplateParser;
 typedef std::shared_ptr<TCCodeWriter> PTCCodeWriter;
 typedef std::shared_ptr<StringCodeWriter> PStringCodeWriter;
+typedef std::shared_ptr<ProjectIndex> PProjectIndex;
+typedef std::shared_ptr<GenerationManifest> PGenerationManifest;
+typedef std::shared_ptr<TemplateProgram> PTemplateProgram;
 
 // Flatnotebook styles are stored in config, if style #defines change, or config is manually modified, these style overrides still apply
 #define FNB_STYLE_OVERRIDES( x ) ( x | wxFNB_CUSTOM_DLG | wxFNB_NO_X_BUTTON ) & ( ~wxFNB_X_ON_TAB & ~wxFNB_MOUSE_MIDDLE_CLOSES_TABS & ~wxFNB_DCLICK_CLOSES_TABS & ~wxFNB_ALLOW_FOREIGN_DND )
@@ -30,9 +30,41 @@
 
 #include "debug.h"
 
+#include <wx/apptrait.h>
+#include <wx/evtloop.h>
 #include <wx/filename.h>
+#include <wx/tokenzr.h>
 #include <wx/wx.h>
 
+// Create lockfile/mutex name
+static wxString MakeInstanceName( const wxString& key )
+{
+	wxString name = wxString::Format( wxT("wxFormBuilder-%s-%s"), wxGetUserId().c_str(), key.c_str() );
+
+	// Get forbidden characters
+	wxString forbidden = wxFileName::GetForbiddenChars();
+
+	// Repace forbidded characters
+	for ( size_t c = 0; c < forbidden.Length(); ++c )
+	{
+		wxString bad( forbidden.GetChar( c ) );
+		name.Replace( bad.c_str(), wxT("_") );
+	}
+
+	// Paths are not case sensitive in windows
+	#ifdef __WXMSW__
+	name = name.MakeLower();
+	#endif
+
+	// GetForbiddenChars is missing "/" in unix. Prepend '.' to make lockfiles hidden
+	#ifndef __WXMSW__
+	name.Replace( wxT("/"), wxT("_") );
+	name.Prepend( wxT(".") );
+	#endif
+
+	return name;
+}
+
 bool wxFBIPC::VerifySingleInstance( const wxString& file, bool switchTo )
 {
 	// Possible send a message to the running instance through this string later, for now it is left empty
@@ -57,29 +89,7 @@ bool wxFBIPC::VerifySingleInstance( const wxString& file, bool switchTo )
 
 	// Check for single instance
 
-	// Create lockfile/mutex name
-	wxString name = wxString::Format( wxT("wxFormBuilder-%s-%s"), wxGetUserId().c_str(), path.GetFullPath().c_str() );
-
-	// Get forbidden characters
-	wxString forbidden = wxFileName::GetForbiddenChars();
-
-	// Repace forbidded characters
-	for ( size_t c = 0; c < forbidden.Length(); ++c )
-	{
-		wxString bad( forbidden.GetChar( c ) );
-		name.Replace( bad.c_str(), wxT("_") );
-	}
-
-	// Paths are not case sensitive in windows
-	#ifdef __WXMSW__
-	name = name.MakeLower();
-	#endif
-
-	// GetForbiddenChars is missing "/" in unix. Prepend '.' to make lockfiles hidden
-	#ifndef __WXMSW__
-	name.Replace( wxT("/"), wxT("_") );
-	name.Prepend( wxT(".") );
-	#endif
+	wxString name = MakeInstanceName( path.GetFullPath() );
 
 	// Check to see if I already have a server with this name - if so, no need to make another!
 	if (m_server) {
@@ -243,3 +253,252 @@ wxConnectionBase* AppClient::OnMakeConnection()
 {
 	return new AppConnection;
 }
+
+namespace
+{
+// Collects the messages logged while a request is served, for the client
+class RequestLog : public wxLog
+{
+public:
+	const wxString& GetText() const { return m_text; }
+
+protected:
+	void DoLogTextAtLevel( wxLogLevel level, const wxString& msg ) override
+	{
+		m_text << msg << wxT("\n");
+	}
+
+private:
+	wxString m_text;
+};
+}
+
+wxFBGeneratorIPC::wxFBGeneratorIPC()
+:
+m_name( MakeInstanceName( wxT("generator") ) )
+{
+}
+
+wxString wxFBGeneratorIPC::GetService() const
+{
+	#ifdef __WXMSW__
+		return m_name;
+	#else
+		// A unix domain socket, that only this user can use
+		return wxFileName::GetTempDir() + wxFILE_SEP_PATH + m_name;
+	#endif
+}
+
+bool wxFBGeneratorIPC::Serve( ProjectGenerator& generator )
+{
+	std::unique_ptr<wxSingleInstanceChecker> checker;
+	{
+		// Suspend logging, because error messages here are not useful
+		#ifndef __WXFB_DEBUG__
+		wxLogNull stopLogging;
+		#endif
+		checker.reset( new wxSingleInstanceChecker( m_name ) );
+	}
+
+	if ( checker->IsAnotherRunning() )
+	{
+		wxLogError( _("A generator daemon is already running.") );
+		return false;
+	}
+
+	GeneratorServer server( m_name, generator );
+	if ( !server.Create( GetService() ) )
+	{
+		wxLogError( wxT("Failed to create an IPC service with name %s"), GetService().c_str() );
+		return false;
+	}
+
+	wxLogStatus( _("Waiting for generation requests on %s"), GetService().c_str() );
+
+	std::unique_ptr<wxEventLoopBase> loop( wxTheApp->GetTraits()->CreateEventLoop() );
+	loop->Run();
+	return true;
+}
+
+bool wxFBGeneratorIPC::Generate( const std::vector< wxString >& files, const ProjectGenerator::Options& options,
+                                 int& status, std::vector< wxString >& generated, wxString& messages )
+{
+	std::unique_ptr<AppClient> client( new AppClient );
+	std::unique_ptr<wxConnectionBase> connection;
+	{
+		// No daemon running is not an error, the caller generates the projects itself
+		wxLogNull stopLogging;
+		connection.reset( client->MakeConnection( wxT("localhost"), GetService(), m_name ) );
+	}
+
+	if ( !connection )
+	{
+		return false;
+	}
+
+	// The jobs, the languages, the depfile, the check flag, then the files. The paths are used by another process
+	wxString request = wxString::Format( wxT("%u\n%s\n%s\n%i\n"), options.jobs, options.languages.c_str(),
+	                                     options.depfile.c_str(), options.check ? 1 : 0 );
+	for ( const wxString& file : files )
+	{
+		wxFileName path( file );
+		path.MakeAbsolute();
+		request << path.GetFullPath() << wxT("\n");
+	}
+
+	const wxScopedCharBuffer data = request.utf8_str();
+	if ( !connection->Poke( wxT("generate"), data.data(), data.length(), wxIPC_UTF8TEXT ) )
+	{
+		return false;
+	}
+
+	size_t size = 0;
+	const char* reply = static_cast< const char* >( connection->Request( wxT("generate"), &size, wxIPC_UTF8TEXT ) );
+	if ( !reply )
+	{
+		return false;
+	}
+
+	// The status, the generated files, an empty line, then the messages
+	const wxString text = wxString::FromUTF8( reply, size );
+	size_t end = text.find( wxT("\n\n") );
+	messages = ( end == wxString::npos ? wxString() : text.substr( end + 2 ) );
+
+	wxStringTokenizer lines( text.substr( 0, end ), wxT("\n"), wxTOKEN_STRTOK );
+	long value = 6;
+	if ( !lines.GetNextToken().ToLong( &value ) )
+	{
+		return false;
+	}
+	status = static_cast< int >( value );
+
+	generated.clear();
+	while ( lines.HasMoreTokens() )
+	{
+		generated.push_back( lines.GetNextToken() );
+	}
+
+	return true;
+}
+
+bool wxFBGeneratorIPC::Stop()
+{
+	std::unique_ptr<AppClient> client( new AppClient );
+	std::unique_ptr<wxConnectionBase> connection;
+	{
+		// Suspend logging, because error messages here are not useful
+		#ifndef __WXFB_DEBUG__
+		wxLogNull stopLogging;
+		#endif
+		connection.reset( client->MakeConnection( wxT("localhost"), GetService(), m_name ) );
+	}
+
+	if ( !connection )
+	{
+		wxLogError( _("No generator daemon is running.") );
+		return false;
+	}
+
+	return connection->Execute( wxT("stop") );
+}
+
+wxConnectionBase* GeneratorServer::OnAcceptConnection( const wxString& topic )
+{
+	if ( topic == m_name )
+	{
+		return new GeneratorConnection( m_generator );
+	}
+
+	return NULL;
+}
+
+bool GeneratorConnection::OnPoke( const wxString& topic, const wxString& item, const void* data, size_t size, wxIPCFormat format )
+{
+	if ( item != wxT("generate") )
+	{
+		return false;
+	}
+
+	m_request = wxString::FromUTF8( static_cast< const char* >( data ), size );
+	return true;
+}
+
+const void* GeneratorConnection::OnRequest( const wxString& topic, const wxString& item, size_t* size, wxIPCFormat format )
+{
+	if ( item != wxT("generate") )
+	{
+		return NULL;
+	}
+
+	wxArrayString lines = wxStringTokenize( m_request, wxT("\n"), wxTOKEN_RET_EMPTY );
+	m_request.clear();
+
+	long jobs = 1;
+	long check = 0;
+	if ( lines.GetCount() < 4 || !lines[ 0 ].ToLong( &jobs ) || jobs < 0 || !lines[ 3 ].ToLong( &check ) )
+	{
+		return NULL;
+	}
+
+	ProjectGenerator::Options options;
+	options.jobs = static_cast< unsigned int >( jobs );
+	options.languages = lines[ 1 ];
+	options.depfile = lines[ 2 ];
+	options.check = ( check != 0 );
+
+	std::vector< wxString > files;
+	for ( size_t i = 4; i < lines.GetCount(); ++i )
+	{
+		if ( !lines[ i ].empty() )
+		{
+			files.push_back( lines[ i ] );
+		}
+	}
+
+	// The messages are sent to the client, the threads of the generation flushed into them
+	RequestLog* log = new RequestLog;
+	wxLog* oldLog = wxLog::SetActiveTarget( log );
+	bool success = m_generator.Generate( files, options );
+	wxLog::FlushActive();
+	wxLog::SetActiveTarget( oldLog );
+
+	// Same exit codes as generating in the client
+	const std::vector< wxString >& listed = ( options.check ? m_generator.GetStaleFiles() : m_generator.GetGeneratedFiles() );
+	int status = 0;
+	if ( !success )
+	{
+		status = 6;
+	}
+	else if ( options.check && !listed.empty() )
+	{
+		status = 8;
+	}
+
+	wxString reply = wxString::Format( wxT("%i\n"), status );
+	for ( const wxString& file : listed )
+	{
+		reply << file << wxT("\n");
+	}
+	reply << wxT("\n") << log->GetText();
+	delete log;
+
+	m_reply = reply.utf8_str().data();
+	*size = m_reply.length();
+	return m_reply.c_str();
+}
+
+bool GeneratorConnection::OnExecute( const wxString& topic, const void* data, size_t size, wxIPCFormat format )
+{
+	if ( GetTextFromData( data, size, format ) != wxT("stop") )
+	{
+		return false;
+	}
+
+	wxEventLoopBase* loop = wxEventLoopBase::GetActive();
+	if ( loop )
+	{
+		loop->Exit();
+	}
+
+	return true;
+}
@@ -24,8 +24,12 @@
 #ifndef WXFBIPC_H
 #define WXFBIPC_H
 
+#include "../codegen/projectgenerator.h"
+
 #include <wx/ipc.h>
 #include <memory>
+#include <string>
+#include <vector>
 #include <wx/snglinst.h>
 
 /* Only allow one instance of a project to be loaded at a time */
@@ -80,4 +84,54 @@ public:
 	wxConnectionBase* OnMakeConnection() override;
 };
 
+/* Code generation daemon, keeps the plugins loaded between the requests of its clients.
+   Only the processes of the same user can connect to it */
+
+class wxFBGeneratorIPC
+{
+	private:
+		const wxString m_name;
+
+		wxString GetService() const;
+
+	public:
+		wxFBGeneratorIPC();
+
+		// Serves the requests until a client stops the daemon
+		bool Serve( ProjectGenerator& generator );
+
+		// Lets the daemon generate the projects, returns false if no daemon answered
+		// In check mode, the files listed are the ones whose content would change
+		bool Generate( const std::vector< wxString >& files, const ProjectGenerator::Options& options,
+		               int& status, std::vector< wxString >& generated, wxString& messages );
+
+		bool Stop();
+};
+
+// Connection of a client to the generator daemon, on the side of the daemon
+class GeneratorConnection: public wxConnection
+{
+private:
+	ProjectGenerator& m_generator;
+	wxString m_request;
+	std::string m_reply;
+
+public:
+	GeneratorConnection( ProjectGenerator& generator ) : m_generator( generator ){}
+	bool OnPoke( const wxString& topic, const wxString& item, const void* data, size_t size, wxIPCFormat format ) override;
+	const void* OnRequest( const wxString& topic, const wxString& item, size_t* size, wxIPCFormat format ) override;
+	bool OnExecute( const wxString& topic, const void* data, size_t size, wxIPCFormat format ) override;
+};
+
+// Server class of the generator daemon
+class GeneratorServer: public wxServer
+{
+public:
+	const wxString m_name;
+	ProjectGenerator& m_generator;
+
+	GeneratorServer( const wxString& name, ProjectGenerator& generator ) : m_name( name ), m_generator( generator ){}
+	wxConnectionBase* OnAcceptConnection( const wxString& topic ) override;
+};
+
 #endif //WXFBIPC_H